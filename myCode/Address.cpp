@@ -46,19 +46,20 @@ void Address::write(std::ostream &out) const
 
 std::shared_ptr<Address> Address::read(std::istream &in)
 {
-	std::string street;
-	unsigned short postalCode;
-	std::string city;
-	std::string additionalInfo;
-	std::string inp;
-	std::getline(in, street, ';');
-	std::getline(in, inp, ';');
-	postalCode = static_cast<unsigned int>(std::stoi(inp));
-	std::getline(in, city, ';');
-	std::getline(in, additionalInfo);
+	FieldParser fields(FieldParser::readLine(in));
+	return read(fields);
+}
+
+std::shared_ptr<Address> Address::read(FieldParser &fields)
+{
+	std::string_view street = fields.text();
+	unsigned short postalCode =
+			static_cast<unsigned short>(fields.unsignedInteger());
+	std::string_view city = fields.text();
+	std::string_view additionalInfo = fields.remainder();
 
-	auto addrPtr = std::make_shared<Address>(street, postalCode, city,
-			additionalInfo);
+	auto addrPtr = std::make_shared<Address>(std::string(street), postalCode,
+			std::string(city), std::string(additionalInfo));
 	return addrPtr;
 }
 
@@ -11,6 +11,7 @@
 #include <string>
 #include <fstream>
 #include <memory>
+#include "FieldParser.h"
 
 /**
  * @class Address
@@ -72,6 +73,14 @@ public:
 	 */
 	static std::shared_ptr<Address> read(std::istream &in);
 
+	/**
+	 * @brief Creates an Address from the next fields of a record.
+	 * @param fields Parser positioned at the street, the additional info
+	 * takes the rest of the line.
+	 * @return Shared pointer to the new Address object.
+	 */
+	static std::shared_ptr<Address> read(FieldParser &fields);
+
 	/**
 	 * @brief Destructs the Address object.
 	 */
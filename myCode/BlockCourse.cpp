@@ -11,52 +11,71 @@ BlockCourse::BlockCourse(unsigned int courseKey, const std::string majorStr,
 		const std::string title, unsigned int creditPts,
 		const Poco::Data::Date startD, const Poco::Data::Date endD,
 		const Poco::Data::Time startT, const Poco::Data::Time endT) :
+		Course(courseKey, title, majorStr, creditPts), startDate(
+				CompactDate::fromDate(startD)), endDate(
+				CompactDate::fromDate(endD)), startTime(
+				CompactTime::fromTime(startT)), endTime(
+				CompactTime::fromTime(endT))
+{
+}
+
+BlockCourse::BlockCourse(unsigned int courseKey, const std::string majorStr,
+		const std::string title, unsigned int creditPts, CompactDate startD,
+		CompactDate endD, CompactTime startT, CompactTime endT) :
 		Course(courseKey, title, majorStr, creditPts), startDate(startD), endDate(
 				endD), startTime(startT), endTime(endT)
 {
 }
 
-Poco::Data::Date BlockCourse::convertDate(std::string dateString)
+Poco::Data::Date BlockCourse::getStartDate() const
 {
-	int year, month, day;
-	sscanf(dateString.c_str(), "%d.%d.%d", &day, &month, &year);
-	return Poco::Data::Date(year, month, day);
+	return this->startDate.toDate();
 }
 
-Poco::Data::Time BlockCourse::convertTime(std::string timeString)
+Poco::Data::Date BlockCourse::getEndDate() const
 {
-	int hour, minute, second = 0;
-	sscanf(timeString.c_str(), "%d:%d", &hour, &minute);
-	return Poco::Data::Time(hour, minute, second);
+	return this->endDate.toDate();
 }
 
-Poco::Data::Date BlockCourse::getStartDate() const
+Poco::Data::Time BlockCourse::getStartTime() const
+{
+	return this->startTime.toTime();
+}
+
+Poco::Data::Time BlockCourse::getEndTime() const
+{
+	return this->endTime.toTime();
+}
+
+CompactDate BlockCourse::getStartDay() const
 {
 	return this->startDate;
 }
 
-Poco::Data::Date BlockCourse::getEndDate() const
+CompactDate BlockCourse::getEndDay() const
 {
 	return this->endDate;
 }
 
-Poco::Data::Time BlockCourse::getStartTime() const
+int BlockCourse::getStartMinute() const
 {
-	return this->startTime;
+	return this->startTime.getMinuteOfDay();
 }
 
-Poco::Data::Time BlockCourse::getEndTime() const
+int BlockCourse::getEndMinute() const
 {
-	return this->endTime;
+	return this->endTime.getMinuteOfDay();
 }
 
 void BlockCourse::write(std::ostream &out) const
 {
 	out << "B;";
 	Course::write(out);
-	out << ";" << this->startDate.day() << "." << this->startDate.month() << "."
-			<< this->startDate.year() << ";" << this->endDate.day() << "."
-			<< this->endDate.month() << "." << this->endDate.year() << ";"
+	int startYear, startMonth, startDay, endYear, endMonth, endDay;
+	this->startDate.toYmd(startYear, startMonth, startDay);
+	this->endDate.toYmd(endYear, endMonth, endDay);
+	out << ";" << startDay << "." << startMonth << "." << startYear << ";"
+			<< endDay << "." << endMonth << "." << endYear << ";"
 			<< std::setfill('0') << std::setw(2) << this->startTime.hour()
 			<< ":" << std::setfill('0') << std::setw(2)
 			<< this->startTime.minute() << ";" << std::setfill('0')
@@ -66,35 +85,22 @@ void BlockCourse::write(std::ostream &out) const
 
 std::unique_ptr<Course> BlockCourse::read(std::istream &in)
 {
-	unsigned int courseKey;
-	std::string title, major;
-	unsigned int creditPoints;
-	Poco::Data::Date startDate, endDate;
-	Poco::Data::Time startTime, endTime;
-	std::string inp;
-	std::getline(in, inp, ';');
-	courseKey = static_cast<unsigned int>(std::stoi(inp));
-
-	std::getline(in, title, ';');
-
-	std::getline(in, major, ';');
-
-	std::getline(in, inp, ';');
-	creditPoints = static_cast<unsigned int>(std::stoi(inp));
-
-	std::getline(in, inp, ';');
-	startDate = convertDate(inp);
-
-	std::getline(in, inp, ';');
-	endDate = convertDate(inp);
-
-	std::getline(in, inp, ';');
-	startTime = convertTime(inp);
-	std::getline(in, inp);
-	endTime = convertTime(inp);
-	auto courses =
-			std::make_unique < BlockCourse
-					> (courseKey, major, title, creditPoints, startDate, endDate, startTime, endTime);
+	FieldParser fields(FieldParser::readLine(in));
+	return read(fields);
+}
+
+std::unique_ptr<Course> BlockCourse::read(FieldParser &fields)
+{
+	unsigned int courseKey = fields.unsignedInteger();
+	std::string_view title = fields.text();
+	std::string_view major = fields.text();
+	unsigned int creditPoints = fields.unsignedInteger();
+	CompactDate startDate = fields.date();
+	CompactDate endDate = fields.date();
+	CompactTime startTime = fields.time();
+	CompactTime endTime = fields.time();
+	auto courses = std::make_unique < BlockCourse
+			> (courseKey, std::string(major), std::string(title), creditPoints, startDate, endDate, startTime, endTime);
 
 	return courses;
 
@@ -12,6 +12,9 @@
 #include "Poco/Data/Date.h"
 #include "Poco/Data/Time.h"
 #include "Course.h"
+#include "CompactDate.h"
+#include "CompactTime.h"
+#include "FieldParser.h"
 
 /**
  * @class BlockCourse
@@ -20,24 +23,10 @@
 class BlockCourse: public Course
 {
 private:
-	Poco::Data::Date startDate; ///< Course start date.
-	Poco::Data::Date endDate; ///< Course end date.
-	Poco::Data::Time startTime; ///< Course start time.
-	Poco::Data::Time endTime; ///< Course end time.
-
-	/**
-	 * @brief Converts string to Poco::Data::Date.
-	 * @param dateString String representation of a date.
-	 * @return Poco::Data::Date object.
-	 */
-	static Poco::Data::Date convertDate(std::string dateString);
-
-	/**
-	 * @brief Converts string to Poco::Data::Time.
-	 * @param timeString String representation of a time.
-	 * @return Poco::Data::Time object.
-	 */
-	static Poco::Data::Time convertTime(std::string timeString);
+	CompactDate startDate; ///< Course start date.
+	CompactDate endDate; ///< Course end date.
+	CompactTime startTime; ///< Course start time.
+	CompactTime endTime; ///< Course end time.
 
 public:
 	/**
@@ -56,6 +45,22 @@ public:
 			const Poco::Data::Date startD, const Poco::Data::Date endD,
 			const Poco::Data::Time startT, const Poco::Data::Time endT);
 
+	/**
+	 * @brief Constructor for BlockCourse from already converted fields.
+	 * @param courseKey Unique course identifier.
+	 * @param majorStr Major associated with the course.
+	 * @param title Course title.
+	 * @param creditPts Credit points of the course.
+	 * @param startD Start date of the course.
+	 * @param endD End date of the course.
+	 * @param startT Start time of the course.
+	 * @param endT End time of the course.
+	 */
+	BlockCourse(unsigned int courseKey, const std::string majorStr,
+			const std::string title, unsigned int creditPts,
+			CompactDate startD, CompactDate endD, CompactTime startT,
+			CompactTime endT);
+
 	/**
 	 * @brief Gets the start date of the course.
 	 * @return Start date.
@@ -80,6 +85,30 @@ public:
 	 */
 	Poco::Data::Time getEndTime() const;
 
+	/**
+	 * @brief Gets the start date without converting it.
+	 * @return Start date as a day number.
+	 */
+	CompactDate getStartDay() const;
+
+	/**
+	 * @brief Gets the end date without converting it.
+	 * @return End date as a day number.
+	 */
+	CompactDate getEndDay() const;
+
+	/**
+	 * @brief Gets the start time without converting it.
+	 * @return Minutes since midnight.
+	 */
+	int getStartMinute() const;
+
+	/**
+	 * @brief Gets the end time without converting it.
+	 * @return Minutes since midnight.
+	 */
+	int getEndMinute() const;
+
 	/**
 	 * @brief Writes course details to an output stream.
 	 * @param out Output stream reference.
@@ -93,6 +122,13 @@ public:
 	 */
 	static std::unique_ptr<Course> read(std::istream &in);
 
+	/**
+	 * @brief Creates a BlockCourse from the fields following the type.
+	 * @param fields Parser positioned at the course key.
+	 * @return Unique pointer to the new BlockCourse.
+	 */
+	static std::unique_ptr<Course> read(FieldParser &fields);
+
 	/**
 	 * @brief Destructor for BlockCourse.
 	 */
@@ -0,0 +1,176 @@
+/**
+ * @file BoundedQueue.h
+ * @brief BoundedQueue class template, a lock-free multi-producer queue.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef BOUNDEDQUEUE_H_
+#define BOUNDEDQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief Fixed capacity multi-producer multi-consumer ring buffer.
+ *
+ * Every slot carries a sequence number telling producers and consumers
+ * whether it is free or filled, so neither side takes a lock. The capacity
+ * is rounded up to a power of two.
+ * @tparam T Element type, must be default constructible and movable.
+ */
+template<typename T>
+class BoundedQueue
+{
+private:
+	/**
+	 * @struct Slot
+	 * @brief Ring buffer cell.
+	 */
+	struct Slot
+	{
+		std::atomic<std::size_t> sequence; ///< Ticket of the next expected access.
+		T value; ///< Stored element.
+	};
+
+	std::size_t mask; ///< Capacity minus one.
+	std::unique_ptr<Slot[]> slots; ///< The ring buffer.
+	char producerPadding[64]; ///< Keeps the tickets on separate cache lines.
+	std::atomic<std::size_t> enqueuePos; ///< Next producer ticket.
+	char consumerPadding[64]; ///< Keeps the tickets on separate cache lines.
+	std::atomic<std::size_t> dequeuePos; ///< Next consumer ticket.
+
+public:
+	/**
+	 * @brief Creates an empty queue.
+	 * @param capacity Minimum number of elements the queue can hold.
+	 */
+	explicit BoundedQueue(std::size_t capacity) :
+			enqueuePos(0), dequeuePos(0)
+	{
+		std::size_t size = 2;
+		while (size < capacity)
+		{
+			size <<= 1;
+		}
+		this->mask = size - 1;
+		this->slots.reset(new Slot[size]);
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			this->slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	BoundedQueue(const BoundedQueue&) = delete;
+	BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+	/**
+	 * @brief Returns the number of slots.
+	 * @return Capacity of the queue.
+	 */
+	std::size_t capacity() const
+	{
+		return this->mask + 1;
+	}
+
+	/**
+	 * @brief Returns the approximate number of queued elements.
+	 * @return Queue depth, exact only when no other thread is active.
+	 */
+	std::size_t size() const
+	{
+		std::size_t enq = this->enqueuePos.load(std::memory_order_relaxed);
+		std::size_t deq = this->dequeuePos.load(std::memory_order_relaxed);
+		return enq > deq ? enq - deq : 0;
+	}
+
+	/**
+	 * @brief Appends an element if there is room.
+	 * @param value Element to move into the queue, untouched on failure.
+	 * @return False if the queue is full.
+	 */
+	bool tryPush(T &value)
+	{
+		std::size_t pos = this->enqueuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Slot &slot = this->slots[pos & this->mask];
+			std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq)
+					- static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0)
+			{
+				if (this->enqueuePos.compare_exchange_weak(pos, pos + 1,
+						std::memory_order_relaxed))
+				{
+					slot.value = std::move(value);
+					slot.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = this->enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/**
+	 * @brief Appends an element, yielding while the queue is full.
+	 * @param value Element to move into the queue.
+	 */
+	void push(T value)
+	{
+		while (!tryPush(value))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	/**
+	 * @brief Removes the oldest element if there is one.
+	 * @param value Receives the element.
+	 * @return False if the queue is empty.
+	 */
+	bool tryPop(T &value)
+	{
+		std::size_t pos = this->dequeuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Slot &slot = this->slots[pos & this->mask];
+			std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq)
+					- static_cast<std::ptrdiff_t>(pos + 1);
+			if (diff == 0)
+			{
+				if (this->dequeuePos.compare_exchange_weak(pos, pos + 1,
+						std::memory_order_relaxed))
+				{
+					value = std::move(slot.value);
+					slot.value = T();
+					slot.sequence.store(pos + this->mask + 1,
+							std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = this->dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+};
+
+#endif /* BOUNDEDQUEUE_H_ */
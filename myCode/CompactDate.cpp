@@ -0,0 +1,100 @@
+/**
+ * @file CompactDate.cpp
+ * @brief CompactDate class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "CompactDate.h"
+#include <stdexcept>
+
+CompactDate::CompactDate() :
+		dayNumber(0)
+{
+}
+
+CompactDate::CompactDate(std::int32_t dayNumber) :
+		dayNumber(dayNumber)
+{
+}
+
+CompactDate CompactDate::fromYmd(int year, int month, int day)
+{
+	if (year < minYear || year > maxYear)
+	{
+		throw std::invalid_argument("Year out of range.");
+	}
+	// The year is shifted to start in March, so leap days come last.
+	year -= month <= 2 ? 1 : 0;
+	int era = (year >= 0 ? year : year - 399) / 400;
+	int yearOfEra = year - era * 400;
+	int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100
+			+ dayOfYear;
+	return CompactDate(era * 146097 + dayOfEra - 719468);
+}
+
+CompactDate CompactDate::fromDateTime(const Poco::DateTime &date)
+{
+	return fromYmd(date.year(), date.month(), date.day());
+}
+
+CompactDate CompactDate::fromDate(const Poco::Data::Date &date)
+{
+	return fromYmd(date.year(), date.month(), date.day());
+}
+
+void CompactDate::toYmd(int &year, int &month, int &day) const
+{
+	int shifted = this->dayNumber + 719468;
+	int era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+	int dayOfEra = shifted - era * 146097;
+	int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524
+			- dayOfEra / 146096) / 365;
+	int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4
+			- yearOfEra / 100);
+	int shiftedMonth = (5 * dayOfYear + 2) / 153;
+	day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+	month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+	year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+Poco::DateTime CompactDate::toDateTime() const
+{
+	int year, month, day;
+	toYmd(year, month, day);
+	return Poco::DateTime(year, month, day);
+}
+
+Poco::Data::Date CompactDate::toDate() const
+{
+	int year, month, day;
+	toYmd(year, month, day);
+	return Poco::Data::Date(year, month, day);
+}
+
+std::int32_t CompactDate::getDayNumber() const
+{
+	return this->dayNumber;
+}
+
+int CompactDate::getDayOfWeek() const
+{
+	// 01.01.1970 was a Thursday.
+	return ((this->dayNumber + 4) % 7 + 7) % 7;
+}
+
+bool CompactDate::operator==(const CompactDate &other) const
+{
+	return this->dayNumber == other.dayNumber;
+}
+
+bool CompactDate::operator<(const CompactDate &other) const
+{
+	return this->dayNumber < other.dayNumber;
+}
+
+bool CompactDate::operator<=(const CompactDate &other) const
+{
+	return this->dayNumber <= other.dayNumber;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file CompactDate.h
+ * @brief CompactDate class declaration, a date stored as a day number.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef COMPACTDATE_H_
+#define COMPACTDATE_H_
+
+#include <cstdint>
+#include <Poco/DateTime.h>
+#include <Poco/Data/Date.h>
+
+/**
+ * @class CompactDate
+ * @brief Calendar date as a 32 bit count of days since 01.01.1970.
+ *
+ * Used inside the records instead of the Poco types, comparisons and
+ * range indexing are plain integer operations. Poco values are only
+ * created at the API boundary, so the years are limited to the range Poco
+ * represents.
+ */
+class CompactDate
+{
+private:
+	std::int32_t dayNumber; ///< Days since 01.01.1970, negative before.
+
+public:
+	static const int minYear = 0; ///< Earliest year of a date.
+	static const int maxYear = 9999; ///< Latest year of a date.
+
+	/**
+	 * @brief Creates 01.01.1970.
+	 */
+	CompactDate();
+
+	/**
+	 * @brief Creates a date from a day number.
+	 * @param dayNumber Days since 01.01.1970, of a date within minYear and
+	 * maxYear.
+	 */
+	explicit CompactDate(std::int32_t dayNumber);
+
+	/**
+	 * @brief Converts a calendar date, proleptic Gregorian calendar.
+	 * @param year Year, minYear..maxYear.
+	 * @param month Month, 1..12.
+	 * @param day Day of the month.
+	 * @return The date.
+	 * @throw std::invalid_argument If the year is out of range.
+	 */
+	static CompactDate fromYmd(int year, int month, int day);
+
+	static CompactDate fromDateTime(const Poco::DateTime &date);
+	static CompactDate fromDate(const Poco::Data::Date &date);
+
+	/**
+	 * @brief Splits the date into its calendar fields.
+	 * @param year Receives the year.
+	 * @param month Receives the month, 1..12.
+	 * @param day Receives the day of the month.
+	 */
+	void toYmd(int &year, int &month, int &day) const;
+
+	/**
+	 * @brief Converts to Poco, which holds every date of minYear..maxYear.
+	 * @return The date at midnight.
+	 */
+	Poco::DateTime toDateTime() const;
+
+	/**
+	 * @brief Converts to Poco, which holds every date of minYear..maxYear.
+	 * @return The date.
+	 */
+	Poco::Data::Date toDate() const;
+
+	std::int32_t getDayNumber() const;
+
+	/**
+	 * @brief Returns the day of the week.
+	 * @return 0 for Sunday up to 6 for Saturday, as Poco::DateTime::DaysOfWeek.
+	 */
+	int getDayOfWeek() const;
+
+	bool operator==(const CompactDate &other) const;
+	bool operator<(const CompactDate &other) const;
+	bool operator<=(const CompactDate &other) const;
+};
+
+#endif /* COMPACTDATE_H_ */
@@ -0,0 +1,43 @@
+/**
+ * @file CompactTime.cpp
+ * @brief CompactTime class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "CompactTime.h"
+
+CompactTime::CompactTime() :
+		minuteOfDay(0)
+{
+}
+
+CompactTime::CompactTime(int hour, int minute) :
+		minuteOfDay(static_cast<std::uint16_t>(hour * 60 + minute))
+{
+}
+
+CompactTime CompactTime::fromTime(const Poco::Data::Time &time)
+{
+	return CompactTime(time.hour(), time.minute());
+}
+
+Poco::Data::Time CompactTime::toTime() const
+{
+	return Poco::Data::Time(hour(), minute(), 0);
+}
+
+int CompactTime::getMinuteOfDay() const
+{
+	return this->minuteOfDay;
+}
+
+int CompactTime::hour() const
+{
+	return this->minuteOfDay / 60;
+}
+
+int CompactTime::minute() const
+{
+	return this->minuteOfDay % 60;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file CompactTime.h
+ * @brief CompactTime class declaration, a time of day stored in minutes.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef COMPACTTIME_H_
+#define COMPACTTIME_H_
+
+#include <cstdint>
+#include <Poco/Data/Time.h>
+
+/**
+ * @class CompactTime
+ * @brief Time of day as a 16 bit minute count since midnight.
+ *
+ * Used inside the course records instead of Poco::Data::Time, seconds are
+ * not kept.
+ */
+class CompactTime
+{
+private:
+	std::uint16_t minuteOfDay; ///< Minutes since 00:00.
+
+public:
+	/**
+	 * @brief Creates 00:00.
+	 */
+	CompactTime();
+
+	/**
+	 * @brief Creates a time from hour and minute.
+	 * @param hour Hour, 0..23.
+	 * @param minute Minute, 0..59.
+	 */
+	CompactTime(int hour, int minute);
+
+	static CompactTime fromTime(const Poco::Data::Time &time);
+	Poco::Data::Time toTime() const;
+
+	int getMinuteOfDay() const;
+	int hour() const;
+	int minute() const;
+};
+
+#endif /* COMPACTTIME_H_ */
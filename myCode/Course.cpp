@@ -44,18 +44,28 @@ std::string Course::getMajor() const
 
 std::unique_ptr<Course> Course::read(std::istream &in)
 {
-	char type;
-	in >> type;
-	in.ignore();
+	// Other records are left in the stream for the caller.
+	in >> std::ws;
+	if (in.peek() != 'W' && in.peek() != 'B')
+	{
+		return nullptr;
+	}
+	FieldParser fields(FieldParser::readLine(in));
+	return read(fields);
+}
+
+std::unique_ptr<Course> Course::read(FieldParser &fields)
+{
+	std::string_view type = fields.text();
 	std::unique_ptr<Course> course;
 
-	if (type == 'W')
+	if (type == "W")
 	{
-		course = WeeklyCourse::read(in);
+		course = WeeklyCourse::read(fields);
 	}
-	else if (type == 'B')
+	else if (type == "B")
 	{
-		course = BlockCourse::read(in);
+		course = BlockCourse::read(fields);
 	}
 	else
 	{
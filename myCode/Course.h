@@ -13,6 +13,8 @@
 #include <fstream>
 #include <memory>
 
+class FieldParser;
+
 /**
  * @class Course
  * @brief Abstract base class for course information.
@@ -74,6 +76,13 @@ public:
 	 */
 	static std::unique_ptr<Course> read(std::istream &in);
 
+	/**
+	 * @brief Creates a Course from a record whose first field is the type.
+	 * @param fields Parser positioned at the type, 'W' or 'B'.
+	 * @return Unique pointer to a Course object, nullptr for unknown types.
+	 */
+	static std::unique_ptr<Course> read(FieldParser &fields);
+
 	/**
 	 * @brief Virtual destructor.
 	 */
@@ -0,0 +1,121 @@
+/**
+ * @file CourseSchedule.cpp
+ * @brief CourseSchedule class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "CourseSchedule.h"
+#include "BlockCourse.h"
+#include "WeeklyCourse.h"
+#include <algorithm>
+
+const int CourseSchedule::minutesPerDay;
+
+bool CourseSchedule::Slot::operator==(const Slot &other) const
+{
+	return this->startMinute == other.startMinute
+			&& this->endMinute == other.endMinute
+			&& this->firstDay == other.firstDay
+			&& this->lastDay == other.lastDay
+			&& this->courseKey == other.courseKey;
+}
+
+std::vector<CourseSchedule::Slot> CourseSchedule::slotsOf(const Course &course)
+{
+	std::vector<Slot> result;
+	const WeeklyCourse *weeklyCourse =
+			dynamic_cast<const WeeklyCourse*>(&course);
+	const BlockCourse *blockCourse = dynamic_cast<const BlockCourse*>(&course);
+	if (weeklyCourse != nullptr)
+	{
+		int dayStart = weeklyCourse->getDayOfWeek() * minutesPerDay;
+		result.push_back(
+				{ dayStart + weeklyCourse->getStartMinute(), dayStart
+						+ weeklyCourse->getEndMinute(), INT_MIN, INT_MAX,
+						course.getCourseKey() });
+	}
+	else if (blockCourse != nullptr)
+	{
+		CompactDate firstDate = blockCourse->getStartDay();
+		int firstDay = firstDate.getDayNumber();
+		int lastDay = blockCourse->getEndDay().getDayNumber();
+		int start = blockCourse->getStartMinute();
+		int end = blockCourse->getEndMinute();
+		int firstWeekday = firstDate.getDayOfWeek();
+		for (int offset = 0; offset <= lastDay - firstDay && offset < 7;
+				++offset)
+		{
+			int weekday = (firstWeekday + offset) % 7;
+			result.push_back(
+					{ weekday * minutesPerDay + start, weekday * minutesPerDay
+							+ end, firstDay, lastDay, course.getCourseKey() });
+		}
+	}
+	return result;
+}
+
+bool CourseSchedule::overlaps(const Slot &first, const Slot &second)
+{
+	return first.startMinute < second.endMinute
+			&& second.startMinute < first.endMinute
+			&& first.firstDay <= second.lastDay
+			&& second.firstDay <= first.lastDay;
+}
+
+void CourseSchedule::insert(const Course &course)
+{
+	unsigned int courseKey = course.getCourseKey();
+	this->clashes[courseKey];
+	WeekBitmap &bitmap = this->occupancy[courseKey];
+	for (const Slot &slot : slotsOf(course))
+	{
+		bitmap.set(slot.startMinute, slot.endMinute);
+		for (const Slot &other : this->slots.overlapping(slot.startMinute,
+				slot.endMinute))
+		{
+			if (other.courseKey != courseKey && overlaps(slot, other))
+			{
+				this->clashes[courseKey].insert(other.courseKey);
+				this->clashes[other.courseKey].insert(courseKey);
+			}
+		}
+		this->slots.insert(slot.startMinute, slot.endMinute, slot);
+	}
+}
+
+bool CourseSchedule::clash(unsigned int firstKey, unsigned int secondKey) const
+{
+	auto it = this->clashes.find(firstKey);
+	return it != this->clashes.end()
+			&& it->second.find(secondKey) != it->second.end();
+}
+
+const WeekBitmap& CourseSchedule::occupancyOf(unsigned int courseKey) const
+{
+	static const WeekBitmap empty;
+	auto it = this->occupancy.find(courseKey);
+	return it != this->occupancy.end() ? it->second : empty;
+}
+
+std::vector<unsigned int> CourseSchedule::coursesDuring(
+		const WeekBitmap &window) const
+{
+	std::vector<unsigned int> result;
+	for (const auto &course : this->occupancy)
+	{
+		if (course.second.intersects(window))
+		{
+			result.push_back(course.first);
+		}
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+void CourseSchedule::clear()
+{
+	this->slots.clear();
+	this->clashes.clear();
+	this->occupancy.clear();
+}
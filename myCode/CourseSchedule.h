@@ -0,0 +1,110 @@
+/**
+ * @file CourseSchedule.h
+ * @brief CourseSchedule class declaration for timetable clash detection.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef COURSESCHEDULE_H_
+#define COURSESCHEDULE_H_
+
+#include <climits>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include "Course.h"
+#include "IntervalTree.h"
+#include "WeekBitmap.h"
+
+/**
+ * @class CourseSchedule
+ * @brief Interval index over the weekly time slots of all courses.
+ *
+ * Every course is split into slots on a week axis in minutes since Sunday
+ * 00:00. A weekly course has one slot that applies on every date, a block
+ * course has one slot per weekday it covers, limited to its date range. Two
+ * slots clash if their minutes and their date ranges overlap. The clashing
+ * courses are determined once when a course is added, together with a
+ * bitmap of the weekly slots the course occupies.
+ */
+class CourseSchedule
+{
+public:
+	/**
+	 * @struct Slot
+	 * @brief A recurring time window of a course.
+	 */
+	struct Slot
+	{
+		int startMinute; ///< Minutes since Sunday 00:00, inclusive.
+		int endMinute; ///< Minutes since Sunday 00:00, exclusive.
+		int firstDay; ///< First day number the slot applies to.
+		int lastDay; ///< Last day number the slot applies to.
+		unsigned int courseKey; ///< Course the slot belongs to.
+
+		/**
+		 * @brief Compares all members.
+		 * @param other Slot to compare with.
+		 * @return True if both slots are identical.
+		 */
+		bool operator==(const Slot &other) const;
+	};
+
+	static const int minutesPerDay = 24 * 60; ///< Length of a day on the week axis.
+
+private:
+	IntervalTree<Slot> slots; ///< Slots of all courses by week minutes.
+	std::unordered_map<unsigned int, std::set<unsigned int>> clashes; ///< Clashing course keys by course key.
+	std::unordered_map<unsigned int, WeekBitmap> occupancy; ///< Weekly slots by course key.
+
+public:
+	/**
+	 * @brief Splits a course into its slots.
+	 * @param course A WeeklyCourse or BlockCourse.
+	 * @return The slots, empty for unknown course types.
+	 */
+	static std::vector<Slot> slotsOf(const Course &course);
+
+	/**
+	 * @brief Checks whether two slots overlap in time and date.
+	 * @param first A slot.
+	 * @param second Another slot.
+	 * @return True if both take place at the same time on some date.
+	 */
+	static bool overlaps(const Slot &first, const Slot &second);
+
+	/**
+	 * @brief Adds a course and records its clashes with the known courses.
+	 * @param course The course.
+	 */
+	void insert(const Course &course);
+
+	/**
+	 * @brief Checks whether two courses clash, in O(log n).
+	 * @param firstKey Key of a course.
+	 * @param secondKey Key of another course.
+	 * @return True if the courses take place at the same time.
+	 */
+	bool clash(unsigned int firstKey, unsigned int secondKey) const;
+
+	/**
+	 * @brief Returns the weekly slots of a course.
+	 * @param courseKey Key of the course.
+	 * @return The bitmap, empty for unknown courses.
+	 */
+	const WeekBitmap& occupancyOf(unsigned int courseKey) const;
+
+	/**
+	 * @brief Finds the courses taking place during any slot of a bitmap.
+	 * @param window Slots to check.
+	 * @return Keys of the matching courses in ascending order.
+	 */
+	std::vector<unsigned int> coursesDuring(const WeekBitmap &window) const;
+
+	/**
+	 * @brief Removes all courses.
+	 */
+	void clear();
+};
+
+#endif /* COURSESCHEDULE_H_ */
@@ -39,15 +39,17 @@ void Enrollment::write(std::ostream &out) const
 }
 
 Enrollment Enrollment::read(std::istream &in)
+{
+	FieldParser fields(FieldParser::readLine(in));
+	return read(fields);
+}
+
+Enrollment Enrollment::read(FieldParser &fields)
 {
 	Course *course = nullptr;
-	std::string semester;
-	float grade;
-	std::string inp;
-	std::getline(in, semester, ';');
-	std::getline(in, inp);
-	grade = std::stof(inp);
-	Enrollment eObj(course, semester);
+	std::string_view semester = fields.text();
+	float grade = fields.decimal();
+	Enrollment eObj(course, std::string(semester));
 	eObj.setGrade(grade);
 	return eObj;
 }
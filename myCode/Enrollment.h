@@ -11,6 +11,7 @@
 #include <iomanip>
 #include <string>
 #include "Course.h"
+#include "FieldParser.h"
 
 /**
  * @class Enrollment
@@ -68,6 +69,13 @@ public:
 	 */
 	static Enrollment read(std::istream &in);
 
+	/**
+	 * @brief Creates an Enrollment from the next fields of a record.
+	 * @param fields Parser positioned at the semester.
+	 * @return Enrollment object without course.
+	 */
+	static Enrollment read(FieldParser &fields);
+
 	/**
 	 * @brief Destructor for Enrollment.
 	 */
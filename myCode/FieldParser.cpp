@@ -0,0 +1,264 @@
+/**
+ * @file FieldParser.cpp
+ * @brief FieldParser class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "FieldParser.h"
+#include <charconv>
+#include <stdexcept>
+
+/**
+ * @brief Removes blanks and a trailing carriage return.
+ * @param field The text.
+ * @return The trimmed view.
+ */
+static std::string_view trim(std::string_view field)
+{
+	while (!field.empty() && (field.front() == ' ' || field.front() == '\t'))
+	{
+		field.remove_prefix(1);
+	}
+	while (!field.empty()
+			&& (field.back() == ' ' || field.back() == '\t'
+					|| field.back() == '\r'))
+	{
+		field.remove_suffix(1);
+	}
+	return field;
+}
+
+/**
+ * @brief Converts the digits up to a delimiter.
+ * @param field The text, advanced past the delimiter.
+ * @param delimiter Character that ends the number.
+ * @param value Receives the number.
+ * @return False without digits or delimiter.
+ */
+static bool takeNumber(std::string_view &field, char delimiter, int &value)
+{
+	auto result = std::from_chars(field.data(), field.data() + field.size(),
+			value);
+	if (result.ec != std::errc() || result.ptr == field.data()
+			|| result.ptr == field.data() + field.size()
+			|| *result.ptr != delimiter)
+	{
+		return false;
+	}
+	field.remove_prefix(result.ptr - field.data() + 1);
+	return true;
+}
+
+FieldParser::FieldParser(std::string_view line, char separator) :
+		rest(line), exhausted(false), separator(separator)
+{
+}
+
+std::string_view FieldParser::readLine(std::istream &in)
+{
+	thread_local std::string buffer;
+	std::getline(in, buffer);
+	return buffer;
+}
+
+bool FieldParser::next(std::string_view &field)
+{
+	if (this->exhausted)
+	{
+		return false;
+	}
+	std::size_t pos = this->rest.find(this->separator);
+	if (pos == std::string_view::npos)
+	{
+		field = this->rest;
+		this->rest = std::string_view();
+		this->exhausted = true;
+	}
+	else
+	{
+		field = this->rest.substr(0, pos);
+		this->rest.remove_prefix(pos + 1);
+	}
+	return true;
+}
+
+std::string_view FieldParser::text()
+{
+	std::string_view field;
+	if (!next(field))
+	{
+		throw std::invalid_argument("Missing field in record.");
+	}
+	return field;
+}
+
+std::string_view FieldParser::remainder()
+{
+	std::string_view field = this->exhausted ? std::string_view() : this->rest;
+	this->rest = std::string_view();
+	this->exhausted = true;
+	return field;
+}
+
+int FieldParser::integer()
+{
+	int value;
+	if (!parseInt(text(), value))
+	{
+		throw std::invalid_argument("Invalid integer in record.");
+	}
+	return value;
+}
+
+unsigned int FieldParser::unsignedInteger()
+{
+	int value;
+	if (!parseInt(text(), value) || value < 0)
+	{
+		throw std::invalid_argument("Invalid number in record.");
+	}
+	return static_cast<unsigned int>(value);
+}
+
+float FieldParser::decimal()
+{
+	float value;
+	if (!parseFloat(text(), value))
+	{
+		throw std::invalid_argument("Invalid decimal in record.");
+	}
+	return value;
+}
+
+CompactDate FieldParser::date()
+{
+	CompactDate value;
+	if (!parseDate(text(), value))
+	{
+		throw std::invalid_argument("Invalid date in record.");
+	}
+	return value;
+}
+
+CompactTime FieldParser::time()
+{
+	CompactTime value;
+	if (!parseTime(text(), value))
+	{
+		throw std::invalid_argument("Invalid time in record.");
+	}
+	return value;
+}
+
+bool FieldParser::parseInt(std::string_view field, int &value)
+{
+	field = trim(field);
+	if (!field.empty() && field.front() == '+')
+	{
+		field.remove_prefix(1);
+	}
+	auto result = std::from_chars(field.data(), field.data() + field.size(),
+			value);
+	return result.ec == std::errc() && !field.empty()
+			&& result.ptr == field.data() + field.size();
+}
+
+bool FieldParser::parseFloat(std::string_view field, float &value)
+{
+	field = trim(field);
+	bool negative = false;
+	if (!field.empty() && (field.front() == '-' || field.front() == '+'))
+	{
+		negative = field.front() == '-';
+		field.remove_prefix(1);
+	}
+
+	// Up to 18 significant digits fit the mantissa, later ones only scale.
+	unsigned long long mantissa = 0;
+	int digits = 0;
+	int exponent = 0;
+	bool fraction = false;
+	bool anyDigit = false;
+	for (char c : field)
+	{
+		if (c >= '0' && c <= '9')
+		{
+			anyDigit = true;
+			if (digits < 18)
+			{
+				mantissa = mantissa * 10 + (c - '0');
+				if (mantissa != 0)
+				{
+					++digits;
+				}
+				exponent -= fraction ? 1 : 0;
+			}
+			else
+			{
+				exponent += fraction ? 0 : 1;
+			}
+		}
+		else if (c == '.' && !fraction)
+		{
+			fraction = true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	if (!anyDigit)
+	{
+		return false;
+	}
+
+	static const double powers[] =
+	{ 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+			1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+	double result = static_cast<double>(mantissa);
+	int scale = exponent < 0 ? -exponent : exponent;
+	while (scale > 0)
+	{
+		int step = scale > 22 ? 22 : scale;
+		result = exponent < 0 ? result / powers[step] : result * powers[step];
+		scale -= step;
+	}
+	value = static_cast<float>(negative ? -result : result);
+	return true;
+}
+
+bool FieldParser::parseDate(std::string_view field, CompactDate &value)
+{
+	static const int daysInMonth[] =
+	{ 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	field = trim(field);
+	int day, month, year;
+	if (!takeNumber(field, '.', day) || !takeNumber(field, '.', month)
+			|| !parseInt(field, year) || year < CompactDate::minYear
+			|| year > CompactDate::maxYear || month < 1 || month > 12
+			|| day < 1)
+	{
+		return false;
+	}
+	bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+	if (day > daysInMonth[month - 1] + (month == 2 && leapYear ? 1 : 0))
+	{
+		return false;
+	}
+	value = CompactDate::fromYmd(year, month, day);
+	return true;
+}
+
+bool FieldParser::parseTime(std::string_view field, CompactTime &value)
+{
+	field = trim(field);
+	int hour, minute;
+	if (!takeNumber(field, ':', hour) || !parseInt(field, minute) || hour < 0
+			|| hour > 23 || minute < 0 || minute > 59)
+	{
+		return false;
+	}
+	value = CompactTime(hour, minute);
+	return true;
+}
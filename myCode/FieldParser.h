@@ -0,0 +1,148 @@
+/**
+ * @file FieldParser.h
+ * @brief FieldParser class declaration for allocation free record parsing.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef FIELDPARSER_H_
+#define FIELDPARSER_H_
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include "CompactDate.h"
+#include "CompactTime.h"
+
+/**
+ * @class FieldParser
+ * @brief Splits a record line into fields and converts them.
+ *
+ * Fields are handed out as views into the line, numbers are converted with
+ * std::from_chars, so no field needs a temporary string. The typed
+ * accessors throw std::invalid_argument for malformed or missing fields,
+ * like std::stoi does.
+ */
+class FieldParser
+{
+private:
+	std::string_view rest; ///< Unconsumed part of the line.
+	bool exhausted; ///< True once the last field was taken.
+	char separator; ///< Field separator.
+
+public:
+	/**
+	 * @brief Starts parsing a line.
+	 * @param line The record, must outlive the parser.
+	 * @param separator Field separator.
+	 */
+	explicit FieldParser(std::string_view line, char separator = ';');
+
+	/**
+	 * @brief Reads the remainder of the current line of a stream.
+	 *
+	 * The buffer is reused between calls of the same thread, so reading
+	 * many records does not allocate once it has grown to the longest line.
+	 * @param in The stream.
+	 * @return View of the line without the line break, valid until the next call.
+	 */
+	static std::string_view readLine(std::istream &in);
+
+	/**
+	 * @brief Takes the next field.
+	 * @param field Receives the field.
+	 * @return False if no field is left.
+	 */
+	bool next(std::string_view &field);
+
+	/**
+	 * @brief Takes the next field or throws.
+	 * @return The field.
+	 * @throw std::invalid_argument If no field is left.
+	 */
+	std::string_view text();
+
+	/**
+	 * @brief Takes everything left, separators included.
+	 * @return The rest of the line.
+	 */
+	std::string_view remainder();
+
+	/**
+	 * @brief Takes a decimal integer field such as "-12" or "+7", see
+	 * parseInt().
+	 * @return The number.
+	 * @throw std::invalid_argument If no field is left or it is not an int.
+	 */
+	int integer();
+
+	/**
+	 * @brief Takes a decimal integer field that must not be negative.
+	 * @return The number, at most the largest int.
+	 * @throw std::invalid_argument If no field is left or it is not a
+	 * non-negative int.
+	 */
+	unsigned int unsignedInteger();
+
+	/**
+	 * @brief Takes a decimal number field such as "-1.25" or "4", see
+	 * parseFloat().
+	 * @return The number.
+	 * @throw std::invalid_argument If no field is left or it is not a number.
+	 */
+	float decimal();
+
+	/**
+	 * @brief Takes a D.M.YYYY field.
+	 * @return The date.
+	 * @throw std::invalid_argument If no field is left or the date is
+	 * malformed or impossible.
+	 */
+	CompactDate date();
+
+	/**
+	 * @brief Takes a HH:MM field.
+	 * @return The time.
+	 * @throw std::invalid_argument If no field is left or the time is
+	 * malformed or impossible.
+	 */
+	CompactTime time();
+
+	/**
+	 * @brief Converts a decimal integer, surrounding blanks are ignored.
+	 * @param field The text.
+	 * @param value Receives the number.
+	 * @return False if the text is not a complete integer.
+	 */
+	static bool parseInt(std::string_view field, int &value);
+
+	/**
+	 * @brief Converts a decimal number such as "-1.25" or "4".
+	 *
+	 * Hand written because not every supported compiler has the floating
+	 * point std::from_chars overloads yet.
+	 * @param field The text.
+	 * @param value Receives the number.
+	 * @return False if the text is not a complete number.
+	 */
+	static bool parseFloat(std::string_view field, float &value);
+
+	/**
+	 * @brief Converts D.M.YYYY and checks the calendar.
+	 * @param field The text.
+	 * @param value Receives the date.
+	 * @return False for malformed text, impossible dates or years outside
+	 * CompactDate::minYear..maxYear.
+	 */
+	static bool parseDate(std::string_view field, CompactDate &value);
+
+	/**
+	 * @brief Converts H:MM.
+	 * @param field The text.
+	 * @param value Receives the time.
+	 * @return False for malformed text or impossible times.
+	 */
+	static bool parseTime(std::string_view field, CompactTime &value);
+};
+
+#endif /* FIELDPARSER_H_ */
@@ -0,0 +1,71 @@
+/**
+ * @file GeneratorClient.cpp
+ * @brief GeneratorClient class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "GeneratorClient.h"
+#include <algorithm>
+#include <stdexcept>
+
+const unsigned int GeneratorClient::maxWindow;
+
+GeneratorClient::GeneratorClient(const std::string &host,
+		const std::string &port)
+{
+	this->stream.connect(host, port);
+	if (!this->stream)
+	{
+		throw std::runtime_error(
+				"Cannot connect to " + host + ":" + port + ": "
+						+ this->stream.error().message());
+	}
+	boost::system::error_code ignored;
+	this->stream.socket().set_option(boost::asio::ip::tcp::no_delay(true),
+			ignored);
+}
+
+unsigned int GeneratorClient::fetch(unsigned int count, unsigned int window,
+		const std::function<void(std::string&)> &consume)
+{
+	window = std::min(std::max(window, 1u), maxWindow);
+	unsigned int sent = 0;
+	unsigned int received = 0;
+	std::string header, record, trailer;
+	while (received < count)
+	{
+		// Top up the window only before the next read would block, so the
+		// requests of a round trip leave in one write.
+		if (received == sent || this->stream.rdbuf()->in_avail() <= 0)
+		{
+			unsigned int before = sent;
+			while (sent < count && sent - received < window)
+			{
+				this->stream << "generate\n";
+				++sent;
+			}
+			if (sent != before)
+			{
+				this->stream.flush();
+			}
+		}
+		if (!std::getline(this->stream, header)
+				|| !std::getline(this->stream, record)
+				|| !std::getline(this->stream, trailer))
+		{
+			break;
+		}
+		++received;
+		consume(record);
+	}
+	return received;
+}
+
+GeneratorClient::~GeneratorClient()
+{
+	if (this->stream)
+	{
+		this->stream << "quit" << std::endl;
+	}
+}
@@ -0,0 +1,67 @@
+/**
+ * @file GeneratorClient.h
+ * @brief GeneratorClient class declaration for fetching generated students.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef GENERATORCLIENT_H_
+#define GENERATORCLIENT_H_
+
+#include <functional>
+#include <string>
+#include <boost/asio.hpp>
+
+/**
+ * @class GeneratorClient
+ * @brief Pipelined connection to a student data generator.
+ *
+ * Instead of waiting for every answer before sending the next "generate",
+ * the client keeps up to a window of requests outstanding. New requests
+ * are sent in one write whenever the client has no more buffered answers
+ * to read, so N records cost about N / window round trips.
+ */
+class GeneratorClient
+{
+private:
+	boost::asio::ip::tcp::iostream stream; ///< Connection to the generator.
+
+public:
+	/**
+	 * Upper bound of the window. The generator may stop reading while its
+	 * answers are not consumed, so the requests of a window have to fit
+	 * into the socket buffers.
+	 */
+	static const unsigned int maxWindow = 256;
+
+	/**
+	 * @brief Connects to a generator.
+	 * @param host Host name or address.
+	 * @param port Port number or service name.
+	 * @throws std::runtime_error if the connection fails.
+	 */
+	GeneratorClient(const std::string &host, const std::string &port);
+
+	GeneratorClient(const GeneratorClient&) = delete;
+	GeneratorClient& operator=(const GeneratorClient&) = delete;
+
+	/**
+	 * @brief Requests records and hands them over in order of arrival.
+	 * @param count Number of records to request.
+	 * @param window Requests kept in flight, 1 waits for every answer,
+	 * larger values are limited to maxWindow.
+	 * @param consume Called on the calling thread with the JSON line of
+	 * each record, may move from it.
+	 * @return Number of records received, less than count if the generator
+	 * closed the connection early.
+	 */
+	unsigned int fetch(unsigned int count, unsigned int window,
+			const std::function<void(std::string&)> &consume);
+
+	/**
+	 * @brief Sends "quit" and closes the connection.
+	 */
+	virtual ~GeneratorClient();
+};
+
+#endif /* GENERATORCLIENT_H_ */
@@ -0,0 +1,312 @@
+/**
+ * @file GeneratorServer.cpp
+ * @brief GeneratorServer class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "GeneratorServer.h"
+#include <deque>
+#include <string_view>
+#include <utility>
+#include "SocketChannel.h"
+
+using boost::asio::ip::tcp;
+
+/**
+ * @class GeneratorServer::Connection
+ * @brief State of one client.
+ *
+ * Answers wait in a queue ordered by their due time, one timer is armed for
+ * the earliest of them. Answers that become due together are sent with one
+ * write.
+ */
+class GeneratorServer::Connection: public std::enable_shared_from_this<
+		GeneratorServer::Connection>
+{
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	GeneratorServer &server; ///< Server owning the io_context.
+	SocketChannel channel; ///< Socket of the client.
+	boost::asio::steady_timer timer; ///< Fires when the next answer is due.
+	std::deque<std::pair<Clock::time_point, std::string>> pending; ///< Answers by due time.
+	std::mt19937 random; ///< Source of the records.
+	bool timerArmed = false; ///< Set while the timer waits.
+	bool quitting = false; ///< Set after "quit", closes once all is sent.
+
+	void read()
+	{
+		auto self = shared_from_this();
+		this->channel.read([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			std::string &input = self->channel.getInput();
+			std::size_t start = 0;
+			std::size_t end;
+			while ((end = input.find('\n', start)) != std::string::npos)
+			{
+				std::string_view line = std::string_view(input).substr(start,
+						end - start);
+				start = end + 1;
+				if (!line.empty() && line.back() == '\r')
+				{
+					line.remove_suffix(1);
+				}
+				if (line == "quit")
+				{
+					self->quitting = true;
+					self->flush();
+					return;
+				}
+				if (line == "generate")
+				{
+					self->schedule();
+				}
+			}
+			input.erase(0, start);
+			self->read();
+		});
+	}
+
+	void schedule()
+	{
+		const Settings &settings = this->server.settings;
+		std::string record = randomRecord(this->random, settings.payloadSize);
+		if (settings.malformedRate > 0
+				&& std::uniform_real_distribution<double>(0, 1)(this->random)
+						< settings.malformedRate)
+		{
+			corruptRecord(record, this->random);
+		}
+		this->pending.emplace_back(Clock::now() + settings.latency,
+				"begin\n" + record + "\nend\n");
+		this->armTimer();
+	}
+
+	void armTimer()
+	{
+		if (this->timerArmed || this->pending.empty())
+		{
+			return;
+		}
+		this->timerArmed = true;
+		this->timer.expires_at(this->pending.front().first);
+		auto self = shared_from_this();
+		this->timer.async_wait([self](const boost::system::error_code &error)
+		{
+			self->timerArmed = false;
+			if (error)
+			{
+				return;
+			}
+			Clock::time_point now = Clock::now();
+			while (!self->pending.empty() && self->pending.front().first <= now)
+			{
+				self->channel.getOutbox() += self->pending.front().second;
+				self->pending.pop_front();
+				++self->server.recordsSent;
+			}
+			self->flush();
+			self->armTimer();
+		});
+	}
+
+	void flush()
+	{
+		if (this->channel.isWriting())
+		{
+			return;
+		}
+		if (this->channel.getOutbox().empty())
+		{
+			if (this->quitting && this->pending.empty())
+			{
+				this->close();
+			}
+			return;
+		}
+		auto self = shared_from_this();
+		this->channel.write([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			self->flush();
+		});
+	}
+
+	void close()
+	{
+		this->timer.cancel();
+		this->pending.clear();
+		this->channel.close();
+	}
+
+public:
+	Connection(GeneratorServer &server, tcp::socket socket, unsigned int seed) :
+			server(server), channel(std::move(socket)), timer(
+					server.ioContext), random(seed)
+	{
+	}
+
+	/**
+	 * @brief Starts serving the client.
+	 */
+	void start()
+	{
+		boost::system::error_code ignored;
+		this->channel.getSocket().set_option(tcp::no_delay(true), ignored);
+		this->read();
+	}
+};
+
+GeneratorServer::GeneratorServer(unsigned short port,
+		const Settings &settings) :
+		acceptor(ioContext, tcp::endpoint(boost::asio::ip::address_v4::loopback(),
+				port)), settings(settings), recordsSent(0), nextSeed(port)
+{
+	this->accept();
+	this->worker = std::thread([this]
+	{
+		this->ioContext.run();
+	});
+}
+
+void GeneratorServer::accept()
+{
+	this->acceptor.async_accept(
+			[this](const boost::system::error_code &error, tcp::socket socket)
+			{
+				if (error)
+				{
+					return;
+				}
+				std::make_shared<Connection>(*this, std::move(socket),
+						this->nextSeed++)->start();
+				this->accept();
+			});
+}
+
+unsigned short GeneratorServer::getPort() const
+{
+	return this->acceptor.local_endpoint().port();
+}
+
+unsigned long long GeneratorServer::getRecordsSent() const
+{
+	return this->recordsSent;
+}
+
+std::string GeneratorServer::randomRecord(std::mt19937 &random,
+		std::size_t payloadSize)
+{
+	static const char *firstNames[] =
+	{ "Anna", "Ben", "Clara", "David", "Emma", "Felix", "Greta", "Hannes",
+			"Ida", "Jonas", "Lena", "Max", "Nora", "Paul", "Sophie", "Tim" };
+	static const char *lastNames[] =
+	{ "Becker", "Fischer", "Hoffmann", "Koch", "Meyer", "Richter", "Schmidt",
+			"Schneider", "Schulz", "Wagner", "Weber", "Wolf" };
+	static const char *streets[] =
+	{ "Hauptstrasse", "Schulstrasse", "Gartenweg", "Bahnhofstrasse",
+			"Lindenallee", "Kirchgasse" };
+	static const char *cities[] =
+	{ "Darmstadt", "Frankfurt", "Offenbach", "Wiesbaden", "Mainz", "Hanau" };
+	static const char *states[] =
+	{ "Hessen", "Rheinland-Pfalz", "Bayern" };
+
+	auto pick = [&random](const char *const*names, std::size_t count)
+	{
+		return names[std::uniform_int_distribution<std::size_t>(0, count - 1)(
+				random)];
+	};
+	std::uniform_int_distribution<int> day(1, 28);
+	std::uniform_int_distribution<int> month(0, 11);
+	std::uniform_int_distribution<int> year(85, 105);
+	std::uniform_int_distribution<int> houseNumber(1, 120);
+	std::uniform_int_distribution<int> postCode(10000, 99999);
+
+	std::string record;
+	record.reserve(256);
+	record += "{\"name\":{\"firstName\":\"";
+	record += pick(firstNames, sizeof(firstNames) / sizeof(*firstNames));
+	record += "\",\"lastName\":\"";
+	record += pick(lastNames, sizeof(lastNames) / sizeof(*lastNames));
+	record += "\"},\"dateOfBirth\":{\"date\":";
+	record += std::to_string(day(random));
+	record += ",\"month\":";
+	record += std::to_string(month(random));
+	record += ",\"year\":";
+	record += std::to_string(year(random));
+	record += "},\"location\":{\"street\":\"";
+	record += pick(streets, sizeof(streets) / sizeof(*streets));
+	record += " ";
+	record += std::to_string(houseNumber(random));
+	record += "\",\"postCode\":\"";
+	record += std::to_string(postCode(random));
+	record += "\",\"city\":\"";
+	record += pick(cities, sizeof(cities) / sizeof(*cities));
+	record += "\",\"state\":\"";
+	record += pick(states, sizeof(states) / sizeof(*states));
+	record += "\"}";
+	// The extra field is ignored by parseData, it takes 14 characters
+	// besides the padding and the closing brace.
+	if (record.size() + 15 < payloadSize)
+	{
+		record += ",\"padding\":\"";
+		record.append(payloadSize - record.size() - 2, 'x');
+		record += "\"";
+	}
+	record += "}";
+	return record;
+}
+
+void GeneratorServer::corruptRecord(std::string &record, std::mt19937 &random)
+{
+	switch (std::uniform_int_distribution<int>(0, 3)(random))
+	{
+	case 0:
+		record.resize(record.size() / 2);
+		break;
+	case 1:
+		record.replace(record.find("\"city\""), 6, "\"town\"");
+		break;
+	case 2:
+	{
+		// A digit at the start of the first name's value.
+		const std::string key = "\"firstName\":";
+		std::size_t value = record.find('"', record.find(key) + key.size());
+		record.insert(value + 1, "7");
+		break;
+	}
+	default:
+		std::size_t start = record.find("\"date\":") + 7;
+		std::size_t end = record.find(',', start);
+		record.insert(end, "\"");
+		record.insert(start, "\"");
+		break;
+	}
+}
+
+void GeneratorServer::stop()
+{
+	if (!this->worker.joinable())
+	{
+		return;
+	}
+	this->ioContext.stop();
+	this->worker.join();
+	boost::system::error_code ignored;
+	this->acceptor.close(ignored);
+}
+
+GeneratorServer::~GeneratorServer()
+{
+	this->stop();
+}
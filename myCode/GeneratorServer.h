@@ -0,0 +1,115 @@
+/**
+ * @file GeneratorServer.h
+ * @brief GeneratorServer class declaration, a local stand-in for the
+ * student data generator.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef GENERATORSERVER_H_
+#define GENERATORSERVER_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <boost/asio.hpp>
+
+/**
+ * @class GeneratorServer
+ * @brief Answers "generate" requests with random student records.
+ *
+ * Speaks the protocol of the external generator: every "generate" line is
+ * answered with a header line, the student as one JSON line and a trailer
+ * line, "quit" closes the connection. Requests are read as soon as they
+ * arrive and each answer is sent a fixed latency after its request, like
+ * over a link with that round trip time. Pipelining clients therefore see
+ * the same speedup as against a remote server. Records can be padded to a
+ * minimum size and a share of them can be broken on purpose. All
+ * connections are served by one background thread.
+ */
+class GeneratorServer
+{
+public:
+	/**
+	 * @struct Settings
+	 * @brief Behaviour of the server.
+	 */
+	struct Settings
+	{
+		std::chrono::milliseconds latency; ///< Delay between a request and its answer.
+		std::size_t payloadSize; ///< Minimum length of a record line, reached with a padding field.
+		double malformedRate; ///< Share of records that are broken, 0 to 1.
+	};
+
+private:
+	class Connection;
+
+	boost::asio::io_context ioContext; ///< Runs all sockets and timers.
+	boost::asio::ip::tcp::acceptor acceptor; ///< Listening socket.
+	Settings settings; ///< Behaviour of the server.
+	std::atomic<unsigned long long> recordsSent; ///< Counter of answered requests.
+	unsigned int nextSeed; ///< Seed of the next connection's generator.
+	std::thread worker; ///< Thread running the io_context.
+
+	/**
+	 * @brief Waits for the next client.
+	 */
+	void accept();
+
+public:
+	/**
+	 * @brief Starts listening on 127.0.0.1.
+	 * @param port TCP port, 0 picks a free one.
+	 * @param settings Latency, payload size and share of malformed records.
+	 */
+	GeneratorServer(unsigned short port, const Settings &settings);
+
+	GeneratorServer(const GeneratorServer&) = delete;
+	GeneratorServer& operator=(const GeneratorServer&) = delete;
+
+	/**
+	 * @brief Returns the port the server listens on.
+	 * @return The bound port.
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * @brief Returns the number of records sent so far.
+	 * @return Answered "generate" requests of all connections.
+	 */
+	unsigned long long getRecordsSent() const;
+
+	/**
+	 * @brief Builds one random student record.
+	 * @param random Source of randomness.
+	 * @param payloadSize Minimum length of the record.
+	 * @return The record as single line JSON, in the generator's layout.
+	 */
+	static std::string randomRecord(std::mt19937 &random,
+			std::size_t payloadSize = 0);
+
+	/**
+	 * @brief Breaks a record in one of the ways parseData has to reject.
+	 *
+	 * The record is cut off, loses a field, gets a digit in the first name
+	 * or a date of birth given as text.
+	 * @param record A record built by randomRecord().
+	 * @param random Selects the defect.
+	 */
+	static void corruptRecord(std::string &record, std::mt19937 &random);
+
+	/**
+	 * @brief Closes all connections and joins the background thread.
+	 */
+	void stop();
+
+	/**
+	 * @brief Stops the server.
+	 */
+	virtual ~GeneratorServer();
+};
+
+#endif /* GENERATORSERVER_H_ */
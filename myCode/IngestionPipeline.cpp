@@ -0,0 +1,406 @@
+/**
+ * @file IngestionPipeline.cpp
+ * @brief IngestionPipeline class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "IngestionPipeline.h"
+#include "FieldParser.h"
+#include "StudentImporter.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace
+{
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * @brief Waits a little longer the more often nothing was found.
+ * @param attempts Number of failed attempts so far, incremented.
+ */
+void backOff(unsigned int &attempts)
+{
+	if (++attempts < 64)
+	{
+		std::this_thread::yield();
+	}
+	else
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(50));
+	}
+}
+
+unsigned long long nanosecondsSince(Clock::time_point start)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			Clock::now() - start).count();
+}
+}
+
+IngestionPipeline::IngestionPipeline(StudentDb &db, Validator validator,
+		unsigned int parserThreads, unsigned int validatorThreads,
+		std::size_t queueCapacity, std::size_t batchSize) :
+		studentDb(db), validator(validator),
+		batchSize(std::max<std::size_t>(batchSize, 1)),
+		parseQueue(queueCapacity), validateQueue(queueCapacity),
+		insertQueue(queueCapacity), nextToInsert(0), startTime(0)
+{
+	for (Stage &stage : this->stages)
+	{
+		stage.items = 0;
+		stage.rejected = 0;
+		stage.busyNanoseconds = 0;
+		stage.maxQueueDepth = 0;
+		stage.running = 0;
+		stage.done = false;
+	}
+	unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+	this->stages[READ].threads = 1;
+	this->stages[PARSE].threads =
+			parserThreads > 0 ? parserThreads : std::max(cores / 2, 1u);
+	this->stages[VALIDATE].threads =
+			validatorThreads > 0 ? validatorThreads : std::max(cores / 4, 1u);
+	this->stages[INSERT].threads = 1;
+	// Every item between the reader and the inserter sits in a queue or is
+	// held by a thread, the inserter's reorder buffer has to fit them all.
+	this->reorderWindow = this->parseQueue.capacity()
+			+ this->validateQueue.capacity() + this->insertQueue.capacity()
+			+ this->stages[PARSE].threads + this->stages[VALIDATE].threads
+			+ this->batchSize;
+}
+
+void IngestionPipeline::forward(BoundedQueue<Item> &queue, StageId stage,
+		Item &item)
+{
+	queue.push(std::move(item));
+	std::size_t depth = queue.size();
+	std::size_t peak = this->stages[stage].maxQueueDepth.load(
+			std::memory_order_relaxed);
+	while (depth > peak
+			&& !this->stages[stage].maxQueueDepth.compare_exchange_weak(peak,
+					depth, std::memory_order_relaxed))
+	{
+	}
+}
+
+bool IngestionPipeline::take(BoundedQueue<Item> &queue, StageId upstream,
+		Item &item)
+{
+	unsigned int attempts = 0;
+	while (!queue.tryPop(item))
+	{
+		if (this->stages[upstream].done.load(std::memory_order_acquire))
+		{
+			// Everything upstream pushed is visible once done is.
+			return queue.tryPop(item);
+		}
+		backOff(attempts);
+	}
+	return true;
+}
+
+void IngestionPipeline::finish(StageId stage)
+{
+	if (--this->stages[stage].running == 0)
+	{
+		this->stages[stage].done.store(true, std::memory_order_release);
+	}
+}
+
+void IngestionPipeline::readLoop(const Source &source)
+{
+	Stage &stage = this->stages[READ];
+	std::size_t sequence = 0;
+	Item item;
+	Clock::time_point resumed = Clock::now();
+	source([&](std::string &line)
+	{
+		stage.busyNanoseconds += nanosecondsSince(resumed);
+		unsigned int attempts = 0;
+		while (sequence - this->nextToInsert.load(std::memory_order_acquire)
+				>= this->reorderWindow)
+		{
+			backOff(attempts);
+		}
+		item.sequence = sequence++;
+		item.line.swap(line);
+		item.valid = true;
+		++stage.items;
+		this->forward(this->parseQueue, PARSE, item);
+		resumed = Clock::now();
+	});
+}
+
+void IngestionPipeline::parseLoop(Format format)
+{
+	Stage &stage = this->stages[PARSE];
+	Item item;
+	while (this->take(this->parseQueue, READ, item))
+	{
+		Clock::time_point start = Clock::now();
+		// Nothing may leave the thread, and every sequence number has to
+		// reach the insert stage, so a throwing record is only rejected.
+		try
+		{
+			item.valid =
+					format == CSV ?
+							StudentRecord::fromCsv(item.line, item.record) :
+							StudentRecord::fromJson(item.line, item.record);
+		} catch (...)
+		{
+			item.valid = false;
+		}
+		stage.busyNanoseconds += nanosecondsSince(start);
+		++stage.items;
+		if (!item.valid)
+		{
+			++stage.rejected;
+		}
+		this->forward(this->validateQueue, VALIDATE, item);
+	}
+}
+
+void IngestionPipeline::validateLoop()
+{
+	Stage &stage = this->stages[VALIDATE];
+	Item item;
+	while (this->take(this->validateQueue, PARSE, item))
+	{
+		if (item.valid)
+		{
+			Clock::time_point start = Clock::now();
+			try
+			{
+				item.valid = this->validator(item.record);
+			} catch (...)
+			{
+				item.valid = false;
+			}
+			stage.busyNanoseconds += nanosecondsSince(start);
+			++stage.items;
+			if (!item.valid)
+			{
+				++stage.rejected;
+			}
+		}
+		this->forward(this->insertQueue, INSERT, item);
+	}
+}
+
+void IngestionPipeline::insertLoop()
+{
+	Stage &stage = this->stages[INSERT];
+	std::size_t ringSize = 1;
+	while (ringSize < this->reorderWindow)
+	{
+		ringSize <<= 1;
+	}
+	std::size_t mask = ringSize - 1;
+	std::vector<Item> ring(ringSize);
+	std::vector<char> ready(ringSize, 0);
+	std::size_t next = 0;
+	std::vector<StudentRecord> run;
+	Item item;
+	while (this->take(this->insertQueue, VALIDATE, item))
+	{
+		// Collect what is queued, then insert the run that is complete.
+		std::size_t taken = 0;
+		do
+		{
+			std::size_t slot = item.sequence & mask;
+			ring[slot] = std::move(item);
+			ready[slot] = 1;
+		} while (++taken < this->batchSize && this->insertQueue.tryPop(item));
+
+		Clock::time_point start = Clock::now();
+		run.clear();
+		while (ready[next & mask])
+		{
+			Item &entry = ring[next & mask];
+			ready[next & mask] = 0;
+			if (entry.valid)
+			{
+				run.push_back(std::move(entry.record));
+			}
+			++next;
+		}
+		if (!run.empty())
+		{
+			this->studentDb.addStudents(run);
+			stage.items += run.size();
+		}
+		stage.busyNanoseconds += nanosecondsSince(start);
+		this->nextToInsert.store(next, std::memory_order_release);
+	}
+}
+
+IngestionPipeline::Statistics IngestionPipeline::run(Format format,
+		const Source &source)
+{
+	for (Stage &stage : this->stages)
+	{
+		stage.items = 0;
+		stage.rejected = 0;
+		stage.busyNanoseconds = 0;
+		stage.maxQueueDepth = 0;
+		stage.running = stage.threads;
+		stage.done = false;
+	}
+	this->nextToInsert = 0;
+	this->startTime = Clock::now().time_since_epoch().count();
+
+	std::exception_ptr sourceError;
+	std::thread reader([this, &source, &sourceError]
+	{
+		try
+		{
+			this->readLoop(source);
+		}
+		catch (...)
+		{
+			sourceError = std::current_exception();
+		}
+		this->finish(READ);
+	});
+	std::vector<std::thread> workers;
+	for (unsigned int i = 0; i < this->stages[PARSE].threads; ++i)
+	{
+		workers.emplace_back([this, format]
+		{
+			this->parseLoop(format);
+			this->finish(PARSE);
+		});
+	}
+	for (unsigned int i = 0; i < this->stages[VALIDATE].threads; ++i)
+	{
+		workers.emplace_back([this]
+		{
+			this->validateLoop();
+			this->finish(VALIDATE);
+		});
+	}
+
+	this->insertLoop();
+	this->finish(INSERT);
+	reader.join();
+	for (std::thread &worker : workers)
+	{
+		worker.join();
+	}
+	if (sourceError)
+	{
+		std::rethrow_exception(sourceError);
+	}
+	return this->getStatistics();
+}
+
+IngestionPipeline::Statistics IngestionPipeline::getStatistics() const
+{
+	static const char *names[STAGE_COUNT] =
+	{ "read", "parse", "validate", "insert" };
+	const BoundedQueue<Item> *inputs[STAGE_COUNT] =
+	{ nullptr, &this->parseQueue, &this->validateQueue, &this->insertQueue };
+
+	Statistics result;
+	result.seconds = std::chrono::duration<double>(
+			Clock::now()
+					- Clock::time_point(Clock::duration(this->startTime.load()))).count();
+	for (int i = 0; i < STAGE_COUNT; ++i)
+	{
+		const Stage &stage = this->stages[i];
+		result.stages[i] =
+		{ names[i], stage.threads, stage.items.load(), stage.rejected.load(),
+				stage.busyNanoseconds.load() / 1e9, inputs[i] ?
+						inputs[i]->size() : 0, stage.maxQueueDepth.load() };
+	}
+	return result;
+}
+
+IngestionPipeline::Source IngestionPipeline::fromStream(std::istream &in,
+		Format format)
+{
+	if (format == JSON_LINES)
+	{
+		return [&in](const std::function<void(std::string&)> &emit)
+		{
+			std::string line;
+			while (std::getline(in, line))
+			{
+				if (!line.empty() && line.back() == '\r')
+				{
+					line.pop_back();
+				}
+				if (!line.empty())
+				{
+					emit(line);
+				}
+			}
+		};
+	}
+	return [&in](const std::function<void(std::string&)> &emit)
+	{
+		std::string line;
+		int count;
+		if (!std::getline(in, line) || !FieldParser::parseInt(line, count))
+		{
+			return;
+		}
+		// Like StudentDb::read(), a file without course lines starts with
+		// the students.
+		bool haveLine = false;
+		if (count > 0)
+		{
+			if (!std::getline(in, line))
+			{
+				return;
+			}
+			haveLine = true;
+			if (!line.empty() && (line[0] == 'W' || line[0] == 'B'))
+			{
+				for (int i = 1; i < count && std::getline(in, line); ++i)
+				{
+				}
+				haveLine = false;
+			}
+		}
+		if (!haveLine
+				&& (!std::getline(in, line) || !FieldParser::parseInt(line, count)))
+		{
+			return;
+		}
+		for (int i = 0; i < count; ++i)
+		{
+			if (!haveLine && !std::getline(in, line))
+			{
+				return;
+			}
+			haveLine = false;
+			emit(line);
+		}
+	};
+}
+
+IngestionPipeline::Source IngestionPipeline::fromGenerator(
+		const std::string &host, const std::string &port, unsigned int count,
+		unsigned int connections, unsigned int window)
+{
+	return [=](const std::function<void(std::string&)> &emit)
+	{
+		StudentImporter importer(host, port, connections, window);
+		importer.run(count, [&emit](std::vector<std::string> &records)
+		{
+			for (std::string &record : records)
+			{
+				emit(record);
+			}
+		});
+	};
+}
+
+IngestionPipeline::~IngestionPipeline()
+{
+}
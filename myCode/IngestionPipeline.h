@@ -0,0 +1,242 @@
+/**
+ * @file IngestionPipeline.h
+ * @brief IngestionPipeline class declaration for staged bulk imports of
+ * students.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef INGESTIONPIPELINE_H_
+#define INGESTIONPIPELINE_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include "BoundedQueue.h"
+#include "StudentDb.h"
+#include "StudentRecord.h"
+
+/**
+ * @class IngestionPipeline
+ * @brief Imports students through read, parse, validate and insert stages.
+ *
+ * One thread reads lines from a source, several threads parse them into
+ * StudentRecords, several threads validate the records and the calling
+ * thread inserts them into the database in batches. The stages are
+ * connected by bounded lock-free queues, so a slow stage holds back the
+ * ones before it. Records are inserted in the order the source produced
+ * them, rejected records are counted and dropped. A record whose parsing
+ * or validation throws is rejected as well, so no exception leaves a stage
+ * thread.
+ */
+class IngestionPipeline
+{
+public:
+	/**
+	 * @brief Layout of the lines of a source.
+	 */
+	enum Format
+	{
+		JSON_LINES, ///< One generator record per line.
+		CSV ///< Student lines of the database file format.
+	};
+
+	/**
+	 * @brief The stages in pipeline order.
+	 */
+	enum StageId
+	{
+		READ, PARSE, VALIDATE, INSERT, STAGE_COUNT
+	};
+
+	/**
+	 * @brief Produces the lines of an import.
+	 *
+	 * Called once on the reader thread with a function that takes each line
+	 * and may move from it.
+	 */
+	typedef std::function<void(const std::function<void(std::string&)>&)> Source;
+
+	/**
+	 * @brief Decides whether a parsed record may be inserted.
+	 *
+	 * Called concurrently from the validator threads.
+	 */
+	typedef std::function<bool(const StudentRecord&)> Validator;
+
+	/**
+	 * @struct StageStatistics
+	 * @brief Counters of one stage.
+	 */
+	struct StageStatistics
+	{
+		const char *name; ///< Name of the stage.
+		unsigned int threads; ///< Threads running the stage.
+		unsigned long long items; ///< Items the stage has finished.
+		unsigned long long rejected; ///< Items the stage has rejected.
+		double busySeconds; ///< Processing time summed over the threads.
+		std::size_t queueDepth; ///< Items waiting for the stage now.
+		std::size_t maxQueueDepth; ///< Most items seen waiting for the stage.
+	};
+
+	/**
+	 * @struct Statistics
+	 * @brief Counters of the pipeline.
+	 */
+	struct Statistics
+	{
+		double seconds; ///< Time since the run started.
+		std::array<StageStatistics, STAGE_COUNT> stages; ///< Counters per stage.
+	};
+
+private:
+	/**
+	 * @struct Item
+	 * @brief A line on its way through the stages.
+	 */
+	struct Item
+	{
+		std::size_t sequence = 0; ///< Position in the source.
+		std::string line; ///< Line as read.
+		StudentRecord record; ///< Parsed fields.
+		bool valid = false; ///< Cleared by a stage that rejects the item.
+	};
+
+	/**
+	 * @struct Stage
+	 * @brief Shared counters of a stage.
+	 */
+	struct Stage
+	{
+		unsigned int threads = 0; ///< Threads running the stage.
+		std::atomic<unsigned long long> items; ///< Finished items.
+		std::atomic<unsigned long long> rejected; ///< Rejected items.
+		std::atomic<unsigned long long> busyNanoseconds; ///< Processing time.
+		std::atomic<std::size_t> maxQueueDepth; ///< Peak depth of the input queue.
+		std::atomic<unsigned int> running; ///< Threads that have not finished.
+		std::atomic<bool> done; ///< Set when the stage produces no more items.
+	};
+
+	StudentDb &studentDb; ///< Database the records are added to.
+	Validator validator; ///< Check of the validate stage.
+	std::size_t batchSize; ///< Records inserted per batch.
+	BoundedQueue<Item> parseQueue; ///< Lines waiting for a parser.
+	BoundedQueue<Item> validateQueue; ///< Records waiting for a validator.
+	BoundedQueue<Item> insertQueue; ///< Records waiting for the inserter.
+	std::size_t reorderWindow; ///< Items that may be between reader and inserter.
+	std::array<Stage, STAGE_COUNT> stages; ///< Counters per stage.
+	std::atomic<std::size_t> nextToInsert; ///< Sequence the inserter waits for.
+	std::atomic<long long> startTime; ///< Start of the run in steady clock ticks.
+
+	/**
+	 * @brief Moves an item into the input queue of a stage.
+	 * @param queue The queue.
+	 * @param stage The stage reading the queue.
+	 * @param item The item, moved from.
+	 */
+	void forward(BoundedQueue<Item> &queue, StageId stage, Item &item);
+
+	/**
+	 * @brief Takes the next item, waiting while the previous stage runs.
+	 * @param queue Input queue of the stage.
+	 * @param upstream The stage filling the queue.
+	 * @param item Receives the item.
+	 * @return False once the queue is drained and upstream is done.
+	 */
+	bool take(BoundedQueue<Item> &queue, StageId upstream, Item &item);
+
+	/**
+	 * @brief Marks a thread of a stage as finished.
+	 * @param stage The stage.
+	 */
+	void finish(StageId stage);
+
+	/**
+	 * @brief Reader thread, numbers the lines of the source.
+	 * @param source Producer of the lines.
+	 */
+	void readLoop(const Source &source);
+
+	/**
+	 * @brief Parser thread.
+	 * @param format Layout of the lines.
+	 */
+	void parseLoop(Format format);
+
+	/**
+	 * @brief Validator thread.
+	 */
+	void validateLoop();
+
+	/**
+	 * @brief Inserter, puts the records back into source order and adds
+	 * them in batches.
+	 */
+	void insertLoop();
+
+public:
+	/**
+	 * @brief Creates a pipeline for a database.
+	 * @param db Database the records are added to. It must not be used by
+	 * other threads during run().
+	 * @param validator Check of the validate stage.
+	 * @param parserThreads Threads parsing, 0 selects half of the cores.
+	 * @param validatorThreads Threads validating, 0 selects a quarter of the
+	 * cores.
+	 * @param queueCapacity Capacity of each queue between the stages.
+	 * @param batchSize Records inserted per batch.
+	 */
+	IngestionPipeline(StudentDb &db, Validator validator,
+			unsigned int parserThreads = 0, unsigned int validatorThreads = 0,
+			std::size_t queueCapacity = 1024, std::size_t batchSize = 256);
+
+	IngestionPipeline(const IngestionPipeline&) = delete;
+	IngestionPipeline& operator=(const IngestionPipeline&) = delete;
+
+	/**
+	 * @brief Imports all lines of a source and waits for the end.
+	 * @param format Layout of the lines.
+	 * @param source Producer of the lines.
+	 * @return Counters of the run.
+	 * @throws Whatever the source throws, after the stages have stopped.
+	 */
+	Statistics run(Format format, const Source &source);
+
+	/**
+	 * @brief Returns the counters, may be called while run() is active.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Creates a source reading a stream.
+	 *
+	 * For CSV, the courses section is skipped and the student section is
+	 * read, the enrollments are ignored.
+	 * @param in The stream, must outlive the run.
+	 * @param format Layout of the stream.
+	 * @return The source.
+	 */
+	static Source fromStream(std::istream &in, Format format);
+
+	/**
+	 * @brief Creates a source fetching records from a generator with a
+	 * StudentImporter.
+	 * @param host Host of the generator.
+	 * @param port Port of the generator.
+	 * @param count Number of records.
+	 * @param connections Number of connections.
+	 * @param window Requests in flight per connection.
+	 * @return The source, in JSON_LINES format.
+	 */
+	static Source fromGenerator(const std::string &host,
+			const std::string &port, unsigned int count,
+			unsigned int connections, unsigned int window);
+
+	virtual ~IngestionPipeline();
+};
+
+#endif /* INGESTIONPIPELINE_H_ */
@@ -0,0 +1,246 @@
+/**
+ * @file IntervalTree.h
+ * @brief IntervalTree class template for overlap queries.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef INTERVALTREE_H_
+#define INTERVALTREE_H_
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+/**
+ * @class IntervalTree
+ * @brief Half open intervals [low, high) with attached values.
+ *
+ * A treap ordered by the lower bound, every node also stores the largest
+ * upper bound of its subtree. Insert and remove cost O(log n), finding the
+ * k intervals overlapping a query costs O(log n + k), both expected.
+ * @tparam Value Attached value, compared with == on removal.
+ */
+template<typename Value>
+class IntervalTree
+{
+private:
+	/**
+	 * @struct Node
+	 * @brief One interval.
+	 */
+	struct Node
+	{
+		int low; ///< Lower bound, inclusive.
+		int high; ///< Upper bound, exclusive.
+		Value value; ///< Attached value.
+		unsigned int priority; ///< Random heap priority.
+		int maxHigh; ///< Largest upper bound in this subtree.
+		std::unique_ptr<Node> left; ///< Intervals starting earlier or equal.
+		std::unique_ptr<Node> right; ///< Intervals starting later or equal.
+	};
+
+	std::unique_ptr<Node> root; ///< Root of the treap.
+	std::size_t count = 0; ///< Number of intervals.
+	std::minstd_rand random; ///< Source of the priorities.
+
+	static void update(Node *node)
+	{
+		node->maxHigh = node->high;
+		if (node->left)
+		{
+			node->maxHigh = std::max(node->maxHigh, node->left->maxHigh);
+		}
+		if (node->right)
+		{
+			node->maxHigh = std::max(node->maxHigh, node->right->maxHigh);
+		}
+	}
+
+	static void rotateRight(std::unique_ptr<Node> &node)
+	{
+		std::unique_ptr<Node> pivot = std::move(node->left);
+		node->left = std::move(pivot->right);
+		update(node.get());
+		pivot->right = std::move(node);
+		node = std::move(pivot);
+		update(node.get());
+	}
+
+	static void rotateLeft(std::unique_ptr<Node> &node)
+	{
+		std::unique_ptr<Node> pivot = std::move(node->right);
+		node->right = std::move(pivot->left);
+		update(node.get());
+		pivot->left = std::move(node);
+		node = std::move(pivot);
+		update(node.get());
+	}
+
+	static void insert(std::unique_ptr<Node> &node,
+			std::unique_ptr<Node> &&entry)
+	{
+		if (!node)
+		{
+			node = std::move(entry);
+			return;
+		}
+		if (entry->low < node->low)
+		{
+			insert(node->left, std::move(entry));
+			if (node->left->priority > node->priority)
+			{
+				rotateRight(node);
+				return;
+			}
+		}
+		else
+		{
+			insert(node->right, std::move(entry));
+			if (node->right->priority > node->priority)
+			{
+				rotateLeft(node);
+				return;
+			}
+		}
+		update(node.get());
+	}
+
+	static std::unique_ptr<Node> merge(std::unique_ptr<Node> &&first,
+			std::unique_ptr<Node> &&second)
+	{
+		if (!first)
+		{
+			return std::move(second);
+		}
+		if (!second)
+		{
+			return std::move(first);
+		}
+		if (first->priority > second->priority)
+		{
+			first->right = merge(std::move(first->right), std::move(second));
+			update(first.get());
+			return std::move(first);
+		}
+		second->left = merge(std::move(first), std::move(second->left));
+		update(second.get());
+		return std::move(second);
+	}
+
+	static bool remove(std::unique_ptr<Node> &node, int low, int high,
+			const Value &value)
+	{
+		if (!node)
+		{
+			return false;
+		}
+		bool removed;
+		if (node->low == low && node->high == high && node->value == value)
+		{
+			node = merge(std::move(node->left), std::move(node->right));
+			return true;
+		}
+		if (low < node->low)
+		{
+			removed = remove(node->left, low, high, value);
+		}
+		else if (low > node->low)
+		{
+			removed = remove(node->right, low, high, value);
+		}
+		else
+		{
+			// Rotations may move equal lower bounds to either side.
+			removed = remove(node->left, low, high, value)
+					|| remove(node->right, low, high, value);
+		}
+		if (removed)
+		{
+			update(node.get());
+		}
+		return removed;
+	}
+
+	static void overlapping(const Node *node, int low, int high,
+			std::vector<Value> &result)
+	{
+		if (node == nullptr || node->maxHigh <= low)
+		{
+			return;
+		}
+		overlapping(node->left.get(), low, high, result);
+		if (node->low < high)
+		{
+			if (node->high > low)
+			{
+				result.push_back(node->value);
+			}
+			overlapping(node->right.get(), low, high, result);
+		}
+	}
+
+public:
+	/**
+	 * @brief Adds an interval.
+	 * @param low Lower bound, inclusive.
+	 * @param high Upper bound, exclusive.
+	 * @param value Attached value.
+	 */
+	void insert(int low, int high, const Value &value)
+	{
+		std::unique_ptr<Node> entry(new Node
+		{ low, high, value, static_cast<unsigned int>(this->random()), high,
+				nullptr, nullptr });
+		insert(this->root, std::move(entry));
+		++this->count;
+	}
+
+	/**
+	 * @brief Removes one interval.
+	 * @param low Lower bound it was inserted with.
+	 * @param high Upper bound it was inserted with.
+	 * @param value Value it was inserted with.
+	 * @return False if no such interval exists.
+	 */
+	bool remove(int low, int high, const Value &value)
+	{
+		if (!remove(this->root, low, high, value))
+		{
+			return false;
+		}
+		--this->count;
+		return true;
+	}
+
+	/**
+	 * @brief Finds the intervals overlapping [low, high).
+	 * @param low Lower bound, inclusive.
+	 * @param high Upper bound, exclusive.
+	 * @return Values of the overlapping intervals in lower bound order.
+	 */
+	std::vector<Value> overlapping(int low, int high) const
+	{
+		std::vector<Value> result;
+		overlapping(this->root.get(), low, high, result);
+		return result;
+	}
+
+	std::size_t size() const
+	{
+		return this->count;
+	}
+
+	/**
+	 * @brief Removes all intervals.
+	 */
+	void clear()
+	{
+		this->root.reset();
+		this->count = 0;
+	}
+};
+
+#endif /* INTERVALTREE_H_ */
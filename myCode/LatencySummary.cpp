@@ -0,0 +1,30 @@
+/**
+ * @file LatencySummary.cpp
+ * @brief LatencySummary struct implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "LatencySummary.h"
+#include <algorithm>
+
+LatencySummary LatencySummary::of(std::vector<float> &latencies)
+{
+	LatencySummary summary =
+	{ 0, 0, 0, 0 };
+	if (latencies.empty())
+	{
+		return summary;
+	}
+	std::sort(latencies.begin(), latencies.end());
+	auto percentile = [&latencies](double share)
+	{
+		return latencies[static_cast<std::size_t>(share
+				* (latencies.size() - 1))];
+	};
+	summary.p50 = percentile(0.5);
+	summary.p90 = percentile(0.9);
+	summary.p99 = percentile(0.99);
+	summary.max = latencies.back();
+	return summary;
+}
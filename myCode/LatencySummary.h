@@ -0,0 +1,36 @@
+/**
+ * @file LatencySummary.h
+ * @brief LatencySummary struct declaration for the latency percentiles of
+ * a benchmark run.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef LATENCYSUMMARY_H_
+#define LATENCYSUMMARY_H_
+
+#include <vector>
+
+/**
+ * @struct LatencySummary
+ * @brief Percentiles of the request latencies measured by a benchmark.
+ */
+struct LatencySummary
+{
+	double p50; ///< Median latency in ms.
+	double p90; ///< 90th percentile of the latency in ms.
+	double p99; ///< 99th percentile of the latency in ms.
+	double max; ///< Largest latency in ms.
+
+	/**
+	 * @brief Summarizes the latencies of a run.
+	 *
+	 * A percentile is the latency at that share of the sorted latencies,
+	 * rounded down to the nearest rank.
+	 * @param latencies Latencies in ms, sorted in place.
+	 * @return The percentiles, all zero if there is no latency.
+	 */
+	static LatencySummary of(std::vector<float> &latencies);
+};
+
+#endif /* LATENCYSUMMARY_H_ */
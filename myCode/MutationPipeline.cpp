@@ -0,0 +1,207 @@
+/**
+ * @file MutationPipeline.cpp
+ * @brief MutationPipeline class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "MutationPipeline.h"
+
+MutationPipeline::MutationPipeline(StudentDb &db, std::size_t capacity,
+		std::size_t maxBatchSize) :
+		studentDb(db), queue(capacity), maxBatchSize(
+				maxBatchSize > 0 ? maxBatchSize : 1), writerSleeping(false), stopping(
+				false), commandsApplied(0), batchesApplied(0), largestBatch(0)
+{
+	this->writer = std::thread(&MutationPipeline::writerLoop, this);
+}
+
+void MutationPipeline::writerLoop()
+{
+	std::vector<Command> batch;
+	batch.reserve(this->maxBatchSize);
+	Command command;
+	while (true)
+	{
+		while (batch.size() < this->maxBatchSize && this->queue.tryPop(command))
+		{
+			batch.push_back(std::move(command));
+		}
+
+		if (batch.empty())
+		{
+			if (this->stopping)
+			{
+				break;
+			}
+			std::unique_lock<std::mutex> lock(this->sleepMutex);
+			this->writerSleeping = true;
+			this->wakeUp.wait_for(lock, std::chrono::milliseconds(1), [this]
+			{	return this->queue.size() > 0 || this->stopping;});
+			this->writerSleeping = false;
+			continue;
+		}
+
+		{
+			std::unique_lock<std::shared_timed_mutex> lock(this->dbMutex);
+			for (auto &queued : batch)
+			{
+				queued(this->studentDb);
+			}
+			// Counted under the lock, so a query() after a flush() sees the
+			// batch that completed it.
+			this->commandsApplied += batch.size();
+			++this->batchesApplied;
+			if (batch.size() > this->largestBatch)
+			{
+				this->largestBatch = batch.size();
+			}
+		}
+		batch.clear();
+	}
+}
+
+void MutationPipeline::execute(Command command)
+{
+	this->queue.push(std::move(command));
+	if (this->writerSleeping)
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+		this->wakeUp.notify_one();
+	}
+}
+
+std::future<unsigned int> MutationPipeline::addStudent(const std::string fName,
+		const std::string lName, const Poco::DateTime dob,
+		const std::string street, unsigned short postalCode,
+		const std::string city, const std::string additionalInfo)
+{
+	return submit<unsigned int>([=](StudentDb &db)
+	{
+		return db.addStudent(fName, lName, dob, street, postalCode, city,
+				additionalInfo);
+	});
+}
+
+std::future<bool> MutationPipeline::addEnrollment(unsigned int matrikelNumber,
+		unsigned int courseKey, const std::string semester)
+{
+	return submit<bool>([=](StudentDb &db)
+	{
+		if (!db.matrikelNumberExists(matrikelNumber)
+				|| !db.courseExists(courseKey)
+				|| db.enrollmentExists(matrikelNumber, courseKey))
+		{
+			return false;
+		}
+		db.addEnrollment(matrikelNumber, courseKey, semester);
+		return true;
+	});
+}
+
+std::future<bool> MutationPipeline::updateName(unsigned int matrikelNumber,
+		const std::string fName, const std::string lName)
+{
+	return submit<bool>([=](StudentDb &db)
+	{
+		if (!db.matrikelNumberExists(matrikelNumber))
+		{
+			return false;
+		}
+		db.updateName(matrikelNumber, fName, lName);
+		return true;
+	});
+}
+
+std::future<bool> MutationPipeline::updateDOB(unsigned int matrikelNumber,
+		const Poco::DateTime dob)
+{
+	return submit<bool>([=](StudentDb &db)
+	{
+		if (!db.matrikelNumberExists(matrikelNumber))
+		{
+			return false;
+		}
+		db.updateDOB(matrikelNumber, dob);
+		return true;
+	});
+}
+
+std::future<bool> MutationPipeline::updateAddress(unsigned int matrikelNumber,
+		const std::string street, unsigned short postalCode,
+		const std::string city, const std::string additionalInfo)
+{
+	return submit<bool>([=](StudentDb &db)
+	{
+		if (!db.matrikelNumberExists(matrikelNumber))
+		{
+			return false;
+		}
+		db.updateAddress(matrikelNumber, street, postalCode, city,
+				additionalInfo);
+		return true;
+	});
+}
+
+std::future<bool> MutationPipeline::updateGrade(unsigned int matrikelNumber,
+		unsigned int courseKey, float grade)
+{
+	return submit<bool>([=](StudentDb &db)
+	{
+		if (!db.enrollmentExists(matrikelNumber, courseKey))
+		{
+			return false;
+		}
+		db.updateGrade(matrikelNumber, courseKey, grade);
+		return true;
+	});
+}
+
+std::future<bool> MutationPipeline::deleteEnrollment(
+		unsigned int matrikelNumber, unsigned int courseKey)
+{
+	return submit<bool>([=](StudentDb &db)
+	{
+		if (!db.enrollmentExists(matrikelNumber, courseKey))
+		{
+			return false;
+		}
+		db.deleteEnrollment(matrikelNumber, courseKey);
+		return true;
+	});
+}
+
+std::future<bool> MutationPipeline::flush()
+{
+	return submit<bool>([](StudentDb&)
+	{
+		return true;
+	});
+}
+
+void MutationPipeline::query(
+		const std::function<void(const StudentDb&)> &reader)
+{
+	std::shared_lock<std::shared_timed_mutex> lock(this->dbMutex);
+	reader(this->studentDb);
+}
+
+MutationPipeline::Statistics MutationPipeline::getStatistics() const
+{
+	Statistics stats;
+	stats.commandsApplied = this->commandsApplied;
+	stats.batchesApplied = this->batchesApplied;
+	stats.largestBatch = this->largestBatch;
+	stats.queueDepth = this->queue.size();
+	return stats;
+}
+
+MutationPipeline::~MutationPipeline()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+		this->stopping = true;
+	}
+	this->wakeUp.notify_one();
+	this->writer.join();
+}
@@ -0,0 +1,200 @@
+/**
+ * @file MutationPipeline.h
+ * @brief MutationPipeline class declaration for single-writer mutation ingestion.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef MUTATIONPIPELINE_H_
+#define MUTATIONPIPELINE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BoundedQueue.h"
+#include "StudentDb.h"
+
+/**
+ * @class MutationPipeline
+ * @brief Applies StudentDb mutations from many producers on one writer thread.
+ *
+ * Producers submit mutations as commands into a bounded lock-free queue and
+ * get a future for each result. A single writer thread drains the queue in
+ * batches and applies every batch under one exclusive lock, so mutations
+ * never contend with each other. Readers use query() to access the database
+ * between batches.
+ */
+class MutationPipeline
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Counters of the writer thread.
+	 */
+	struct Statistics
+	{
+		unsigned long long commandsApplied; ///< Commands executed so far.
+		unsigned long long batchesApplied; ///< Batches executed so far.
+		std::size_t largestBatch; ///< Biggest batch seen so far.
+		std::size_t queueDepth; ///< Commands currently waiting.
+	};
+
+	/**
+	 * @brief A queued mutation, applied by the writer thread.
+	 */
+	typedef std::function<void(StudentDb&)> Command;
+
+private:
+	StudentDb &studentDb; ///< Database owned by the writer thread.
+	BoundedQueue<Command> queue; ///< Commands waiting for the writer.
+	std::size_t maxBatchSize; ///< Upper bound of commands applied per lock.
+	std::shared_timed_mutex dbMutex; ///< Held exclusively while a batch is applied.
+	std::mutex sleepMutex; ///< Mutex for the idle condition variable.
+	std::condition_variable wakeUp; ///< Wakes the idle writer.
+	std::atomic<bool> writerSleeping; ///< Set while the writer waits for work.
+	std::atomic<bool> stopping; ///< Set when the pipeline shuts down.
+	std::atomic<unsigned long long> commandsApplied; ///< Counter of commands.
+	std::atomic<unsigned long long> batchesApplied; ///< Counter of batches.
+	std::atomic<std::size_t> largestBatch; ///< Biggest batch so far.
+	std::thread writer; ///< The single writer thread.
+
+	/**
+	 * @brief Wraps an operation into a command and queues it.
+	 * @tparam T Result type of the operation.
+	 * @param operation Mutation executed by the writer thread.
+	 * @return Future receiving the result or the thrown exception.
+	 */
+	template<typename T>
+	std::future<T> submit(std::function<T(StudentDb&)> operation)
+	{
+		auto promise = std::make_shared<std::promise<T>>();
+		std::future<T> result = promise->get_future();
+		this->execute([promise, operation](StudentDb &db)
+		{
+			try
+			{
+				promise->set_value(operation(db));
+			}
+			catch (...)
+			{
+				promise->set_exception(std::current_exception());
+			}
+		});
+		return result;
+	}
+
+	/**
+	 * @brief Main loop of the writer thread.
+	 */
+	void writerLoop();
+
+public:
+	/**
+	 * @brief Starts the writer thread for a database.
+	 *
+	 * While the pipeline exists, all access to the database has to go through
+	 * the pipeline's mutations and query().
+	 * @param db The database to mutate.
+	 * @param capacity Number of commands that may wait in the queue.
+	 * @param maxBatchSize Maximum number of commands applied per batch.
+	 */
+	MutationPipeline(StudentDb &db, std::size_t capacity = 4096,
+			std::size_t maxBatchSize = 256);
+
+	MutationPipeline(const MutationPipeline&) = delete;
+	MutationPipeline& operator=(const MutationPipeline&) = delete;
+
+	/**
+	 * @brief Queues a command without a future.
+	 *
+	 * For callers that must not block, such as network handlers: the
+	 * command reports its outcome itself. It runs on the writer thread with
+	 * the database locked exclusively, so it should only hand results on.
+	 * @param command The mutation, must not throw.
+	 */
+	void execute(Command command);
+
+	/**
+	 * @brief Queues StudentDb::addStudent.
+	 * @return Future of the assigned matrikel number.
+	 */
+	std::future<unsigned int> addStudent(const std::string fName,
+			const std::string lName, const Poco::DateTime dob,
+			const std::string street, unsigned short postalCode,
+			const std::string city, const std::string additionalInfo);
+
+	/**
+	 * @brief Queues StudentDb::addEnrollment.
+	 * @return Future that is false if the student or course is unknown or
+	 * the enrollment already exists.
+	 */
+	std::future<bool> addEnrollment(unsigned int matrikelNumber,
+			unsigned int courseKey, const std::string semester);
+
+	/**
+	 * @brief Queues StudentDb::updateName.
+	 * @return Future that is false if the student is unknown.
+	 */
+	std::future<bool> updateName(unsigned int matrikelNumber,
+			const std::string fName, const std::string lName);
+
+	/**
+	 * @brief Queues StudentDb::updateDOB.
+	 * @return Future that is false if the student is unknown.
+	 */
+	std::future<bool> updateDOB(unsigned int matrikelNumber,
+			const Poco::DateTime dob);
+
+	/**
+	 * @brief Queues StudentDb::updateAddress.
+	 * @return Future that is false if the student is unknown.
+	 */
+	std::future<bool> updateAddress(unsigned int matrikelNumber,
+			const std::string street, unsigned short postalCode,
+			const std::string city, const std::string additionalInfo);
+
+	/**
+	 * @brief Queues StudentDb::updateGrade.
+	 * @return Future that is false if the enrollment does not exist.
+	 */
+	std::future<bool> updateGrade(unsigned int matrikelNumber,
+			unsigned int courseKey, float grade);
+
+	/**
+	 * @brief Queues StudentDb::deleteEnrollment.
+	 * @return Future that is false if the enrollment does not exist.
+	 */
+	std::future<bool> deleteEnrollment(unsigned int matrikelNumber,
+			unsigned int courseKey);
+
+	/**
+	 * @brief Queues a marker behind all previously submitted commands.
+	 * @return Future that becomes ready once those commands are applied.
+	 */
+	std::future<bool> flush();
+
+	/**
+	 * @brief Runs a read-only function on the database between batches.
+	 * @param reader Function receiving the database.
+	 */
+	void query(const std::function<void(const StudentDb&)> &reader);
+
+	/**
+	 * @brief Returns the counters of the writer thread.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Applies all queued commands and stops the writer thread.
+	 */
+	virtual ~MutationPipeline();
+};
+
+#endif /* MUTATIONPIPELINE_H_ */
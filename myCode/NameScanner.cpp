@@ -0,0 +1,270 @@
+/**
+ * @file NameScanner.cpp
+ * @brief NameScanner class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "NameScanner.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NAMESCANNER_X86 1
+#include <immintrin.h>
+#endif
+
+static std::size_t findScalar(const char *haystack, std::size_t size,
+		const char *needle, std::size_t needleSize)
+{
+	if (needleSize > size)
+	{
+		return size;
+	}
+	const char *last = haystack + size - needleSize;
+	for (const char *pos = haystack; pos <= last; ++pos)
+	{
+		pos = static_cast<const char*>(std::memchr(pos, needle[0],
+				last - pos + 1));
+		if (pos == nullptr)
+		{
+			break;
+		}
+		if (std::memcmp(pos + 1, needle + 1, needleSize - 1) == 0)
+		{
+			return pos - haystack;
+		}
+	}
+	return size;
+}
+
+#ifdef NAMESCANNER_X86
+static std::size_t findSse2(const char *haystack, std::size_t size,
+		const char *needle, std::size_t needleSize)
+{
+	const __m128i first = _mm_set1_epi8(needle[0]);
+	const __m128i last = _mm_set1_epi8(needle[needleSize - 1]);
+	std::size_t i = 0;
+	for (; i + needleSize - 1 + 16 <= size; i += 16)
+	{
+		__m128i blockFirst = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(haystack + i));
+		__m128i blockLast = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(haystack + i + needleSize - 1));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+				_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+						_mm_cmpeq_epi8(last, blockLast))));
+		while (mask != 0)
+		{
+			unsigned int bit = __builtin_ctz(mask);
+			if (std::memcmp(haystack + i + bit + 1, needle + 1, needleSize - 2)
+					== 0)
+			{
+				return i + bit;
+			}
+			mask &= mask - 1;
+		}
+	}
+	std::size_t rest = findScalar(haystack + i, size - i, needle, needleSize);
+	return rest == size - i ? size : i + rest;
+}
+
+__attribute__((target("avx2")))
+static std::size_t findAvx2(const char *haystack, std::size_t size,
+		const char *needle, std::size_t needleSize)
+{
+	const __m256i first = _mm256_set1_epi8(needle[0]);
+	const __m256i last = _mm256_set1_epi8(needle[needleSize - 1]);
+	std::size_t i = 0;
+	for (; i + needleSize - 1 + 32 <= size; i += 32)
+	{
+		__m256i blockFirst = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>(haystack + i));
+		__m256i blockLast = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>(haystack + i + needleSize - 1));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(
+				_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst),
+						_mm256_cmpeq_epi8(last, blockLast))));
+		while (mask != 0)
+		{
+			unsigned int bit = __builtin_ctz(mask);
+			if (std::memcmp(haystack + i + bit + 1, needle + 1, needleSize - 2)
+					== 0)
+			{
+				return i + bit;
+			}
+			mask &= mask - 1;
+		}
+	}
+	std::size_t rest = findScalar(haystack + i, size - i, needle, needleSize);
+	return rest == size - i ? size : i + rest;
+}
+#endif
+
+NameScanner::NameScanner() :
+		removedRecords(0)
+{
+}
+
+std::string NameScanner::foldCase(const std::string &str)
+{
+	std::string folded(str);
+	for (char &c : folded)
+	{
+		if (c >= 'A' && c <= 'Z')
+		{
+			c = static_cast<char>(c - 'A' + 'a');
+		}
+	}
+	return folded;
+}
+
+std::size_t NameScanner::find(const char *haystack, std::size_t size,
+		const char *needle, std::size_t needleSize)
+{
+	if (needleSize == 0)
+	{
+		return 0;
+	}
+	if (needleSize == 1)
+	{
+		const void *pos = std::memchr(haystack, needle[0], size);
+		return pos == nullptr ? size : static_cast<const char*>(pos) - haystack;
+	}
+#ifdef NAMESCANNER_X86
+	static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+	if (hasAvx2)
+	{
+		return findAvx2(haystack, size, needle, needleSize);
+	}
+	return findSse2(haystack, size, needle, needleSize);
+#else
+	return findScalar(haystack, size, needle, needleSize);
+#endif
+}
+
+void NameScanner::insert(unsigned int matrikelNumber, const std::string &name)
+{
+	remove(matrikelNumber);
+	this->recordOf[matrikelNumber] = this->recordStarts.size();
+	this->recordStarts.push_back(this->text.size());
+	this->recordOwners.push_back(matrikelNumber);
+	this->text += foldCase(name);
+	this->text += '\n';
+}
+
+void NameScanner::remove(unsigned int matrikelNumber)
+{
+	auto it = this->recordOf.find(matrikelNumber);
+	if (it == this->recordOf.end())
+	{
+		return;
+	}
+	this->recordOwners[it->second] = 0;
+	this->recordOf.erase(it);
+	++this->removedRecords;
+	if (this->removedRecords * 2 > this->recordOwners.size())
+	{
+		compact();
+	}
+}
+
+void NameScanner::compact()
+{
+	std::string compacted;
+	std::vector<std::size_t> starts;
+	std::vector<unsigned int> owners;
+	compacted.reserve(this->text.size());
+	for (std::size_t i = 0; i < this->recordOwners.size(); ++i)
+	{
+		if (this->recordOwners[i] == 0)
+		{
+			continue;
+		}
+		std::size_t begin = this->recordStarts[i];
+		std::size_t end =
+				i + 1 < this->recordStarts.size() ?
+						this->recordStarts[i + 1] : this->text.size();
+		this->recordOf[this->recordOwners[i]] = starts.size();
+		starts.push_back(compacted.size());
+		owners.push_back(this->recordOwners[i]);
+		compacted.append(this->text, begin, end - begin);
+	}
+	this->text.swap(compacted);
+	this->recordStarts.swap(starts);
+	this->recordOwners.swap(owners);
+	this->removedRecords = 0;
+}
+
+void NameScanner::scanRecords(std::size_t firstRecord, std::size_t lastRecord,
+		const std::string &needle, std::vector<unsigned int> &matches) const
+{
+	std::size_t pos = this->recordStarts[firstRecord];
+	std::size_t end =
+			lastRecord < this->recordStarts.size() ?
+					this->recordStarts[lastRecord] : this->text.size();
+	auto startsBegin = this->recordStarts.begin() + firstRecord;
+	auto startsEnd = this->recordStarts.begin() + lastRecord;
+	while (pos < end)
+	{
+		std::size_t offset = find(this->text.data() + pos, end - pos,
+				needle.data(), needle.size());
+		if (offset == end - pos)
+		{
+			break;
+		}
+		std::size_t record = (std::upper_bound(startsBegin, startsEnd,
+				pos + offset) - this->recordStarts.begin()) - 1;
+		if (this->recordOwners[record] != 0)
+		{
+			matches.push_back(this->recordOwners[record]);
+		}
+		pos = record + 1 < this->recordStarts.size() ?
+				this->recordStarts[record + 1] : this->text.size();
+	}
+}
+
+std::vector<unsigned int> NameScanner::search(const std::string &query,
+		TaskScheduler *scheduler) const
+{
+	std::vector<unsigned int> result;
+	std::size_t recordCount = this->recordStarts.size();
+	if (recordCount == 0 || query.find('\n') != std::string::npos)
+	{
+		return result;
+	}
+	std::string needle = foldCase(query);
+
+	const std::size_t minGrain = 4096;
+	if (scheduler == nullptr || recordCount <= minGrain)
+	{
+		scanRecords(0, recordCount, needle, result);
+	}
+	else
+	{
+		std::size_t grain = std::max(minGrain,
+				scheduler->defaultGrainSize(recordCount));
+		std::vector<std::vector<unsigned int>> chunkMatches(
+				(recordCount + grain - 1) / grain);
+		scheduler->parallelFor(0, recordCount, grain,
+				[&](std::size_t begin, std::size_t end)
+				{
+					scanRecords(begin, end, needle, chunkMatches[begin / grain]);
+				});
+		for (const auto &matches : chunkMatches)
+		{
+			result.insert(result.end(), matches.begin(), matches.end());
+		}
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+void NameScanner::clear()
+{
+	this->text.clear();
+	this->recordStarts.clear();
+	this->recordOwners.clear();
+	this->recordOf.clear();
+	this->removedRecords = 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file NameScanner.h
+ * @brief NameScanner class declaration for case-insensitive substring scans.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef NAMESCANNER_H_
+#define NAMESCANNER_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "TaskScheduler.h"
+
+/**
+ * @class NameScanner
+ * @brief Brute force substring search over names stored in one buffer.
+ *
+ * All names are kept case folded (ASCII) and newline terminated in a single
+ * contiguous string. A search compares the first and last needle byte at
+ * 16 (SSE2) or 32 (AVX2) positions at once and only verifies the positions
+ * where both match. AVX2 is selected at runtime when the CPU supports it,
+ * other targets use a scalar loop.
+ */
+class NameScanner
+{
+private:
+	std::string text; ///< Folded names, each terminated by '\n'.
+	std::vector<std::size_t> recordStarts; ///< Offset of every record in text.
+	std::vector<unsigned int> recordOwners; ///< Matrikel number per record, 0 if removed.
+	std::unordered_map<unsigned int, std::size_t> recordOf; ///< Record index per matrikel number.
+	std::size_t removedRecords; ///< Number of records with owner 0.
+
+	/**
+	 * @brief Drops removed records from the buffer.
+	 */
+	void compact();
+
+	/**
+	 * @brief Scans a record range for a folded needle.
+	 * @param firstRecord First record to scan.
+	 * @param lastRecord One past the last record to scan.
+	 * @param needle Case folded query.
+	 * @param matches Receives the owners of matching records.
+	 */
+	void scanRecords(std::size_t firstRecord, std::size_t lastRecord,
+			const std::string &needle, std::vector<unsigned int> &matches) const;
+
+public:
+	/**
+	 * @brief Creates an empty scanner.
+	 */
+	NameScanner();
+
+	/**
+	 * @brief ASCII lower case folding as used for stored names and queries.
+	 * @param str Text to fold.
+	 * @return Folded copy.
+	 */
+	static std::string foldCase(const std::string &str);
+
+	/**
+	 * @brief Finds the first occurrence of a needle in a byte range.
+	 * @param haystack Start of the range.
+	 * @param size Length of the range.
+	 * @param needle Bytes to look for.
+	 * @param needleSize Length of the needle.
+	 * @return Offset of the first match or size if there is none.
+	 */
+	static std::size_t find(const char *haystack, std::size_t size,
+			const char *needle, std::size_t needleSize);
+
+	/**
+	 * @brief Adds or replaces the name of a student.
+	 * @param matrikelNumber Student identifier.
+	 * @param name Text to scan, typically "first last".
+	 */
+	void insert(unsigned int matrikelNumber, const std::string &name);
+
+	/**
+	 * @brief Removes a student from the scanner.
+	 * @param matrikelNumber Student identifier.
+	 */
+	void remove(unsigned int matrikelNumber);
+
+	/**
+	 * @brief Finds all students whose name contains a string, ignoring case.
+	 * @param query The substring to look for.
+	 * @param scheduler Worker pool to fan the scan out, nullptr for a single thread.
+	 * @return Matching matrikel numbers in ascending order.
+	 */
+	std::vector<unsigned int> search(const std::string &query,
+			TaskScheduler *scheduler) const;
+
+	/**
+	 * @brief Removes all names.
+	 */
+	void clear();
+};
+
+#endif /* NAMESCANNER_H_ */
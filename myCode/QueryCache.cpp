@@ -0,0 +1,96 @@
+/**
+ * @file QueryCache.cpp
+ * @brief QueryCache class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "QueryCache.h"
+#include <algorithm>
+
+QueryCache::QueryCache(std::size_t capacity) :
+		capacity(capacity > 0 ? capacity : 1), stats(
+		{ 0, 0, 0, 0, 0 })
+{
+}
+
+bool QueryCache::lookup(const StudentDb &db, const std::string &key,
+		const std::function<bool(const Student&)> &matches, std::string &text)
+{
+	auto it = this->entries.find(key);
+	if (it == this->entries.end())
+	{
+		++this->stats.misses;
+		return false;
+	}
+
+	Entry &entry = it->second;
+	if (entry.version != db.getVersion())
+	{
+		std::vector<unsigned int> changed;
+		bool valid = db.getChangedStudents(entry.version, changed);
+		for (std::size_t i = 0; valid && i < changed.size(); ++i)
+		{
+			unsigned int matrikelNumber = changed[i];
+			if (std::binary_search(entry.matrikelNumbers.begin(),
+					entry.matrikelNumbers.end(), matrikelNumber)
+					|| (db.matrikelNumberExists(matrikelNumber)
+							&& matches(db.getStudent(matrikelNumber))))
+			{
+				valid = false;
+			}
+		}
+		if (!valid)
+		{
+			this->usage.erase(entry.lruPosition);
+			this->entries.erase(it);
+			++this->stats.invalidations;
+			++this->stats.misses;
+			return false;
+		}
+		entry.version = db.getVersion();
+		++this->stats.revalidations;
+	}
+
+	this->usage.splice(this->usage.begin(), this->usage, entry.lruPosition);
+	text = entry.text;
+	++this->stats.hits;
+	return true;
+}
+
+void QueryCache::store(const StudentDb &db, const std::string &key,
+		std::vector<unsigned int> matrikelNumbers, const std::string &text)
+{
+	auto it = this->entries.find(key);
+	if (it != this->entries.end())
+	{
+		this->usage.erase(it->second.lruPosition);
+		this->entries.erase(it);
+	}
+	while (this->entries.size() >= this->capacity)
+	{
+		this->entries.erase(this->usage.back());
+		this->usage.pop_back();
+	}
+
+	std::sort(matrikelNumbers.begin(), matrikelNumbers.end());
+	this->usage.push_front(key);
+	Entry &entry = this->entries[key];
+	entry.version = db.getVersion();
+	entry.matrikelNumbers.swap(matrikelNumbers);
+	entry.text = text;
+	entry.lruPosition = this->usage.begin();
+}
+
+QueryCache::Statistics QueryCache::getStatistics() const
+{
+	Statistics current = this->stats;
+	current.entries = this->entries.size();
+	return current;
+}
+
+void QueryCache::clear()
+{
+	this->entries.clear();
+	this->usage.clear();
+}
@@ -0,0 +1,102 @@
+/**
+ * @file QueryCache.h
+ * @brief QueryCache class declaration for version-stamped result caching.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef QUERYCACHE_H_
+#define QUERYCACHE_H_
+
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "StudentDb.h"
+
+/**
+ * @class QueryCache
+ * @brief Least recently used cache of rendered query results.
+ *
+ * Every entry remembers the StudentDb version it was computed at and the
+ * students it contains. When the database has changed since, the entry is
+ * only dropped if one of the changed students was part of the result or
+ * matches the query now; other changes just advance the entry's version.
+ */
+class QueryCache
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Counters of the cache.
+	 */
+	struct Statistics
+	{
+		unsigned long long hits; ///< Lookups answered from the cache.
+		unsigned long long misses; ///< Lookups that had to be computed.
+		unsigned long long invalidations; ///< Entries dropped because of a relevant change.
+		unsigned long long revalidations; ///< Entries kept although the database changed.
+		std::size_t entries; ///< Entries currently cached.
+	};
+
+private:
+	/**
+	 * @struct Entry
+	 * @brief A cached result.
+	 */
+	struct Entry
+	{
+		unsigned long long version; ///< Database version the result is valid for.
+		std::vector<unsigned int> matrikelNumbers; ///< Students in the result, sorted.
+		std::string text; ///< Rendered result.
+		std::list<std::string>::iterator lruPosition; ///< Position in the usage list.
+	};
+
+	std::size_t capacity; ///< Maximum number of entries.
+	std::unordered_map<std::string, Entry> entries; ///< Entries by normalized key.
+	std::list<std::string> usage; ///< Keys, most recently used first.
+	Statistics stats; ///< Counters.
+
+public:
+	/**
+	 * @brief Creates an empty cache.
+	 * @param capacity Maximum number of entries.
+	 */
+	explicit QueryCache(std::size_t capacity = 64);
+
+	/**
+	 * @brief Looks up a result and checks that it is still valid.
+	 * @param db The database the result was computed from.
+	 * @param key Normalized query.
+	 * @param matches Predicate of the query, used to detect new matches.
+	 * @param text Receives the cached result on a hit.
+	 * @return True on a hit.
+	 */
+	bool lookup(const StudentDb &db, const std::string &key,
+			const std::function<bool(const Student&)> &matches,
+			std::string &text);
+
+	/**
+	 * @brief Stores a freshly computed result.
+	 * @param db The database the result was computed from.
+	 * @param key Normalized query.
+	 * @param matrikelNumbers Students contained in the result.
+	 * @param text Rendered result.
+	 */
+	void store(const StudentDb &db, const std::string &key,
+			std::vector<unsigned int> matrikelNumbers, const std::string &text);
+
+	/**
+	 * @brief Returns the counters.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Drops all entries.
+	 */
+	void clear();
+};
+
+#endif /* QUERYCACHE_H_ */
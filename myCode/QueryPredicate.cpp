@@ -0,0 +1,169 @@
+/**
+ * @file QueryPredicate.cpp
+ * @brief QueryPredicate class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "QueryPredicate.h"
+#include "NameScanner.h"
+
+QueryPredicate::QueryPredicate(Kind kind, const std::string &text, long low,
+		long high, float threshold) :
+		kind(kind), text(text), low(low), high(high), threshold(threshold)
+{
+}
+
+QueryPredicate QueryPredicate::cityEquals(const std::string &city)
+{
+	return QueryPredicate(CITY_EQUALS, city, 0, 0, 0.0f);
+}
+
+QueryPredicate QueryPredicate::postalCodeBetween(unsigned short low,
+		unsigned short high)
+{
+	return QueryPredicate(POSTAL_CODE_BETWEEN, "", low, high, 0.0f);
+}
+
+QueryPredicate QueryPredicate::bornBetween(long lowYmd, long highYmd)
+{
+	return QueryPredicate(BORN_BETWEEN, "",
+			CompactDate::fromYmd(lowYmd / 10000, lowYmd / 100 % 100,
+					lowYmd % 100).getDayNumber(),
+			CompactDate::fromYmd(highYmd / 10000, highYmd / 100 % 100,
+					highYmd % 100).getDayNumber(), 0.0f);
+}
+
+QueryPredicate QueryPredicate::enrolledIn(unsigned int courseKey)
+{
+	return QueryPredicate(ENROLLED_IN, "", courseKey, courseKey, 0.0f);
+}
+
+QueryPredicate QueryPredicate::gradeBelow(float threshold)
+{
+	return QueryPredicate(GRADE_BELOW, "", 0, 0, threshold);
+}
+
+QueryPredicate QueryPredicate::nameContains(const std::string &text)
+{
+	return QueryPredicate(NAME_CONTAINS, text, 0, 0, 0.0f);
+}
+
+QueryPredicate QueryPredicate::nameContainsIgnoreCase(const std::string &text)
+{
+	return QueryPredicate(NAME_CONTAINS_IGNORE_CASE, NameScanner::foldCase(text),
+			0, 0, 0.0f);
+}
+
+QueryPredicate QueryPredicate::lastNameStartsWith(const std::string &prefix)
+{
+	return QueryPredicate(LAST_NAME_PREFIX, prefix, 0, 0, 0.0f);
+}
+
+QueryPredicate::Kind QueryPredicate::getKind() const
+{
+	return this->kind;
+}
+
+const std::string& QueryPredicate::getText() const
+{
+	return this->text;
+}
+
+long QueryPredicate::getLow() const
+{
+	return this->low;
+}
+
+long QueryPredicate::getHigh() const
+{
+	return this->high;
+}
+
+float QueryPredicate::getThreshold() const
+{
+	return this->threshold;
+}
+
+bool QueryPredicate::matches(const Student &student) const
+{
+	switch (this->kind)
+	{
+	case CITY_EQUALS:
+		return student.getAddress()->getCity() == this->text;
+	case POSTAL_CODE_BETWEEN:
+	{
+		long postalCode = student.getAddress()->getPostalCode();
+		return postalCode >= this->low && postalCode <= this->high;
+	}
+	case BORN_BETWEEN:
+	{
+		long day = student.getBirthDate().getDayNumber();
+		return day >= this->low && day <= this->high;
+	}
+	case ENROLLED_IN:
+		for (const auto &enrollment : student.getEnrollments())
+		{
+			if (enrollment.getCourse()->getCourseKey()
+					== static_cast<unsigned int>(this->low))
+			{
+				return true;
+			}
+		}
+		return false;
+	case GRADE_BELOW:
+		for (const auto &enrollment : student.getEnrollments())
+		{
+			if (enrollment.getGrade() != 0
+					&& enrollment.getGrade() < this->threshold)
+			{
+				return true;
+			}
+		}
+		return false;
+	case NAME_CONTAINS:
+		return (student.getFirstName() + " " + student.getLastName()).find(
+				this->text) != std::string::npos;
+	case NAME_CONTAINS_IGNORE_CASE:
+		return NameScanner::foldCase(
+				student.getFirstName() + " " + student.getLastName()).find(
+				this->text) != std::string::npos;
+	case LAST_NAME_PREFIX:
+		return student.getLastName().compare(0, this->text.size(), this->text)
+				== 0;
+	}
+	return false;
+}
+
+std::string QueryPredicate::describe() const
+{
+	switch (this->kind)
+	{
+	case CITY_EQUALS:
+		return "city=" + this->text;
+	case POSTAL_CODE_BETWEEN:
+		return "postal=" + std::to_string(this->low) + ".."
+				+ std::to_string(this->high);
+	case BORN_BETWEEN:
+	{
+		int lowYear, lowMonth, lowDay, highYear, highMonth, highDay;
+		CompactDate(this->low).toYmd(lowYear, lowMonth, lowDay);
+		CompactDate(this->high).toYmd(highYear, highMonth, highDay);
+		return "born=" + std::to_string(lowDay) + "." + std::to_string(lowMonth)
+				+ "." + std::to_string(lowYear) + ".."
+				+ std::to_string(highDay) + "." + std::to_string(highMonth)
+				+ "." + std::to_string(highYear);
+	}
+	case ENROLLED_IN:
+		return "course=" + std::to_string(this->low);
+	case GRADE_BELOW:
+		return "grade<" + std::to_string(this->threshold);
+	case NAME_CONTAINS:
+		return "name~" + this->text;
+	case NAME_CONTAINS_IGNORE_CASE:
+		return "iname~" + this->text;
+	case LAST_NAME_PREFIX:
+		return "last^" + this->text;
+	}
+	return "";
+}
@@ -0,0 +1,158 @@
+/**
+ * @file QueryPredicate.h
+ * @brief QueryPredicate class declaration for filtering students.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef QUERYPREDICATE_H_
+#define QUERYPREDICATE_H_
+
+#include <string>
+#include "Student.h"
+
+/**
+ * @class QueryPredicate
+ * @brief A single condition on a student, combined by StudentQuery.
+ *
+ * Instances are created through the static factory functions. Dates are
+ * compared as CompactDate day numbers.
+ */
+class QueryPredicate
+{
+public:
+	/**
+	 * @enum Kind
+	 * @brief The supported conditions.
+	 */
+	enum Kind
+	{
+		CITY_EQUALS, ///< Address city equals text.
+		POSTAL_CODE_BETWEEN, ///< low <= postal code <= high.
+		BORN_BETWEEN, ///< low <= day number of the date of birth <= high.
+		ENROLLED_IN, ///< Has an enrollment for course low.
+		GRADE_BELOW, ///< Has a graded enrollment with grade < threshold.
+		NAME_CONTAINS, ///< "first last" contains text.
+		NAME_CONTAINS_IGNORE_CASE, ///< "first last" contains text, ASCII case folded.
+		LAST_NAME_PREFIX ///< Last name starts with text.
+	};
+
+private:
+	Kind kind; ///< Condition type.
+	std::string text; ///< Text operand.
+	long low; ///< Lower bound or key operand.
+	long high; ///< Upper bound operand.
+	float threshold; ///< Grade operand.
+
+	/**
+	 * @brief Constructs a predicate, used by the factory functions.
+	 */
+	QueryPredicate(Kind kind, const std::string &text, long low, long high,
+			float threshold);
+
+public:
+	/**
+	 * @brief Matches students living in a city.
+	 * @param city The city, compared exactly.
+	 * @return The predicate.
+	 */
+	static QueryPredicate cityEquals(const std::string &city);
+
+	/**
+	 * @brief Matches postal codes within a range.
+	 * @param low Lowest postal code, inclusive.
+	 * @param high Highest postal code, inclusive.
+	 * @return The predicate.
+	 */
+	static QueryPredicate postalCodeBetween(unsigned short low,
+			unsigned short high);
+
+	/**
+	 * @brief Matches dates of birth within a range.
+	 * @param lowYmd First date as YYYYMMDD, inclusive.
+	 * @param highYmd Last date as YYYYMMDD, inclusive.
+	 * @return The predicate, bounds are stored as day numbers.
+	 */
+	static QueryPredicate bornBetween(long lowYmd, long highYmd);
+
+	/**
+	 * @brief Matches students enrolled in a course.
+	 * @param courseKey Key of the course.
+	 * @return The predicate.
+	 */
+	static QueryPredicate enrolledIn(unsigned int courseKey);
+
+	/**
+	 * @brief Matches students with a graded enrollment below a grade.
+	 * @param threshold The grade, exclusive.
+	 * @return The predicate.
+	 */
+	static QueryPredicate gradeBelow(float threshold);
+
+	/**
+	 * @brief Matches students whose "first last" name contains a text.
+	 * @param text The substring, case sensitive.
+	 * @return The predicate.
+	 */
+	static QueryPredicate nameContains(const std::string &text);
+
+	/**
+	 * @brief Matches students whose "first last" name contains a text,
+	 * ignoring ASCII case.
+	 * @param text The substring, stored case folded.
+	 * @return The predicate.
+	 */
+	static QueryPredicate nameContainsIgnoreCase(const std::string &text);
+
+	/**
+	 * @brief Matches students whose last name starts with a prefix.
+	 * @param prefix The prefix, case sensitive.
+	 * @return The predicate.
+	 */
+	static QueryPredicate lastNameStartsWith(const std::string &prefix);
+
+	/**
+	 * @brief Returns the condition type.
+	 * @return The kind.
+	 */
+	Kind getKind() const;
+
+	/**
+	 * @brief Returns the text operand.
+	 * @return City, name substring or prefix, empty for other kinds.
+	 */
+	const std::string& getText() const;
+
+	/**
+	 * @brief Returns the lower bound or the course key.
+	 * @return The operand, day number for BORN_BETWEEN.
+	 */
+	long getLow() const;
+
+	/**
+	 * @brief Returns the upper bound.
+	 * @return The operand, day number for BORN_BETWEEN.
+	 */
+	long getHigh() const;
+
+	/**
+	 * @brief Returns the grade operand.
+	 * @return The threshold of GRADE_BELOW.
+	 */
+	float getThreshold() const;
+
+	/**
+	 * @brief Evaluates the condition.
+	 * @param student The student to test.
+	 * @return True if the student satisfies the condition.
+	 */
+	bool matches(const Student &student) const;
+
+	/**
+	 * @brief Describes the condition for query plans.
+	 * @return Human readable form.
+	 */
+	std::string describe() const;
+};
+
+#endif /* QUERYPREDICATE_H_ */
@@ -0,0 +1,126 @@
+/**
+ * @file RangeIndex.h
+ * @brief RangeIndex class template, an ordered secondary index.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef RANGEINDEX_H_
+#define RANGEINDEX_H_
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+/**
+ * @class RangeIndex
+ * @brief Ordered (key, matrikel number) pairs for range and count queries.
+ *
+ * Range and count queries cost O(log n + k) for k matching students.
+ * @tparam Key Integral key type.
+ */
+template<typename Key>
+class RangeIndex
+{
+private:
+	typedef std::pair<Key, unsigned int> Entry; ///< Key and matrikel number.
+	std::set<Entry> entries; ///< All entries in key order.
+
+public:
+	/**
+	 * @brief Adds a student under a key.
+	 * @param key Indexed value.
+	 * @param matrikelNumber Student identifier.
+	 */
+	void insert(Key key, unsigned int matrikelNumber)
+	{
+		this->entries.insert(Entry(key, matrikelNumber));
+	}
+
+	/**
+	 * @brief Removes a student that was added under a key.
+	 * @param key Indexed value used on insert.
+	 * @param matrikelNumber Student identifier.
+	 */
+	void remove(Key key, unsigned int matrikelNumber)
+	{
+		this->entries.erase(Entry(key, matrikelNumber));
+	}
+
+	/**
+	 * @brief Moves a student from one key to another.
+	 * @param oldKey Previous value.
+	 * @param newKey Current value.
+	 * @param matrikelNumber Student identifier.
+	 */
+	void update(Key oldKey, Key newKey, unsigned int matrikelNumber)
+	{
+		if (oldKey != newKey)
+		{
+			remove(oldKey, matrikelNumber);
+			insert(newKey, matrikelNumber);
+		}
+	}
+
+	/**
+	 * @brief Finds the students with low <= key <= high.
+	 * @param low Lower bound, inclusive.
+	 * @param high Upper bound, inclusive.
+	 * @return Matrikel numbers in key order.
+	 */
+	std::vector<unsigned int> range(Key low, Key high) const
+	{
+		std::vector<unsigned int> result;
+		if (high < low)
+		{
+			return result;
+		}
+		auto end = this->entries.upper_bound(
+				Entry(high, std::numeric_limits<unsigned int>::max()));
+		for (auto it = this->entries.lower_bound(Entry(low, 0)); it != end;
+				++it)
+		{
+			result.push_back(it->second);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Counts the students with low <= key <= high.
+	 * @param low Lower bound, inclusive.
+	 * @param high Upper bound, inclusive.
+	 * @return Number of students in the range.
+	 */
+	std::size_t count(Key low, Key high) const
+	{
+		if (high < low)
+		{
+			return 0;
+		}
+		return std::distance(this->entries.lower_bound(Entry(low, 0)),
+				this->entries.upper_bound(
+						Entry(high, std::numeric_limits<unsigned int>::max())));
+	}
+
+	/**
+	 * @brief Returns the number of entries.
+	 * @return Count of indexed students.
+	 */
+	std::size_t size() const
+	{
+		return this->entries.size();
+	}
+
+	/**
+	 * @brief Removes all entries.
+	 */
+	void clear()
+	{
+		this->entries.clear();
+	}
+};
+
+#endif /* RANGEINDEX_H_ */
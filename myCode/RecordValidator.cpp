@@ -0,0 +1,265 @@
+/**
+ * @file RecordValidator.cpp
+ * @brief RecordValidator class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "RecordValidator.h"
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+typedef std::array<unsigned short, 128> ClassTable;
+
+ClassTable makeAsciiClasses()
+{
+	ClassTable table;
+	for (unsigned int c = 0; c < table.size(); ++c)
+	{
+		if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
+			table[c] = RecordValidator::LETTER;
+		else if (c >= '0' && c <= '9')
+			table[c] = RecordValidator::DIGIT;
+		else if (c == ' ')
+			table[c] = RecordValidator::SPACE;
+		else if (c == '-')
+			table[c] = RecordValidator::HYPHEN;
+		else if (c == '\'')
+			table[c] = RecordValidator::APOSTROPHE;
+		else if (c == '.')
+			table[c] = RecordValidator::PERIOD;
+		else if (c == ';')
+			table[c] = RecordValidator::SEPARATOR;
+		else if (c < 0x20 || c == 0x7f)
+			table[c] = RecordValidator::CONTROL;
+		else
+			table[c] = RecordValidator::PUNCTUATION;
+	}
+	return table;
+}
+
+const ClassTable asciiClasses = makeAsciiClasses();
+
+/**
+ * @struct CodePointRange
+ * @brief Inclusive range of code points.
+ */
+struct CodePointRange
+{
+	char32_t first;
+	char32_t last;
+};
+
+/// Letters and combining marks outside ASCII, in ascending order.
+const CodePointRange letterRanges[] =
+{
+{ 0x00AA, 0x00AA },
+{ 0x00B5, 0x00B5 },
+{ 0x00BA, 0x00BA },
+{ 0x00C0, 0x00D6 },
+{ 0x00D8, 0x00F6 },
+{ 0x00F8, 0x036F },
+{ 0x0370, 0x0373 },
+{ 0x0376, 0x0377 },
+{ 0x037B, 0x037D },
+{ 0x0386, 0x0386 },
+{ 0x0388, 0x03FF },
+{ 0x0400, 0x0481 },
+{ 0x0483, 0x052F },
+{ 0x0531, 0x0556 },
+{ 0x0561, 0x0587 },
+{ 0x05D0, 0x05EA },
+{ 0x0620, 0x065F },
+{ 0x1E00, 0x1FFF },
+{ 0x3041, 0x30FF },
+{ 0x4E00, 0x9FFF },
+{ 0xAC00, 0xD7A3 } };
+
+unsigned int classifyCodePoint(char32_t codePoint)
+{
+	for (const CodePointRange &range : letterRanges)
+	{
+		if (codePoint < range.first)
+		{
+			break;
+		}
+		if (codePoint <= range.last)
+		{
+			return RecordValidator::LETTER;
+		}
+	}
+	switch (codePoint)
+	{
+	case 0x00A0:
+		return RecordValidator::SPACE;
+	case 0x2010:
+	case 0x2011:
+		return RecordValidator::HYPHEN;
+	case 0x2019:
+		return RecordValidator::APOSTROPHE;
+	default:
+		break;
+	}
+	if (codePoint <= 0x9F || (codePoint >= 0x200B && codePoint <= 0x200F)
+			|| codePoint == 0x2028 || codePoint == 0x2029
+			|| (codePoint >= 0xFFF9 && codePoint <= 0xFFFB))
+	{
+		return RecordValidator::CONTROL;
+	}
+	return RecordValidator::PUNCTUATION;
+}
+
+/**
+ * @brief Decodes one multibyte UTF-8 sequence.
+ * @param pos First byte, at least 0x80, advanced past the sequence. A
+ * malformed sequence is skipped one byte at a time.
+ * @param end End of the text.
+ * @param codePoint Receives the code point.
+ * @return False if the sequence is malformed, overlong or a surrogate.
+ */
+bool decodeUtf8(const unsigned char *&pos, const unsigned char *end,
+		char32_t &codePoint)
+{
+	unsigned char lead = *pos;
+	std::size_t size;
+	unsigned char low = 0x80, high = 0xBF;
+	if (lead >= 0xC2 && lead <= 0xDF)
+	{
+		size = 2;
+		codePoint = lead & 0x1F;
+	}
+	else if (lead >= 0xE0 && lead <= 0xEF)
+	{
+		size = 3;
+		codePoint = lead & 0x0F;
+		if (lead == 0xE0)
+			low = 0xA0;
+		else if (lead == 0xED)
+			high = 0x9F;
+	}
+	else if (lead >= 0xF0 && lead <= 0xF4)
+	{
+		size = 4;
+		codePoint = lead & 0x07;
+		if (lead == 0xF0)
+			low = 0x90;
+		else if (lead == 0xF4)
+			high = 0x8F;
+	}
+	else
+	{
+		++pos;
+		return false;
+	}
+	if (static_cast<std::size_t>(end - pos) < size || pos[1] < low
+			|| pos[1] > high)
+	{
+		++pos;
+		return false;
+	}
+	for (std::size_t i = 1; i < size; ++i)
+	{
+		if ((pos[i] & 0xC0) != 0x80)
+		{
+			++pos;
+			return false;
+		}
+		codePoint = (codePoint << 6) | (pos[i] & 0x3F);
+	}
+	pos += size;
+	return true;
+}
+}
+
+RecordValidator::RecordValidator()
+{
+	const unsigned int nameClasses = LETTER | SPACE | HYPHEN | APOSTROPHE
+			| PERIOD;
+	const unsigned int textClasses = nameClasses | DIGIT | PUNCTUATION;
+	this->rules[FIRST_NAME] =
+	{ nameClasses, 1, 64 };
+	this->rules[LAST_NAME] =
+	{ nameClasses, 1, 64 };
+	this->rules[STREET] =
+	{ textClasses, 1, 128 };
+	this->rules[CITY] =
+	{ textClasses, 1, 128 };
+	this->rules[ADDITIONAL_INFO] =
+	{ textClasses, 0, 256 };
+}
+
+void RecordValidator::setRule(Field field, const Rule &rule)
+{
+	this->rules[field] = rule;
+}
+
+const RecordValidator::Rule& RecordValidator::getRule(Field field) const
+{
+	return this->rules[field];
+}
+
+unsigned int RecordValidator::classify(std::string_view text,
+		std::size_t &length)
+{
+	const unsigned char *pos =
+			reinterpret_cast<const unsigned char*>(text.data());
+	const unsigned char *end = pos + text.size();
+	unsigned int classes = 0;
+	length = 0;
+	while (pos < end)
+	{
+		// Eight ASCII bytes are looked up without testing each of them.
+		std::uint64_t word;
+		if (end - pos >= 8
+				&& (std::memcpy(&word, pos, 8),
+						(word & 0x8080808080808080ull) == 0))
+		{
+			classes |= asciiClasses[pos[0]] | asciiClasses[pos[1]]
+					| asciiClasses[pos[2]] | asciiClasses[pos[3]]
+					| asciiClasses[pos[4]] | asciiClasses[pos[5]]
+					| asciiClasses[pos[6]] | asciiClasses[pos[7]];
+			pos += 8;
+			length += 8;
+			continue;
+		}
+		if (*pos < 0x80)
+		{
+			classes |= asciiClasses[*pos++];
+		}
+		else
+		{
+			char32_t codePoint;
+			classes |=
+					decodeUtf8(pos, end, codePoint) ?
+							classifyCodePoint(codePoint) : CONTROL;
+		}
+		++length;
+	}
+	return classes;
+}
+
+bool RecordValidator::check(Field field, std::string_view text) const
+{
+	const Rule &rule = this->rules[field];
+	std::size_t length;
+	unsigned int classes = classify(text, length);
+	return (classes & ~rule.allowed) == 0 && length >= rule.minLength
+			&& length <= rule.maxLength;
+}
+
+bool RecordValidator::isValid(std::string_view firstName,
+		std::string_view lastName, std::string_view street,
+		std::string_view city, std::string_view additionalInfo) const
+{
+	return check(FIRST_NAME, firstName) && check(LAST_NAME, lastName)
+			&& check(STREET, street) && check(CITY, city)
+			&& check(ADDITIONAL_INFO, additionalInfo);
+}
+
+bool RecordValidator::isValid(const StudentRecord &record) const
+{
+	return isValid(record.firstName, record.lastName, record.street,
+			record.city, record.additionalInfo);
+}
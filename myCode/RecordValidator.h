@@ -0,0 +1,129 @@
+/**
+ * @file RecordValidator.h
+ * @brief RecordValidator class declaration for checking the text fields of
+ * students.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef RECORDVALIDATOR_H_
+#define RECORDVALIDATOR_H_
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include "StudentRecord.h"
+
+/**
+ * @class RecordValidator
+ * @brief Checks names and addresses against per field rules.
+ *
+ * A rule lists the character classes a field may contain and bounds its
+ * length in characters. Each field is scanned once: ASCII bytes are
+ * classified by a lookup table, eight at a time while no byte has the high
+ * bit set, multibyte UTF-8 sequences are decoded and classified by code
+ * point. The classes seen are collected into a mask and compared with the
+ * rule at the end, so the scan itself does not branch on the rule.
+ *
+ * The check does not depend on the C locale. A configured validator is
+ * only read, so one instance can serve several threads.
+ */
+class RecordValidator
+{
+public:
+	/**
+	 * @brief Classes of characters, combined as bit masks.
+	 */
+	enum CharacterClass : unsigned int
+	{
+		LETTER = 1u << 0, ///< Latin, Greek, Cyrillic and other letters, combining marks.
+		DIGIT = 1u << 1, ///< 0 to 9.
+		SPACE = 1u << 2, ///< Blank and no-break space.
+		HYPHEN = 1u << 3, ///< Hyphen-minus and Unicode hyphens.
+		APOSTROPHE = 1u << 4, ///< ' and the right single quotation mark.
+		PERIOD = 1u << 5, ///< Full stop.
+		PUNCTUATION = 1u << 6, ///< Other printable characters.
+		SEPARATOR = 1u << 7, ///< ';', the field separator of the database file.
+		CONTROL = 1u << 8 ///< Control characters and malformed UTF-8.
+	};
+
+	/**
+	 * @brief Fields a rule can be set for.
+	 */
+	enum Field
+	{
+		FIRST_NAME, LAST_NAME, STREET, CITY, ADDITIONAL_INFO, FIELDS
+	};
+
+	/**
+	 * @struct Rule
+	 * @brief What a field may contain.
+	 */
+	struct Rule
+	{
+		unsigned int allowed; ///< CharacterClass bits the field may contain.
+		std::size_t minLength; ///< Fewest characters.
+		std::size_t maxLength; ///< Most characters.
+	};
+
+private:
+	std::array<Rule, FIELDS> rules; ///< Rule per field.
+
+public:
+	/**
+	 * @brief Creates a validator with the default rules.
+	 *
+	 * Names need at least one character and may contain letters, blanks,
+	 * hyphens, apostrophes and periods. Street and city need at least one
+	 * character, the additional information may be empty, all three may
+	 * contain any printable character except the field separator.
+	 */
+	RecordValidator();
+
+	/**
+	 * @brief Replaces the rule of a field.
+	 * @param field The field.
+	 * @param rule The new rule.
+	 */
+	void setRule(Field field, const Rule &rule);
+
+	/**
+	 * @brief Returns the rule of a field.
+	 * @param field The field.
+	 * @return The rule.
+	 */
+	const Rule& getRule(Field field) const;
+
+	/**
+	 * @brief Classifies the characters of a text.
+	 * @param text UTF-8 text.
+	 * @param length Receives the number of characters.
+	 * @return CharacterClass bits of all characters in the text.
+	 */
+	static unsigned int classify(std::string_view text, std::size_t &length);
+
+	/**
+	 * @brief Checks one field.
+	 * @param field Rule to apply.
+	 * @param text UTF-8 text of the field.
+	 * @return True if the text follows the rule.
+	 */
+	bool check(Field field, std::string_view text) const;
+
+	/**
+	 * @brief Checks the text fields of a student.
+	 * @return True if all fields follow their rules.
+	 */
+	bool isValid(std::string_view firstName, std::string_view lastName,
+			std::string_view street, std::string_view city,
+			std::string_view additionalInfo) const;
+
+	/**
+	 * @brief Checks the text fields of a record.
+	 * @param record The record, its postal code and date are not checked.
+	 * @return True if all fields follow their rules.
+	 */
+	bool isValid(const StudentRecord &record) const;
+};
+
+#endif /* RECORDVALIDATOR_H_ */
@@ -0,0 +1,480 @@
+/**
+ * @file ReplicaFollower.cpp
+ * @brief ReplicaFollower class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "ReplicaFollower.h"
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "ReplicationLog.h"
+
+using boost::asio::ip::tcp;
+
+ReplicaFollower::ReplicaFollower(MutationPipeline &pipeline,
+		const std::string &host, const std::string &port,
+		const std::string &directory, unsigned long long compactAfter) :
+		pipeline(pipeline), host(host), port(port), directory(directory), compactAfter(
+				std::max(compactAfter, 1ull)), appliedLsn(0), primaryLsn(0), connected(
+				false), stopping(false), diverged(false), recordsApplied(0), recordsReplayed(0), snapshotsLoaded(
+				0), connects(0)
+{
+	this->loadState();
+	this->receiver = std::thread([this]
+	{
+		this->receiveLoop();
+	});
+}
+
+std::string ReplicaFollower::path(const char *name) const
+{
+	return this->directory + "/" + name;
+}
+
+void ReplicaFollower::loadState()
+{
+	std::ifstream snapshot(this->path("snapshot"), std::ios::binary);
+	std::uint64_t snapshotEpoch, lsn;
+	if (snapshot >> snapshotEpoch >> lsn)
+	{
+		snapshot.ignore();
+		std::string data((std::istreambuf_iterator<char>(snapshot)),
+				std::istreambuf_iterator<char>());
+		// Without it, the primary sends a new snapshot.
+		if (this->loadDatabase(data, lsn))
+		{
+			this->epoch = snapshotEpoch;
+			this->receivedLsn = lsn;
+		}
+	}
+
+	// Replays the records up to the first gap or incomplete one, a crash
+	// may have cut the last record.
+	std::ifstream records(this->path("records"), std::ios::binary);
+	std::string data((std::istreambuf_iterator<char>(records)),
+			std::istreambuf_iterator<char>());
+	std::string_view rest(data);
+	std::size_t size;
+	while (this->epoch != 0 && StudentProtocol::frameSize(rest, size)
+			&& size >= StudentProtocol::headerSize && rest.size() >= size)
+	{
+		std::uint32_t requestId;
+		std::uint8_t code;
+		std::string_view payload = StudentProtocol::split(rest.substr(0, size),
+				requestId, code);
+		if (code != StudentProtocol::RECORD || !this->applyFrame(payload))
+		{
+			break;
+		}
+		rest.remove_prefix(size);
+		++this->recordsReplayed;
+	}
+	records.close();
+	this->recordsInFile = this->recordsReplayed;
+	this->recordFile.open(this->path("records"),
+			std::ios::binary | std::ios::trunc);
+	this->recordFile.write(data.data(), data.size() - rest.size());
+	this->recordFile.flush();
+	if (!this->recordFile)
+	{
+		throw std::runtime_error("Cannot write to " + this->directory);
+	}
+	this->pipeline.flush().wait();
+	if (this->diverged)
+	{
+		this->epoch = 0;
+		this->receivedLsn = 0;
+	}
+	this->primaryLsn = this->receivedLsn;
+}
+
+void ReplicaFollower::receiveLoop()
+{
+	while (!this->stopping)
+	{
+		try
+		{
+			boost::asio::io_context ioContext;
+			tcp::resolver resolver(ioContext);
+			tcp::socket socket(ioContext);
+			boost::asio::connect(socket,
+					resolver.resolve(this->host, this->port));
+			socket.set_option(tcp::no_delay(true));
+			{
+				std::lock_guard<std::mutex> lock(this->socketMutex);
+				if (this->stopping)
+				{
+					break;
+				}
+				this->socket = &socket;
+			}
+			++this->connects;
+			this->connected = true;
+			try
+			{
+				this->follow(socket);
+			}
+			catch (const std::exception&)
+			{
+			}
+			this->connected = false;
+			std::lock_guard<std::mutex> lock(this->socketMutex);
+			this->socket = nullptr;
+		}
+		catch (const std::exception&)
+		{
+		}
+		std::unique_lock<std::mutex> lock(this->socketMutex);
+		this->retry.wait_for(lock, std::chrono::milliseconds(500), [this]
+		{
+			return this->stopping.load();
+		});
+	}
+}
+
+void ReplicaFollower::follow(tcp::socket &socket)
+{
+	std::string hello;
+	StudentProtocol::Writer request(hello, 0, StudentProtocol::FOLLOW);
+	request.u64(this->epoch);
+	request.u64(this->receivedLsn);
+	request.finish();
+	boost::asio::write(socket, boost::asio::buffer(hello));
+
+	std::string input;
+	std::vector<char> chunk(65536);
+	std::string snapshot;
+	std::uint64_t snapshotEpoch = 0, snapshotLsn = 0;
+	while (!this->stopping)
+	{
+		input.append(chunk.data(),
+				socket.read_some(boost::asio::buffer(chunk)));
+		std::string_view data(input);
+		std::size_t size;
+		while (StudentProtocol::frameSize(data, size))
+		{
+			if (size < StudentProtocol::headerSize
+					|| size - StudentProtocol::lengthSize
+							> StudentProtocol::maxFrameSize)
+			{
+				throw std::runtime_error("Oversized replication frame");
+			}
+			if (data.size() < size)
+			{
+				break;
+			}
+			std::string_view frame = data.substr(0, size);
+			std::uint32_t requestId;
+			std::uint8_t code;
+			std::string_view payload = StudentProtocol::split(frame, requestId,
+					code);
+			StudentProtocol::Reader reader(payload);
+			std::uint64_t lsn, time;
+			switch (code)
+			{
+			case StudentProtocol::SNAPSHOT:
+				if (!reader.u64(snapshotEpoch) || !reader.u64(snapshotLsn)
+						|| !reader.complete())
+				{
+					throw std::runtime_error("Malformed snapshot");
+				}
+				snapshot.clear();
+				break;
+			case StudentProtocol::SNAPSHOT_DATA:
+				snapshot.append(payload.data(), payload.size());
+				break;
+			case StudentProtocol::SNAPSHOT_END:
+				this->loadSnapshot(std::move(snapshot), snapshotEpoch,
+						snapshotLsn);
+				snapshot.clear();
+				break;
+			case StudentProtocol::RECORD:
+				if (!this->applyFrame(payload))
+				{
+					// Starts over from a snapshot.
+					this->epoch = 0;
+					throw std::runtime_error("Malformed log record");
+				}
+				this->recordFile.write(frame.data(), frame.size());
+				++this->recordsInFile;
+				break;
+			case StudentProtocol::HEARTBEAT:
+				if (!reader.u64(lsn) || !reader.u64(time) || !reader.complete())
+				{
+					throw std::runtime_error("Malformed heartbeat");
+				}
+				this->notePrimary(lsn);
+				break;
+			default:
+				throw std::runtime_error("Unknown replication frame");
+			}
+			data.remove_prefix(size);
+		}
+		if (this->diverged && this->epoch != 0)
+		{
+			// Starts over from a snapshot, unless one is already requested.
+			this->epoch = 0;
+			this->receivedLsn = 0;
+			throw std::runtime_error("Replica diverged from the primary");
+		}
+		input.erase(0, input.size() - data.size());
+		this->recordFile.flush();
+		if (this->recordsInFile >= this->compactAfter)
+		{
+			this->compact();
+		}
+	}
+}
+
+bool ReplicaFollower::applyFrame(std::string_view payload)
+{
+	StudentProtocol::Reader reader(payload);
+	std::uint64_t lsn, commitTime;
+	std::uint8_t operation;
+	if (!reader.u64(lsn) || !reader.u64(commitTime) || !reader.u8(operation)
+			|| lsn != this->receivedLsn + 1)
+	{
+		return false;
+	}
+	return this->apply(lsn, static_cast<std::int64_t>(commitTime), operation,
+			reader.remainder());
+}
+
+bool ReplicaFollower::apply(std::uint64_t lsn, std::int64_t commitTime,
+		std::uint8_t operation, std::string_view payload)
+{
+	StudentServer::Mutation mutation;
+	// The primary already checked the fields.
+	if (StudentServer::decodeMutation(nullptr, operation, payload, mutation)
+			!= StudentProtocol::OK)
+	{
+		return false;
+	}
+	{
+		std::lock_guard<std::mutex> lock(this->pendingMutex);
+		this->pending.emplace_back(lsn, commitTime);
+		if (lsn >= this->primaryLsn)
+		{
+			this->primaryLsn = lsn;
+			this->behindSince = 0;
+		}
+	}
+	this->receivedLsn = lsn;
+	this->pipeline.execute([this, mutation, lsn](StudentDb &db)
+	{
+		if (!this->diverged)
+		{
+			unsigned int matrikelNumber;
+			try
+			{
+				mutation(db, matrikelNumber);
+				this->appliedLsn = lsn;
+				++this->recordsApplied;
+			}
+			catch (const std::exception &e)
+			{
+				this->diverge(db, "record " + std::to_string(lsn), e);
+			}
+		}
+		std::lock_guard<std::mutex> lock(this->pendingMutex);
+		this->pending.pop_front();
+	});
+	return true;
+}
+
+void ReplicaFollower::loadSnapshot(std::string data,
+		std::uint64_t snapshotEpoch, std::uint64_t lsn)
+{
+	if (!this->loadDatabase(data, lsn))
+	{
+		this->epoch = 0;
+		this->receivedLsn = 0;
+		throw std::runtime_error("Malformed snapshot");
+	}
+	{
+		std::lock_guard<std::mutex> lock(this->pendingMutex);
+		this->primaryLsn = lsn;
+		this->behindSince = 0;
+	}
+	this->epoch = snapshotEpoch;
+	this->receivedLsn = lsn;
+	++this->snapshotsLoaded;
+	this->storeSnapshot(data, lsn);
+}
+
+bool ReplicaFollower::loadDatabase(const std::string &data, std::uint64_t lsn)
+{
+	std::promise<bool> done;
+	std::future<bool> loaded = done.get_future();
+	this->pipeline.execute([this, &data, &done, lsn](StudentDb &db)
+	{
+		std::istringstream in(data);
+		try
+		{
+			db.read(in, nullptr, nullptr, true);
+			this->appliedLsn = lsn;
+			this->diverged = false;
+			done.set_value(true);
+		}
+		catch (const std::exception &e)
+		{
+			this->diverge(db, "snapshot", e);
+			done.set_value(false);
+		}
+	});
+	return loaded.get();
+}
+
+void ReplicaFollower::diverge(StudentDb &db, const std::string &what,
+		const std::exception &error)
+{
+	std::cerr << "Replica cannot apply the " << what << ": " << error.what()
+			<< ", requesting a new snapshot." << std::endl;
+	db.clearDatabase();
+	this->appliedLsn = 0;
+	this->diverged = true;
+}
+
+void ReplicaFollower::storeSnapshot(const std::string &data, std::uint64_t lsn)
+{
+	std::string temporary = this->path("snapshot.tmp");
+	{
+		std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+		out << this->epoch << ' ' << lsn << '\n';
+		out.write(data.data(), data.size());
+		if (!out.flush())
+		{
+			throw std::runtime_error("Cannot write " + temporary);
+		}
+	}
+	// The old records stay valid until the new snapshot replaces the old
+	// one, after that they are skipped as out of order.
+	if (std::rename(temporary.c_str(), this->path("snapshot").c_str()) != 0)
+	{
+		throw std::runtime_error("Cannot replace the snapshot");
+	}
+	this->recordFile.close();
+	this->recordFile.open(this->path("records"),
+			std::ios::binary | std::ios::trunc);
+	this->recordsInFile = 0;
+}
+
+void ReplicaFollower::compact()
+{
+	auto data = std::make_shared<std::string>();
+	auto done = std::make_shared<std::promise<std::uint64_t>>();
+	std::future<std::uint64_t> lsn = done->get_future();
+	this->pipeline.execute([this, data, done](StudentDb &db)
+	{
+		try
+		{
+			std::ostringstream out;
+			db.write(out);
+			*data = out.str();
+			done->set_value(this->appliedLsn);
+		}
+		catch (...)
+		{
+			done->set_exception(std::current_exception());
+		}
+	});
+	this->storeSnapshot(*data, lsn.get());
+}
+
+void ReplicaFollower::notePrimary(std::uint64_t lsn)
+{
+	std::lock_guard<std::mutex> lock(this->pendingMutex);
+	if (lsn > this->primaryLsn)
+	{
+		this->primaryLsn = lsn;
+	}
+	if (lsn > this->receivedLsn && this->behindSince == 0)
+	{
+		this->behindSince = ReplicationLog::now();
+	}
+}
+
+StudentServer::Hooks ReplicaFollower::getHooks() const
+{
+	StudentServer::Hooks hooks;
+	hooks.readOnly = true;
+	hooks.status = [this]
+	{
+		return this->getStatus();
+	};
+	return hooks;
+}
+
+StudentProtocol::ReplicationStatus ReplicaFollower::getStatus() const
+{
+	StudentProtocol::ReplicationStatus status =
+	{ StudentProtocol::FOLLOWER, this->appliedLsn, this->primaryLsn, 0 };
+	if (status.appliedLsn < status.primaryLsn)
+	{
+		std::int64_t since;
+		{
+			std::lock_guard<std::mutex> lock(this->pendingMutex);
+			since = this->pending.empty() ?
+					this->behindSince : this->pending.front().second;
+		}
+		std::int64_t now = ReplicationLog::now();
+		if (since > 0 && now > since)
+		{
+			status.lagMilliseconds = static_cast<std::uint32_t>(std::min<
+					std::int64_t>(now - since,
+					std::numeric_limits<std::uint32_t>::max()));
+		}
+	}
+	return status;
+}
+
+ReplicaFollower::Statistics ReplicaFollower::getStatistics() const
+{
+	StudentProtocol::ReplicationStatus status = this->getStatus();
+	Statistics statistics;
+	statistics.connected = this->connected;
+	statistics.appliedLsn = status.appliedLsn;
+	statistics.primaryLsn = status.primaryLsn;
+	statistics.lagMilliseconds = status.lagMilliseconds;
+	statistics.recordsApplied = this->recordsApplied;
+	statistics.recordsReplayed = this->recordsReplayed;
+	statistics.snapshotsLoaded = this->snapshotsLoaded;
+	statistics.connects = this->connects;
+	return statistics;
+}
+
+void ReplicaFollower::stop()
+{
+	if (!this->receiver.joinable())
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(this->socketMutex);
+		this->stopping = true;
+		if (this->socket != nullptr)
+		{
+			boost::system::error_code ignored;
+			this->socket->shutdown(tcp::socket::shutdown_both, ignored);
+		}
+	}
+	this->retry.notify_all();
+	this->receiver.join();
+	// Queued records refer to the follower.
+	this->pipeline.flush().wait();
+	this->recordFile.close();
+}
+
+ReplicaFollower::~ReplicaFollower()
+{
+	this->stop();
+}
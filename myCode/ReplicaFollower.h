@@ -0,0 +1,235 @@
+/**
+ * @file ReplicaFollower.h
+ * @brief ReplicaFollower class declaration for keeping a read replica of a
+ * StudentDb up to date.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef REPLICAFOLLOWER_H_
+#define REPLICAFOLLOWER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <boost/asio.hpp>
+#include "MutationPipeline.h"
+#include "StudentProtocol.h"
+#include "StudentServer.h"
+
+/**
+ * @class ReplicaFollower
+ * @brief Applies the mutation log of a ReplicationPrimary to a local database.
+ *
+ * A thread receives the log stream and queues every record on the
+ * MutationPipeline of the replica, so a StudentServer sharing the pipeline
+ * serves reads while records are applied. Lost connections are retried.
+ *
+ * The follower keeps its state in a directory: the last snapshot, with the
+ * log epoch and sequence number it includes, and the records received
+ * since. On start it loads both and asks the primary only for the records
+ * after them, so catching up after a restart costs the missed part of the
+ * log, not a copy of the database. The snapshot is renewed locally once the
+ * record file grows long.
+ */
+class ReplicaFollower
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Counters and replication state of the follower.
+	 */
+	struct Statistics
+	{
+		bool connected; ///< Set while connected to the primary.
+		std::uint64_t appliedLsn; ///< Last record applied to the database.
+		std::uint64_t primaryLsn; ///< Last record the primary reported.
+		std::uint32_t lagMilliseconds; ///< Age of the oldest change not yet applied.
+		unsigned long long recordsApplied; ///< Records applied since the start.
+		unsigned long long recordsReplayed; ///< Records loaded from the directory at the start.
+		unsigned int snapshotsLoaded; ///< Snapshots received from the primary.
+		unsigned int connects; ///< Connections made to the primary.
+	};
+
+private:
+	MutationPipeline &pipeline; ///< Pipeline of the replica's database.
+	std::string host; ///< Host of the primary.
+	std::string port; ///< Replication port of the primary.
+	std::string directory; ///< Directory of the local state.
+	unsigned long long compactAfter; ///< Records in the record file before a new local snapshot.
+
+	// Only used by the receiving thread once the constructor returned.
+	std::uint64_t epoch = 0; ///< Epoch of the primary's log.
+	std::uint64_t receivedLsn = 0; ///< Last record queued for applying.
+	unsigned long long recordsInFile = 0; ///< Records in the record file.
+	std::ofstream recordFile; ///< Records received since the last snapshot.
+
+	std::atomic<std::uint64_t> appliedLsn; ///< Last record applied.
+	std::atomic<std::uint64_t> primaryLsn; ///< Last record the primary reported.
+	std::atomic<bool> connected; ///< Set while connected.
+	std::atomic<bool> stopping; ///< Set by stop().
+	std::atomic<bool> diverged; ///< Set while the database misses records, until a snapshot replaces it.
+	std::atomic<unsigned long long> recordsApplied; ///< Counter of applied records.
+	std::atomic<unsigned long long> recordsReplayed; ///< Records loaded at the start.
+	std::atomic<unsigned int> snapshotsLoaded; ///< Counter of snapshots.
+	std::atomic<unsigned int> connects; ///< Counter of connections.
+
+	mutable std::mutex pendingMutex; ///< Guards pending and behindSince.
+	std::deque<std::pair<std::uint64_t, std::int64_t>> pending; ///< LSN and commit time of queued records.
+	std::int64_t behindSince = 0; ///< Time the primary reported records not yet received, 0 if none.
+
+	std::mutex socketMutex; ///< Guards socket, sleeps between connects.
+	std::condition_variable retry; ///< Wakes the retry sleep on stop().
+	boost::asio::ip::tcp::socket *socket = nullptr; ///< Socket of the running connection.
+	std::thread receiver; ///< The receiving thread.
+
+	/**
+	 * @brief Returns the path of a file of the local state.
+	 * @param name File name.
+	 * @return The path in the directory.
+	 */
+	std::string path(const char *name) const;
+
+	/**
+	 * @brief Loads the snapshot and the records of the directory.
+	 */
+	void loadState();
+
+	/**
+	 * @brief Main loop of the receiving thread, connects until stopped.
+	 */
+	void receiveLoop();
+
+	/**
+	 * @brief Follows the primary over one connection until it fails.
+	 * @param socket The connected socket.
+	 */
+	void follow(boost::asio::ip::tcp::socket &socket);
+
+	/**
+	 * @brief Queues a record on the pipeline.
+	 * @param lsn Sequence number of the record.
+	 * @param commitTime Time the primary applied it, ms since 1970.
+	 * @param operation Operation of the mutation.
+	 * @param payload Payload of the mutation.
+	 * @return False if the record cannot be decoded.
+	 */
+	bool apply(std::uint64_t lsn, std::int64_t commitTime,
+			std::uint8_t operation, std::string_view payload);
+
+	/**
+	 * @brief Decodes a RECORD payload and queues it.
+	 * @param payload Payload of the RECORD frame.
+	 * @return False if the record is malformed or out of order.
+	 */
+	bool applyFrame(std::string_view payload);
+
+	/**
+	 * @brief Replaces the database by a snapshot and stores it.
+	 * @param data Database file contents.
+	 * @param snapshotEpoch Epoch of the primary's log.
+	 * @param lsn Last record the snapshot includes.
+	 * @throw std::runtime_error If the snapshot cannot be read, after
+	 * resetting the position in the log, so the follower reconnects and
+	 * receives a new one.
+	 */
+	void loadSnapshot(std::string data, std::uint64_t snapshotEpoch,
+			std::uint64_t lsn);
+
+	/**
+	 * @brief Replaces the database by a snapshot and waits until it is
+	 * loaded.
+	 * @param data Database file contents.
+	 * @param lsn Last record the snapshot includes.
+	 * @return False if the snapshot cannot be read, the database is empty
+	 * then.
+	 */
+	bool loadDatabase(const std::string &data, std::uint64_t lsn);
+
+	/**
+	 * @brief Empties the database after a snapshot or record failed, the
+	 * following records are skipped until a new snapshot is loaded.
+	 *
+	 * Runs on the pipeline.
+	 * @param db The database.
+	 * @param what The part of the log that failed, for the error message.
+	 * @param error The error.
+	 */
+	void diverge(StudentDb &db, const std::string &what,
+			const std::exception &error);
+
+	/**
+	 * @brief Stores a snapshot and empties the record file.
+	 * @param data Database file contents.
+	 * @param lsn Last record the snapshot includes.
+	 */
+	void storeSnapshot(const std::string &data, std::uint64_t lsn);
+
+	/**
+	 * @brief Takes a snapshot of the local database and stores it.
+	 */
+	void compact();
+
+	/**
+	 * @brief Notes the end of the primary's log.
+	 * @param lsn Last record of the primary.
+	 */
+	void notePrimary(std::uint64_t lsn);
+
+public:
+	/**
+	 * @brief Loads the local state and starts following a primary.
+	 *
+	 * The database is only accessed through the pipeline.
+	 * @param pipeline Pipeline of the replica's database, must outlive the
+	 * follower.
+	 * @param host Host of the primary.
+	 * @param port Replication port of the primary.
+	 * @param directory Existing directory for the local state.
+	 * @param compactAfter Records in the record file before a new local
+	 * snapshot is taken.
+	 */
+	ReplicaFollower(MutationPipeline &pipeline, const std::string &host,
+			const std::string &port, const std::string &directory,
+			unsigned long long compactAfter = 100000);
+
+	ReplicaFollower(const ReplicaFollower&) = delete;
+	ReplicaFollower& operator=(const ReplicaFollower&) = delete;
+
+	/**
+	 * @brief Returns the hooks for the StudentServer of the replica.
+	 * @return Hooks that make the server read only and report the
+	 * follower's status.
+	 */
+	StudentServer::Hooks getHooks() const;
+
+	/**
+	 * @brief Returns the replication state as reported by STATUS.
+	 * @return The state.
+	 */
+	StudentProtocol::ReplicationStatus getStatus() const;
+
+	/**
+	 * @brief Returns the counters.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Disconnects and stops the receiving thread, queued records are
+	 * still applied.
+	 */
+	void stop();
+
+	virtual ~ReplicaFollower();
+};
+
+#endif /* REPLICAFOLLOWER_H_ */
@@ -0,0 +1,88 @@
+/**
+ * @file ReplicationLog.cpp
+ * @brief ReplicationLog class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "ReplicationLog.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+ReplicationLog::ReplicationLog(std::size_t capacity) :
+		epoch(0), capacity(std::max<std::size_t>(capacity, 1))
+{
+	std::random_device device;
+	while (this->epoch == 0)
+	{
+		this->epoch = (std::uint64_t(device()) << 32) | device();
+	}
+}
+
+std::uint64_t ReplicationLog::getEpoch() const
+{
+	return this->epoch;
+}
+
+std::uint64_t ReplicationLog::getLastLsn() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->lastLsn;
+}
+
+std::uint64_t ReplicationLog::append(std::uint8_t operation,
+		std::string_view payload)
+{
+	std::uint64_t lsn;
+	std::function<void()> listener;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->entries.size() == this->capacity)
+		{
+			this->entries.pop_front();
+		}
+		lsn = ++this->lastLsn;
+		this->entries.push_back(
+		{ lsn, now(), operation, std::string(payload) });
+		listener = this->listener;
+	}
+	if (listener)
+	{
+		listener();
+	}
+	return lsn;
+}
+
+bool ReplicationLog::read(std::uint64_t after, std::size_t maxEntries,
+		std::vector<Entry> &out) const
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if (after >= this->lastLsn)
+	{
+		return after == this->lastLsn;
+	}
+	std::uint64_t first = this->lastLsn - this->entries.size() + 1;
+	if (after + 1 < first)
+	{
+		return false;
+	}
+	for (std::size_t i = after + 1 - first;
+			i < this->entries.size() && maxEntries > 0; ++i, --maxEntries)
+	{
+		out.push_back(this->entries[i]);
+	}
+	return true;
+}
+
+void ReplicationLog::setListener(std::function<void()> listener)
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->listener = std::move(listener);
+}
+
+std::int64_t ReplicationLog::now()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,104 @@
+/**
+ * @file ReplicationLog.h
+ * @brief ReplicationLog class declaration, the mutation log of a replication
+ * primary.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef REPLICATIONLOG_H_
+#define REPLICATIONLOG_H_
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ReplicationLog
+ * @brief Numbered, bounded in-memory log of applied mutations.
+ *
+ * Every mutation gets the next log sequence number (LSN), starting at 1, in
+ * the order the writer thread applied it. Only the newest records are kept:
+ * a follower that is further behind needs a snapshot instead. The epoch is
+ * random per log, so a follower notices when the primary restarted and its
+ * sequence numbers no longer match.
+ */
+class ReplicationLog
+{
+public:
+	/**
+	 * @struct Entry
+	 * @brief One applied mutation.
+	 */
+	struct Entry
+	{
+		std::uint64_t lsn; ///< Log sequence number.
+		std::int64_t commitTime; ///< Time of the append in ms since 1970.
+		std::uint8_t operation; ///< StudentProtocol::Operation of the mutation.
+		std::string payload; ///< Request payload replaying the mutation.
+	};
+
+private:
+	std::uint64_t epoch; ///< Random id of this log.
+	std::size_t capacity; ///< Number of records kept.
+	mutable std::mutex mutex; ///< Guards the members below.
+	std::deque<Entry> entries; ///< The kept records, oldest first.
+	std::uint64_t lastLsn = 0; ///< Number of the newest record.
+	std::function<void()> listener; ///< Called after each append.
+
+public:
+	/**
+	 * @brief Creates an empty log.
+	 * @param capacity Number of records kept for followers that fall behind.
+	 */
+	explicit ReplicationLog(std::size_t capacity = 100000);
+
+	/**
+	 * @brief Returns the random id of the log.
+	 * @return The epoch.
+	 */
+	std::uint64_t getEpoch() const;
+
+	/**
+	 * @brief Returns the number of the newest record.
+	 * @return The last LSN, 0 while the log is empty.
+	 */
+	std::uint64_t getLastLsn() const;
+
+	/**
+	 * @brief Appends a mutation and drops the oldest record if the log is
+	 * full.
+	 * @param operation Operation of the mutation.
+	 * @param payload Payload replaying it.
+	 * @return The LSN of the record.
+	 */
+	std::uint64_t append(std::uint8_t operation, std::string_view payload);
+
+	/**
+	 * @brief Copies the records following a sequence number.
+	 * @param after LSN the reader already has.
+	 * @param maxEntries Upper bound of copied records.
+	 * @param out Receives the records, appended.
+	 * @return False if records after the given LSN were already dropped.
+	 */
+	bool read(std::uint64_t after, std::size_t maxEntries,
+			std::vector<Entry> &out) const;
+
+	/**
+	 * @brief Sets the function called after each append, outside the lock.
+	 * @param listener The function, empty to remove it.
+	 */
+	void setListener(std::function<void()> listener);
+
+	/**
+	 * @brief Returns the current time as used for commit times.
+	 * @return Milliseconds since 1970.
+	 */
+	static std::int64_t now();
+};
+
+#endif /* REPLICATIONLOG_H_ */
@@ -0,0 +1,407 @@
+/**
+ * @file ReplicationPrimary.cpp
+ * @brief ReplicationPrimary class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "ReplicationPrimary.h"
+#include <algorithm>
+#include <sstream>
+#include "SocketChannel.h"
+#include "StudentProtocol.h"
+
+using boost::asio::ip::tcp;
+
+/**
+ * @brief Bytes of snapshot data per frame.
+ */
+static const std::size_t snapshotChunk = 60000;
+
+/**
+ * @brief Queued bytes per follower before no more records are taken from
+ * the log.
+ */
+static const std::size_t maxOutbox = 1 << 20;
+
+/**
+ * @class ReplicationPrimary::Session
+ * @brief State of one follower, only touched on the io thread.
+ */
+class ReplicationPrimary::Session: public std::enable_shared_from_this<
+		ReplicationPrimary::Session>
+{
+private:
+	ReplicationPrimary &primary; ///< Primary owning the log.
+	SocketChannel channel; ///< Socket of the follower.
+	std::vector<ReplicationLog::Entry> entries; ///< Records taken from the log.
+	std::uint64_t sentLsn = 0; ///< Last record queued for the follower.
+	bool streaming = false; ///< Set once the follower may receive records.
+	bool followed = false; ///< Set once FOLLOW was received.
+
+	void read()
+	{
+		auto self = shared_from_this();
+		this->channel.read([self](const boost::system::error_code &error)
+		{
+			if (error || !self->receive())
+			{
+				self->close();
+				return;
+			}
+			self->read();
+		});
+	}
+
+	/**
+	 * @brief Handles the FOLLOW frame, the follower sends nothing else.
+	 * @return False if the follower broke the protocol.
+	 */
+	bool receive()
+	{
+		std::string &input = this->channel.getInput();
+		if (this->followed)
+		{
+			input.clear();
+			return true;
+		}
+		std::size_t size;
+		if (!StudentProtocol::frameSize(input, size))
+		{
+			return true;
+		}
+		if (size < StudentProtocol::headerSize || size > 64)
+		{
+			return false;
+		}
+		if (input.size() < size)
+		{
+			return true;
+		}
+		std::uint32_t requestId;
+		std::uint8_t code;
+		StudentProtocol::Reader request(
+				StudentProtocol::split(std::string_view(input).substr(0, size),
+						requestId, code));
+		std::uint64_t epoch, lsn;
+		if (code != StudentProtocol::FOLLOW || !request.u64(epoch)
+				|| !request.u64(lsn) || !request.complete())
+		{
+			return false;
+		}
+		input.clear();
+		this->followed = true;
+		std::vector<ReplicationLog::Entry> none;
+		if (epoch == this->primary.log.getEpoch()
+				&& this->primary.log.read(lsn, 0, none))
+		{
+			this->sentLsn = lsn;
+			this->streaming = true;
+			this->pump();
+		}
+		else
+		{
+			this->requestSnapshot();
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Has the writer thread copy the database and sends it.
+	 */
+	void requestSnapshot()
+	{
+		this->streaming = false;
+		std::weak_ptr<Session> weak = shared_from_this();
+		ReplicationLog &log = this->primary.log;
+		boost::asio::io_context &ioContext = this->primary.ioContext;
+		this->primary.pipeline.execute([weak, &log, &ioContext](StudentDb &db)
+		{
+			if (weak.expired())
+			{
+				return;
+			}
+			auto data = std::make_shared<std::string>();
+			std::uint64_t lsn = 0;
+			try
+			{
+				// The log is appended on this thread, so the snapshot
+				// contains exactly the records up to lsn.
+				std::ostringstream out;
+				db.write(out);
+				*data = out.str();
+				lsn = log.getLastLsn();
+			}
+			catch (const std::exception&)
+			{
+				data.reset();
+			}
+			boost::asio::post(ioContext, [weak, data, lsn]
+			{
+				if (auto self = weak.lock())
+				{
+					if (data)
+					{
+						self->sendSnapshot(*data, lsn);
+					}
+					else
+					{
+						self->close();
+					}
+				}
+			});
+		});
+	}
+
+	void sendSnapshot(const std::string &data, std::uint64_t lsn)
+	{
+		if (this->channel.isClosed())
+		{
+			return;
+		}
+		std::string &outbox = this->channel.getOutbox();
+		StudentProtocol::Writer begin(outbox, 0, StudentProtocol::SNAPSHOT);
+		begin.u64(this->primary.log.getEpoch());
+		begin.u64(lsn);
+		begin.finish();
+		for (std::size_t offset = 0; offset < data.size(); offset +=
+				snapshotChunk)
+		{
+			StudentProtocol::Writer part(outbox, 0,
+					StudentProtocol::SNAPSHOT_DATA);
+			part.bytes(std::string_view(data).substr(offset, snapshotChunk));
+			part.finish();
+		}
+		StudentProtocol::Writer(outbox, 0, StudentProtocol::SNAPSHOT_END).finish();
+		++this->primary.snapshotsSent;
+		this->sentLsn = lsn;
+		this->streaming = true;
+		this->pump();
+	}
+
+	void flush()
+	{
+		auto self = shared_from_this();
+		this->channel.write([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			self->pump();
+		});
+	}
+
+	void close()
+	{
+		this->channel.close();
+	}
+
+public:
+	Session(ReplicationPrimary &primary, tcp::socket socket) :
+			primary(primary), channel(std::move(socket))
+	{
+		++this->primary.followersAccepted;
+		++this->primary.followersConnected;
+	}
+
+	void start()
+	{
+		boost::system::error_code ignored;
+		this->channel.getSocket().set_option(tcp::no_delay(true), ignored);
+		this->read();
+	}
+
+	/**
+	 * @brief Queues the records the follower does not have yet, as far as
+	 * the outbox allows, and sends them.
+	 */
+	void pump()
+	{
+		std::string &outbox = this->channel.getOutbox();
+		while (this->streaming && !this->channel.isClosed()
+				&& outbox.size() < maxOutbox)
+		{
+			this->entries.clear();
+			if (!this->primary.log.read(this->sentLsn, 1024, this->entries))
+			{
+				// The follower fell out of the log.
+				this->requestSnapshot();
+				break;
+			}
+			if (this->entries.empty())
+			{
+				break;
+			}
+			for (const ReplicationLog::Entry &entry : this->entries)
+			{
+				StudentProtocol::Writer record(outbox, 0,
+						StudentProtocol::RECORD);
+				record.u64(entry.lsn);
+				record.u64(static_cast<std::uint64_t>(entry.commitTime));
+				record.u8(entry.operation);
+				record.bytes(entry.payload);
+				record.finish();
+			}
+			this->sentLsn = this->entries.back().lsn;
+			this->primary.recordsShipped += this->entries.size();
+		}
+		this->flush();
+	}
+
+	/**
+	 * @brief Queues a heartbeat and sends it.
+	 */
+	void beat()
+	{
+		if (!this->streaming || this->channel.isClosed())
+		{
+			return;
+		}
+		StudentProtocol::Writer beat(this->channel.getOutbox(), 0,
+				StudentProtocol::HEARTBEAT);
+		beat.u64(this->primary.log.getLastLsn());
+		beat.u64(static_cast<std::uint64_t>(ReplicationLog::now()));
+		beat.finish();
+		this->flush();
+	}
+
+	~Session()
+	{
+		--this->primary.followersConnected;
+	}
+};
+
+ReplicationPrimary::ReplicationPrimary(MutationPipeline &pipeline,
+		ReplicationLog &log, const std::string &address, unsigned short port) :
+		pipeline(pipeline), log(log), followersAccepted(0), followersConnected(
+				0), snapshotsSent(0), recordsShipped(0), pumpScheduled(false), acceptor(
+				ioContext,
+				tcp::endpoint(boost::asio::ip::make_address(address), port)), heartbeat(
+				ioContext)
+{
+	this->log.setListener([this]
+	{
+		// Coalesces the appends of a batch into one pass over the followers.
+		if (!this->pumpScheduled.exchange(true))
+		{
+			boost::asio::post(this->ioContext, [this]
+			{
+				this->pumpScheduled = false;
+				this->pumpAll();
+			});
+		}
+	});
+	this->accept();
+	this->scheduleHeartbeat();
+	this->worker = std::thread([this]
+	{
+		this->ioContext.run();
+	});
+}
+
+void ReplicationPrimary::accept()
+{
+	this->acceptor.async_accept(
+			[this](const boost::system::error_code &error, tcp::socket socket)
+			{
+				if (error)
+				{
+					return;
+				}
+				auto session = std::make_shared<Session>(*this, std::move(socket));
+				this->sessions.push_back(session);
+				session->start();
+				this->accept();
+			});
+}
+
+void ReplicationPrimary::scheduleHeartbeat()
+{
+	this->heartbeat.expires_after(std::chrono::milliseconds(100));
+	this->heartbeat.async_wait([this](const boost::system::error_code &error)
+	{
+		if (error)
+		{
+			return;
+		}
+		this->sessions.erase(
+				std::remove_if(this->sessions.begin(), this->sessions.end(),
+						[](const std::weak_ptr<Session> &session)
+						{
+							return session.expired();
+						}), this->sessions.end());
+		for (const auto &weak : this->sessions)
+		{
+			if (auto session = weak.lock())
+			{
+				session->beat();
+			}
+		}
+		this->scheduleHeartbeat();
+	});
+}
+
+void ReplicationPrimary::pumpAll()
+{
+	for (const auto &weak : this->sessions)
+	{
+		if (auto session = weak.lock())
+		{
+			session->pump();
+		}
+	}
+}
+
+StudentServer::Hooks ReplicationPrimary::getHooks()
+{
+	StudentServer::Hooks hooks;
+	ReplicationLog &log = this->log;
+	hooks.logMutation = [&log](std::uint8_t operation, std::string_view payload)
+	{
+		log.append(operation, payload);
+	};
+	hooks.status = [&log]
+	{
+		std::uint64_t lsn = log.getLastLsn();
+		return StudentProtocol::ReplicationStatus
+		{ StudentProtocol::PRIMARY, lsn, lsn, 0 };
+	};
+	return hooks;
+}
+
+unsigned short ReplicationPrimary::getPort() const
+{
+	return this->acceptor.local_endpoint().port();
+}
+
+ReplicationPrimary::Statistics ReplicationPrimary::getStatistics() const
+{
+	Statistics statistics;
+	statistics.followersAccepted = this->followersAccepted;
+	statistics.followersConnected = this->followersConnected;
+	statistics.snapshotsSent = this->snapshotsSent;
+	statistics.recordsShipped = this->recordsShipped;
+	return statistics;
+}
+
+void ReplicationPrimary::stop()
+{
+	if (!this->worker.joinable())
+	{
+		return;
+	}
+	this->log.setListener(nullptr);
+	this->ioContext.stop();
+	this->worker.join();
+	// Snapshot commands still queued refer to the io_context.
+	this->pipeline.flush().wait();
+	boost::system::error_code ignored;
+	this->acceptor.close(ignored);
+}
+
+ReplicationPrimary::~ReplicationPrimary()
+{
+	this->stop();
+}
@@ -0,0 +1,124 @@
+/**
+ * @file ReplicationPrimary.h
+ * @brief ReplicationPrimary class declaration for shipping the mutation log
+ * to read replicas.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef REPLICATIONPRIMARY_H_
+#define REPLICATIONPRIMARY_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include "MutationPipeline.h"
+#include "ReplicationLog.h"
+#include "StudentServer.h"
+
+/**
+ * @class ReplicationPrimary
+ * @brief Streams the ReplicationLog of a server to ReplicaFollower processes.
+ *
+ * A follower connects and names the log epoch and the last sequence number
+ * it has. If the log still holds everything after it, the primary streams
+ * from there, so a restarted follower only receives what it missed.
+ * Otherwise the follower first gets a snapshot of the database, taken on
+ * the writer thread together with the sequence number it includes. Records
+ * are sent as the writer thread applies them, heartbeats report the end of
+ * the log every 100 ms.
+ *
+ * All followers are served by one thread. A follower that falls out of the
+ * log gets a new snapshot.
+ */
+class ReplicationPrimary
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Counters of the primary.
+	 */
+	struct Statistics
+	{
+		unsigned long long followersAccepted; ///< Followers connected so far.
+		unsigned int followersConnected; ///< Followers connected now.
+		unsigned long long snapshotsSent; ///< Snapshots sent.
+		unsigned long long recordsShipped; ///< Log records sent.
+	};
+
+private:
+	class Session;
+
+	MutationPipeline &pipeline; ///< Pipeline applying the mutations.
+	ReplicationLog &log; ///< Log of the applied mutations.
+	std::atomic<unsigned long long> followersAccepted; ///< Counter of followers.
+	std::atomic<unsigned int> followersConnected; ///< Followers connected now.
+	std::atomic<unsigned long long> snapshotsSent; ///< Counter of snapshots.
+	std::atomic<unsigned long long> recordsShipped; ///< Counter of records.
+	std::atomic<bool> pumpScheduled; ///< Set while a pumpAll() is posted.
+	boost::asio::io_context ioContext; ///< Runs all follower sockets.
+	boost::asio::ip::tcp::acceptor acceptor; ///< Listening socket.
+	boost::asio::steady_timer heartbeat; ///< Timer of the heartbeats.
+	std::vector<std::weak_ptr<Session>> sessions; ///< Followers, touched by the io thread only.
+	std::thread worker; ///< Thread running the io_context.
+
+	/**
+	 * @brief Waits for the next follower.
+	 */
+	void accept();
+
+	/**
+	 * @brief Sends a heartbeat to every follower and rearms the timer.
+	 */
+	void scheduleHeartbeat();
+
+	/**
+	 * @brief Lets every follower send the records appended since.
+	 */
+	void pumpAll();
+
+public:
+	/**
+	 * @brief Starts accepting followers.
+	 * @param pipeline Pipeline of the served database, must outlive the
+	 * primary.
+	 * @param log Log the server appends to, see getHooks().
+	 * @param address Address to listen on.
+	 * @param port TCP port, 0 picks a free one.
+	 */
+	ReplicationPrimary(MutationPipeline &pipeline, ReplicationLog &log,
+			const std::string &address, unsigned short port);
+
+	ReplicationPrimary(const ReplicationPrimary&) = delete;
+	ReplicationPrimary& operator=(const ReplicationPrimary&) = delete;
+
+	/**
+	 * @brief Returns the hooks for the StudentServer of the primary.
+	 * @return Hooks that append to the log and report the primary's status.
+	 */
+	StudentServer::Hooks getHooks();
+
+	/**
+	 * @brief Returns the port followers connect to.
+	 * @return The bound port.
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * @brief Returns the counters.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Disconnects all followers and stops the thread.
+	 */
+	void stop();
+
+	virtual ~ReplicationPrimary();
+};
+
+#endif /* REPLICATIONPRIMARY_H_ */
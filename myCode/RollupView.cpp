@@ -0,0 +1,98 @@
+/**
+ * @file RollupView.cpp
+ * @brief RollupView class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "RollupView.h"
+
+bool RollupView::Key::operator<(const Key &other) const
+{
+	if (this->semester != other.semester)
+	{
+		return this->semester < other.semester;
+	}
+	if (this->major != other.major)
+	{
+		return this->major < other.major;
+	}
+	return this->courseKey < other.courseKey;
+}
+
+double RollupView::Group::averageGrade() const
+{
+	return this->gradedCount > 0 ? this->gradeSum / this->gradedCount : 0.0;
+}
+
+RollupView::RollupView(unsigned int dimensions) :
+		dimensions(dimensions)
+{
+}
+
+RollupView::Key RollupView::keyOf(const Enrollment &enrollment) const
+{
+	Key key =
+	{ "", "", 0 };
+	if (this->dimensions & SEMESTER)
+	{
+		key.semester = enrollment.getSemester();
+	}
+	if (this->dimensions & MAJOR)
+	{
+		key.major = enrollment.getCourse()->getMajor();
+	}
+	if (this->dimensions & COURSE)
+	{
+		key.courseKey = enrollment.getCourse()->getCourseKey();
+	}
+	return key;
+}
+
+void RollupView::countEnrollment(const Enrollment &enrollment, int sign)
+{
+	auto it = this->groups.insert(std::make_pair(keyOf(enrollment), Group())).first;
+	it->second.enrollmentCount += sign;
+	if (it->second.enrollmentCount == 0)
+	{
+		this->groups.erase(it);
+	}
+}
+
+void RollupView::countGrade(const Enrollment &enrollment, int sign)
+{
+	float grade = enrollment.getGrade();
+	if (grade == 0)
+	{
+		return;
+	}
+	Group &group = this->groups[keyOf(enrollment)];
+	group.gradedCount += sign;
+	group.gradeSum = group.gradedCount > 0 ? group.gradeSum + sign * grade : 0.0;
+}
+
+void RollupView::merge(const RollupView &other)
+{
+	for (const auto &entry : other.groups)
+	{
+		Group &group = this->groups[entry.first];
+		group.enrollmentCount += entry.second.enrollmentCount;
+		group.gradedCount += entry.second.gradedCount;
+		group.gradeSum += entry.second.gradeSum;
+	}
+}
+
+void RollupView::clear()
+{
+	this->groups.clear();
+}
+
+unsigned int RollupView::getDimensions() const
+{
+	return this->dimensions;
+}
+
+const std::map<RollupView::Key, RollupView::Group>& RollupView::getGroups() const
+{
+	return this->groups;
+}
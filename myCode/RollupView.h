@@ -0,0 +1,123 @@
+/**
+ * @file RollupView.h
+ * @brief RollupView class declaration for materialized enrollment aggregates.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef ROLLUPVIEW_H_
+#define ROLLUPVIEW_H_
+
+#include <map>
+#include <string>
+#include "Enrollment.h"
+
+/**
+ * @class RollupView
+ * @brief Enrollment counts and grade sums grouped by a set of dimensions.
+ *
+ * The view is kept up to date by feeding it every enrollment and grade
+ * change, reading it costs nothing beyond iterating the groups.
+ */
+class RollupView
+{
+public:
+	/**
+	 * @enum Dimension
+	 * @brief Attributes to group by, combined as a bit mask.
+	 */
+	enum Dimension
+	{
+		SEMESTER = 1, ///< Semester of the enrollment.
+		MAJOR = 2, ///< Major of the course.
+		COURSE = 4 ///< Course key.
+	};
+
+	/**
+	 * @struct Key
+	 * @brief Group identifier, unused dimensions stay empty or 0.
+	 */
+	struct Key
+	{
+		std::string semester; ///< Semester, if grouped by semester.
+		std::string major; ///< Major, if grouped by major.
+		unsigned int courseKey; ///< Course key, if grouped by course.
+
+		/**
+		 * @brief Orders by semester, major, course key.
+		 * @param other Key to compare with.
+		 * @return True if this key sorts before other.
+		 */
+		bool operator<(const Key &other) const;
+	};
+
+	/**
+	 * @struct Group
+	 * @brief Aggregates of one group.
+	 */
+	struct Group
+	{
+		std::size_t enrollmentCount = 0; ///< Number of enrollments.
+		std::size_t gradedCount = 0; ///< Number of graded enrollments.
+		double gradeSum = 0.0; ///< Sum of the grades.
+
+		/**
+		 * @brief Computes the mean grade.
+		 * @return Mean over the graded enrollments, 0 without grades.
+		 */
+		double averageGrade() const;
+	};
+
+private:
+	unsigned int dimensions; ///< Bit mask of Dimension values.
+	std::map<Key, Group> groups; ///< Non-empty groups in key order.
+
+	/**
+	 * @brief Builds the group key of an enrollment.
+	 * @param enrollment The enrollment.
+	 * @return Key with the view's dimensions filled in.
+	 */
+	Key keyOf(const Enrollment &enrollment) const;
+
+public:
+	/**
+	 * @brief Creates an empty view.
+	 * @param dimensions Bit mask of Dimension values to group by.
+	 */
+	explicit RollupView(unsigned int dimensions);
+
+	/**
+	 * @brief Adds or removes an enrollment, without its grade.
+	 * @param enrollment The enrollment.
+	 * @param sign 1 to add, -1 to remove.
+	 */
+	void countEnrollment(const Enrollment &enrollment, int sign);
+
+	/**
+	 * @brief Adds or removes the grade of an enrollment, ungraded ones are ignored.
+	 * @param enrollment The enrollment.
+	 * @param sign 1 to add, -1 to remove.
+	 */
+	void countGrade(const Enrollment &enrollment, int sign);
+
+	/**
+	 * @brief Adds the groups of another view with the same dimensions.
+	 * @param other Partial view, e.g. built by another thread.
+	 */
+	void merge(const RollupView &other);
+
+	/**
+	 * @brief Drops all groups.
+	 */
+	void clear();
+
+	unsigned int getDimensions() const;
+
+	/**
+	 * @brief Returns the materialized groups.
+	 * @return Groups in key order.
+	 */
+	const std::map<Key, Group>& getGroups() const;
+};
+
+#endif /* ROLLUPVIEW_H_ */
@@ -0,0 +1,51 @@
+/**
+ * @file ShardMap.cpp
+ * @brief ShardMap class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "ShardMap.h"
+#include <algorithm>
+#include <limits>
+
+ShardMap::ShardMap(unsigned int shardCount, unsigned int rangeSize,
+		unsigned int firstMatrikel) :
+		shardCount(std::max(shardCount, 1u)), rangeSize(std::max(rangeSize, 1u)), firstMatrikel(
+				firstMatrikel)
+{
+}
+
+unsigned int ShardMap::getShardCount() const
+{
+	return this->shardCount;
+}
+
+unsigned int ShardMap::first(unsigned int shard) const
+{
+	unsigned long long first = this->firstMatrikel
+			+ static_cast<unsigned long long>(shard) * this->rangeSize;
+	return static_cast<unsigned int>(std::min<unsigned long long>(first,
+			std::numeric_limits<unsigned int>::max()));
+}
+
+unsigned int ShardMap::last(unsigned int shard) const
+{
+	if (shard + 1 >= this->shardCount)
+	{
+		return std::numeric_limits<unsigned int>::max();
+	}
+	return this->first(shard + 1) - 1;
+}
+
+bool ShardMap::shardOf(unsigned int matrikelNumber, unsigned int &shard) const
+{
+	if (matrikelNumber < this->firstMatrikel)
+	{
+		return false;
+	}
+	shard = static_cast<unsigned int>(std::min<unsigned long long>(
+			(matrikelNumber - this->firstMatrikel) / this->rangeSize,
+			this->shardCount - 1));
+	return true;
+}
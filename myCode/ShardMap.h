@@ -0,0 +1,67 @@
+/**
+ * @file ShardMap.h
+ * @brief ShardMap class declaration, the matrikel ranges of a sharded
+ * deployment.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef SHARDMAP_H_
+#define SHARDMAP_H_
+
+/**
+ * @class ShardMap
+ * @brief Splits the matrikel numbers into consecutive ranges of equal size.
+ *
+ * Shard i holds the students from first(i) to last(i), the last shard
+ * ends at the largest matrikel number. Shards and router compute the same
+ * map from the shard count and range size.
+ */
+class ShardMap
+{
+private:
+	unsigned int shardCount; ///< Number of shards.
+	unsigned int rangeSize; ///< Matrikel numbers per shard.
+	unsigned int firstMatrikel; ///< Start of the range of shard 0.
+
+public:
+	/**
+	 * @brief Creates the map.
+	 * @param shardCount Number of shards, at least 1.
+	 * @param rangeSize Matrikel numbers per shard, at least 1.
+	 * @param firstMatrikel Start of the range of shard 0, the first number
+	 * Student hands out by default.
+	 */
+	ShardMap(unsigned int shardCount, unsigned int rangeSize,
+			unsigned int firstMatrikel = 100000);
+
+	/**
+	 * @brief Returns the number of shards.
+	 * @return The shard count.
+	 */
+	unsigned int getShardCount() const;
+
+	/**
+	 * @brief Returns the smallest matrikel number of a shard.
+	 * @param shard Index of the shard.
+	 * @return First number of its range.
+	 */
+	unsigned int first(unsigned int shard) const;
+
+	/**
+	 * @brief Returns the largest matrikel number of a shard.
+	 * @param shard Index of the shard.
+	 * @return Last number of its range.
+	 */
+	unsigned int last(unsigned int shard) const;
+
+	/**
+	 * @brief Finds the shard holding a matrikel number.
+	 * @param matrikelNumber The matrikel number.
+	 * @param shard Receives the index of the shard.
+	 * @return False if the number lies before the first range.
+	 */
+	bool shardOf(unsigned int matrikelNumber, unsigned int &shard) const;
+};
+
+#endif /* SHARDMAP_H_ */
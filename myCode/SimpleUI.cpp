@@ -10,8 +10,29 @@
 
 using namespace std;
 
-SimpleUI::SimpleUI(StudentDb &db) :
-		studentDb(db)
+/**
+ * @brief Commands of a batch script, in the order of the summary.
+ */
+enum BatchCommand
+{
+	BATCH_ADD, BATCH_ENROLL, BATCH_GRADE, BATCH_LOAD, BATCH_SAVE, BATCH_SEARCH, batchCommandCount
+};
+
+/**
+ * @brief Script names of the batch commands.
+ */
+static const char *const batchCommandNames[batchCommandCount] =
+{ "add", "enroll", "grade", "load", "save", "search" };
+
+/**
+ * @brief Batch output collected before it is written.
+ */
+static const size_t batchOutputBlock = 1 << 16;
+
+SimpleUI::SimpleUI(StudentDb &db, const string &generatorHost,
+		const string &generatorPort) :
+		studentDb(db), generatorHost(generatorHost), generatorPort(
+				generatorPort)
 {
 }
 
@@ -93,6 +114,12 @@ void SimpleUI::run()
 				"4. Add enrollment\n5. Print student\n6. Search student\n"
 				"7. Update student\n8. Write to file "
 				"\n9. Read from file \n10. Generate server data"
+				"\n11. Show statistics\n12. List students by name"
+				"\n13. Query students\n14. Top students by GPA"
+				"\n15. Course statistics\n16. Enrollment rollups"
+				"\n17. Timetable clash report\n18. Free time of a student"
+				"\n19. Bulk import through the ingestion pipeline"
+				"\n20. Serve the database over TCP"
 				"\n0. Exit\nEnter choice: ";
 		cin >> choice;
 
@@ -128,6 +155,36 @@ void SimpleUI::run()
 		case 10:
 			generateStudentData();
 			break;
+		case 11:
+			printStatistics();
+			break;
+		case 12:
+			listStudentsByName();
+			break;
+		case 13:
+			queryStudents();
+			break;
+		case 14:
+			printTopStudents();
+			break;
+		case 15:
+			listCourseStatistics();
+			break;
+		case 16:
+			printRollup();
+			break;
+		case 17:
+			printClashReport();
+			break;
+		case 18:
+			printFreeTime();
+			break;
+		case 19:
+			runIngestionPipeline();
+			break;
+		case 20:
+			runServer();
+			break;
 
 		case 0:
 			cout << "Exiting..." << endl;
@@ -147,23 +204,493 @@ void SimpleUI::generateStudentData()
 	cout << "Enter the number of students to generate data for: ";
 	cin >> studentCount;
 
-	boost::asio::ip::tcp::iostream stream;
-	stream.connect("www.hhs.users.h-da.cloud", "4242");
+	unsigned int connections;
+	cout << "Enter the number of connections: ";
+	cin >> connections;
+
+	unsigned int window;
+	cout << "Enter the number of requests to keep in flight per connection "
+			"(1 = one at a time, up to " << GeneratorClient::maxWindow << "): ";
+	cin >> window;
+
+	char useLocal;
+	cout << "Use the local stand-in server? (y/n): ";
+	cin >> useLocal;
+
+	std::unique_ptr<GeneratorServer> localServer;
+	string host = this->generatorHost;
+	string port = this->generatorPort;
+	if (useLocal == 'y' || useLocal == 'Y')
+	{
+		unsigned int latency;
+		cout << "Enter the simulated round trip time in ms: ";
+		cin >> latency;
+		double malformedRate;
+		cout << "Enter the share of malformed records (0 to 1): ";
+		cin >> malformedRate;
+		GeneratorServer::Settings settings =
+		{ std::chrono::milliseconds(latency), 0, malformedRate };
+		localServer.reset(new GeneratorServer(0, settings));
+		host = "127.0.0.1";
+		port = to_string(localServer->getPort());
+	}
 
-	for (unsigned int i = 0; i < studentCount; i++)
+	if (connections > 1)
+	{
+		importStudentData(host, port, studentCount, connections, window);
+	}
+	else
 	{
+		fetchStudentData(host, port, studentCount, window);
+	}
+}
 
-		stream << "generate" << endl;
-		stream.flush();
-		string line1, line2, line3;
-		getline(stream, line1);
-		getline(stream, line2);
-		parseData(line2);
+void SimpleUI::fetchStudentData(const string &host, const string &port,
+		unsigned int studentCount, unsigned int window)
+{
+	// Records are parsed in batches on the scheduler while later ones are
+	// still arriving, then added in the order they were received.
+	const unsigned int batchSize = 64;
+	vector<string> records(studentCount);
+	vector<StudentRecord> students(studentCount);
+	vector<char> valid(studentCount, 0);
+	vector<future<void>> batches;
+	unsigned int parsedUpTo = 0;
+	auto parseBatch = [&](unsigned int end)
+	{
+		unsigned int begin = parsedUpTo;
+		auto task = make_shared<packaged_task<void()>>(
+				[this, &records, &students, &valid, begin, end]
+				{
+					for (unsigned int i = begin; i < end; i++)
+					{
+						valid[i] = parseData(records[i], students[i]);
+					}
+				});
+		batches.push_back(task->get_future());
+		this->studentDb.getScheduler().submit([task]
+		{
+			(*task)();
+		});
+		parsedUpTo = end;
+	};
 
-		getline(stream, line3);
+	auto start = chrono::steady_clock::now();
+	unsigned int received = 0;
+	try
+	{
+		GeneratorClient client(host, port);
+		client.fetch(studentCount, window, [&](string &record)
+		{
+			records[received++].swap(record);
+			if (received - parsedUpTo == batchSize)
+			{
+				parseBatch(received);
+			}
+		});
+	} catch (const std::exception &e)
+	{
+		cout << e.what() << endl;
+	}
+	if (parsedUpTo < received)
+	{
+		parseBatch(received);
+	}
+	for (future<void> &batch : batches)
+	{
+		batch.wait();
+	}
+
+	vector<StudentRecord> accepted;
+	for (unsigned int i = 0; i < received; i++)
+	{
+		if (valid[i])
+		{
+			accepted.push_back(std::move(students[i]));
+		}
+	}
+	this->studentDb.addStudents(accepted);
+	unsigned int added = accepted.size();
+	auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+			chrono::steady_clock::now() - start);
+	cout << "Received " << received << " of " << studentCount
+			<< " records, added " << added << " students in "
+			<< elapsed.count() << " ms." << endl;
+}
+
+void SimpleUI::importStudentData(const string &host, const string &port,
+		unsigned int studentCount, unsigned int connections,
+		unsigned int window)
+{
+	unsigned int added = 0;
+	try
+	{
+		StudentImporter importer(host, port, connections, window);
+		StudentImporter::Statistics statistics = importer.run(studentCount,
+				[this, &added](vector<string> &records)
+				{
+					added += addGeneratedStudents(records);
+				});
+		cout << "Received " << statistics.received << " of " << studentCount
+				<< " records over " << statistics.connectionsOpened
+				<< " connections (" << statistics.connectionsFailed
+				<< " failed), added " << added << " students, rejected "
+				<< statistics.received - added << "." << endl;
+		cout << fixed << setprecision(2) << "Time: " << statistics.seconds
+				<< " s, " << statistics.recordsPerSecond() << " records/s"
+				<< endl;
+		cout << "Request latency in ms: p50 " << statistics.latency.p50
+				<< ", p90 " << statistics.latency.p90 << ", p99 "
+				<< statistics.latency.p99 << ", max " << statistics.latency.max
+				<< endl;
+		cout << defaultfloat;
+	} catch (const std::exception &e)
+	{
+		cout << e.what() << endl;
+	}
+}
+
+void SimpleUI::benchmarkImport(unsigned int studentCount,
+		unsigned int connections, unsigned int window,
+		const GeneratorServer::Settings *localSettings, bool pipeline)
+{
+	std::unique_ptr<GeneratorServer> localServer;
+	string host = this->generatorHost;
+	string port = this->generatorPort;
+	if (localSettings != nullptr)
+	{
+		localServer.reset(new GeneratorServer(0, *localSettings));
+		host = "127.0.0.1";
+		port = to_string(localServer->getPort());
+		cout << "Local generator: latency " << localSettings->latency.count()
+				<< " ms, payload " << localSettings->payloadSize
+				<< " bytes, malformed share " << localSettings->malformedRate
+				<< endl;
+	}
+	cout << "Importing " << studentCount << " students from " << host << ":"
+			<< port << " over " << connections << " connections, window "
+			<< window << endl;
+	if (pipeline)
+	{
+		IngestionPipeline ingestion(this->studentDb,
+				[this](const StudentRecord &student)
+				{
+					return this->recordValidator.isValid(student);
+				});
+		printPipelineStatistics(
+				ingestion.run(IngestionPipeline::JSON_LINES,
+						IngestionPipeline::fromGenerator(host, port,
+								studentCount, connections, window)));
+	}
+	else
+	{
+		importStudentData(host, port, studentCount, connections, window);
 	}
-	stream << "quit" << endl;
-	stream.flush();
+}
+
+void SimpleUI::serveDatabase(const string &address, unsigned short port,
+		unsigned int threads)
+{
+	StudentServer::Statistics statistics;
+	{
+		StudentServer server(this->studentDb, address, port, threads);
+		cout << "Serving " << address << ":" << server.getPort() << " with "
+				<< server.getThreadCount()
+				<< " threads, press Enter to stop." << endl;
+		string line;
+		getline(cin, line);
+		statistics = server.getStatistics();
+	}
+	this->queryCache.clear();
+	cout << statistics.connectionsAccepted << " connections, "
+			<< statistics.requests << " requests answered, "
+			<< statistics.mutations << " mutations, " << statistics.failures
+			<< " failed." << endl;
+}
+
+void SimpleUI::servePrimary(const string &address, unsigned short port,
+		unsigned int threads, unsigned short replicationPort,
+		size_t logEntries)
+{
+	StudentServer::Statistics statistics;
+	ReplicationPrimary::Statistics shipped;
+	{
+		MutationPipeline pipeline(this->studentDb);
+		ReplicationLog log(logEntries);
+		ReplicationPrimary primary(pipeline, log, address, replicationPort);
+		StudentServer server(pipeline, address, port, primary.getHooks(),
+				threads);
+		cout << "Serving " << address << ":" << server.getPort() << " with "
+				<< server.getThreadCount() << " threads, followers connect to "
+				<< address << ":" << primary.getPort() << "." << endl;
+		cout << "Press Enter for the replication status, q and Enter to stop."
+				<< endl;
+		string line;
+		while (getline(cin, line) && line != "q")
+		{
+			ReplicationPrimary::Statistics current = primary.getStatistics();
+			printReplicationStatus(primary.getHooks().status());
+			cout << current.followersConnected << " followers connected, "
+					<< current.snapshotsSent << " snapshots and "
+					<< current.recordsShipped << " records shipped." << endl;
+		}
+		statistics = server.getStatistics();
+		server.stop();
+		primary.stop();
+		shipped = primary.getStatistics();
+	}
+	this->queryCache.clear();
+	cout << statistics.connectionsAccepted << " connections, "
+			<< statistics.requests << " requests answered, "
+			<< statistics.mutations << " mutations, " << statistics.failures
+			<< " failed, " << shipped.followersAccepted << " followers served."
+			<< endl;
+}
+
+void SimpleUI::serveReplica(const string &primaryHost,
+		const string &primaryPort, const string &directory,
+		const string &address, unsigned short port, unsigned int threads)
+{
+	StudentServer::Statistics statistics;
+	{
+		MutationPipeline pipeline(this->studentDb);
+		ReplicaFollower follower(pipeline, primaryHost, primaryPort, directory);
+		ReplicaFollower::Statistics loaded = follower.getStatistics();
+		cout << "Loaded the replica up to log record " << loaded.appliedLsn
+				<< ", " << loaded.recordsReplayed
+				<< " records replayed from " << directory << "." << endl;
+		StudentServer server(pipeline, address, port, follower.getHooks(),
+				threads);
+		cout << "Serving a replica of " << primaryHost << ":" << primaryPort
+				<< " on " << address << ":" << server.getPort() << " with "
+				<< server.getThreadCount() << " threads." << endl;
+		cout << "Press Enter for the replication status, q and Enter to stop."
+				<< endl;
+		string line;
+		while (getline(cin, line) && line != "q")
+		{
+			ReplicaFollower::Statistics current = follower.getStatistics();
+			printReplicationStatus(follower.getStatus());
+			cout << (current.connected ? "Connected" : "Not connected")
+					<< ", " << current.connects << " connects, "
+					<< current.snapshotsLoaded << " snapshots loaded, "
+					<< current.recordsApplied << " records applied." << endl;
+		}
+		statistics = server.getStatistics();
+		server.stop();
+		follower.stop();
+	}
+	this->queryCache.clear();
+	cout << statistics.connectionsAccepted << " connections, "
+			<< statistics.requests << " requests answered, "
+			<< statistics.failures << " failed." << endl;
+}
+
+void SimpleUI::serveShard(const ShardMap &map, unsigned int shard,
+		const string &address, unsigned short port, unsigned int threads)
+{
+	// Adds continue in the shard's own range.
+	if (map.first(shard) > 0)
+	{
+		Student::skipMatrikelNumbersThrough(map.first(shard) - 1);
+	}
+	StudentServer::Hooks hooks;
+	hooks.lastMatrikel = map.last(shard);
+	StudentServer::Statistics statistics;
+	{
+		MutationPipeline pipeline(this->studentDb);
+		StudentServer server(pipeline, address, port, hooks, threads);
+		cout << "Serving shard " << shard << " of " << map.getShardCount()
+				<< ", matrikel numbers " << map.first(shard) << " to "
+				<< map.last(shard) << ", on " << address << ":"
+				<< server.getPort() << " with " << server.getThreadCount()
+				<< " threads, press Enter to stop." << endl;
+		string line;
+		getline(cin, line);
+		statistics = server.getStatistics();
+	}
+	this->queryCache.clear();
+	cout << statistics.connectionsAccepted << " connections, "
+			<< statistics.requests << " requests answered, "
+			<< statistics.mutations << " mutations, " << statistics.failures
+			<< " failed." << endl;
+}
+
+bool SimpleUI::splitShards(const string &file, const ShardMap &map)
+{
+	ifstream in(file);
+	if (!in || !this->studentDb.read(in, &this->recordValidator, nullptr, true))
+	{
+		cout << "Could not load " << file << endl;
+		return false;
+	}
+	for (unsigned int shard = 0; shard < map.getShardCount(); shard++)
+	{
+		string name = file + ".shard" + to_string(shard);
+		ofstream out(name);
+		this->studentDb.write(out, map.first(shard), map.last(shard));
+		if (!out)
+		{
+			cout << "Could not write " << name << endl;
+			return false;
+		}
+		cout << "Wrote matrikel numbers " << map.first(shard) << " to "
+				<< map.last(shard) << " to " << name << endl;
+	}
+	return true;
+}
+
+void SimpleUI::serveRouter(const vector<string> &shards,
+		unsigned int rangeSize, const string &address, unsigned short port,
+		unsigned int threads)
+{
+	StudentRouter::Statistics statistics;
+	{
+		StudentRouter router(shards, rangeSize, address, port, threads);
+		cout << "Routing " << address << ":" << router.getPort() << " to "
+				<< router.getShardCount() << " shards with "
+				<< router.getThreadCount() << " threads, press Enter to stop."
+				<< endl;
+		string line;
+		getline(cin, line);
+		statistics = router.getStatistics();
+	}
+	cout << statistics.connectionsAccepted << " connections, "
+			<< statistics.requests << " requests answered, "
+			<< statistics.forwarded << " forwarded, " << statistics.scattered
+			<< " sent to all shards, " << statistics.failures << " failed."
+			<< endl;
+}
+
+void SimpleUI::printReplicationStatus(
+		const StudentProtocol::ReplicationStatus &status)
+{
+	static const char *roles[] =
+	{ "standalone", "primary", "follower" };
+	cout << "Role " << (status.role <= StudentProtocol::FOLLOWER ?
+			roles[status.role] : "unknown") << ", applied log record "
+			<< status.appliedLsn << " of " << status.primaryLsn << ", lag "
+			<< status.primaryLsn - min(status.appliedLsn, status.primaryLsn)
+			<< " records / " << status.lagMilliseconds << " ms" << endl;
+}
+
+void SimpleUI::printServerStatus(const string &host, const string &port)
+{
+	using boost::asio::ip::tcp;
+	boost::asio::io_context ioContext;
+	tcp::resolver resolver(ioContext);
+	tcp::socket socket(ioContext);
+	boost::asio::connect(socket, resolver.resolve(host, port));
+	string frame;
+	StudentProtocol::Writer(frame, 1, StudentProtocol::STATUS).finish();
+	boost::asio::write(socket, boost::asio::buffer(frame));
+
+	frame.assign(StudentProtocol::lengthSize, '\0');
+	boost::asio::read(socket, boost::asio::buffer(&frame[0], frame.size()));
+	size_t size;
+	StudentProtocol::frameSize(frame, size);
+	if (size < StudentProtocol::headerSize
+			|| size - StudentProtocol::lengthSize > StudentProtocol::maxFrameSize)
+	{
+		throw runtime_error("Malformed response");
+	}
+	frame.resize(size);
+	boost::asio::read(socket,
+			boost::asio::buffer(&frame[StudentProtocol::lengthSize],
+					size - StudentProtocol::lengthSize));
+	uint32_t requestId;
+	uint8_t code;
+	StudentProtocol::Reader response(
+			StudentProtocol::split(frame, requestId, code));
+	StudentProtocol::ReplicationStatus status;
+	uint8_t role;
+	if (code != StudentProtocol::OK || !response.u8(role)
+			|| !response.u64(status.appliedLsn)
+			|| !response.u64(status.primaryLsn)
+			|| !response.u32(status.lagMilliseconds) || !response.complete())
+	{
+		throw runtime_error("Server answered STATUS with code " + to_string(code));
+	}
+	status.role = static_cast<StudentProtocol::Role>(role);
+	printReplicationStatus(status);
+}
+
+void SimpleUI::benchmarkServer(const string &host, const string &port,
+		StudentLoadClient::Settings settings, unsigned int localStudents)
+{
+	std::unique_ptr<StudentServer> localServer;
+	string serverHost = host;
+	string serverPort = port;
+	if (host.empty())
+	{
+		std::mt19937 random(localStudents);
+		for (unsigned int i = 0; i < localStudents; i++)
+		{
+			StudentRecord student;
+			StudentRecord::fromJson(GeneratorServer::randomRecord(random),
+					student);
+			unsigned int matrikelNumber = this->studentDb.addStudent(
+					student.firstName, student.lastName, student.dateOfBirth,
+					student.street, student.postalCode, student.city,
+					student.additionalInfo);
+			if (i == 0)
+			{
+				settings.firstMatrikel = matrikelNumber;
+			}
+			settings.lastMatrikel = matrikelNumber;
+		}
+		localServer.reset(new StudentServer(this->studentDb, "127.0.0.1", 0));
+		serverHost = "127.0.0.1";
+		serverPort = to_string(localServer->getPort());
+		cout << "Local server with " << localStudents << " students and "
+				<< localServer->getThreadCount() << " threads" << endl;
+	}
+	cout << "Sending " << settings.requests << " requests to " << serverHost
+			<< ":" << serverPort << " over " << settings.connections
+			<< " connections, window " << settings.window << ", "
+			<< settings.writeShare * 100 << " % writes, "
+			<< settings.searchShare * 100 << " % searches" << endl;
+
+	StudentLoadClient client(serverHost, serverPort, settings);
+	StudentLoadClient::Statistics stats = client.run();
+	cout << "Answered " << stats.answered << " of " << settings.requests
+			<< " requests (" << stats.notFound << " not found, " << stats.failed
+			<< " failed, " << stats.connectionsFailed
+			<< " connections failed)." << endl;
+	cout << fixed << setprecision(2) << "Time: " << stats.seconds << " s, "
+			<< stats.requestsPerSecond() << " requests/s" << endl;
+	cout << "Latency in ms: p50 " << stats.latency.p50 << ", p90 "
+			<< stats.latency.p90 << ", p99 " << stats.latency.p99 << ", max "
+			<< stats.latency.max << defaultfloat << endl;
+	if (localServer)
+	{
+		localServer->stop();
+		this->queryCache.clear();
+	}
+}
+
+unsigned int SimpleUI::addGeneratedStudents(vector<string> &records)
+{
+	vector<StudentRecord> students(records.size());
+	vector<char> valid(records.size(), 0);
+	this->studentDb.getScheduler().parallelFor(0, records.size(), 0,
+			[this, &records, &students, &valid](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					valid[i] = parseData(records[i], students[i]);
+				}
+			});
+	vector<StudentRecord> accepted;
+	for (size_t i = 0; i < records.size(); i++)
+	{
+		if (valid[i])
+		{
+			accepted.push_back(std::move(students[i]));
+		}
+	}
+	this->studentDb.addStudents(accepted);
+	return accepted.size();
 }
 
 void SimpleUI::addNewCourse()
@@ -438,6 +965,36 @@ void SimpleUI::listCourses()
 	}
 }
 
+void SimpleUI::listCourseStatistics()
+{
+	vector<StudentDb::CourseStatistics> list =
+			this->studentDb.listCourseStatistics();
+	if (list.empty())
+	{
+		cout << "No courses available." << endl;
+		return;
+	}
+	const map<int, unique_ptr<Course>> &courses = this->studentDb.getCourses();
+	for (const auto &stats : list)
+	{
+		cout << "\nCoursekey: " << stats.courseKey << "\nTitle: "
+				<< courses.at(stats.courseKey)->getTitle() << "\nEnrolled: "
+				<< stats.enrolledCount << "\nGraded: " << stats.gradedCount
+				<< "\nMean grade: " << fixed << setprecision(2)
+				<< stats.meanGrade << "\nStandard deviation: "
+				<< stats.standardDeviation << "\nPass rate: "
+				<< setprecision(1) << stats.passRate * 100.0 << " %"
+				<< "\nHistogram:";
+		for (size_t i = 0; i < stats.histogram.size(); ++i)
+		{
+			cout << "\n  " << 1.0 + i * 0.5 << "-"
+					<< (i + 1 < stats.histogram.size() ? 1.4 + i * 0.5 : 5.0)
+					<< ": " << stats.histogram[i];
+		}
+		cout << endl;
+	}
+}
+
 void SimpleUI::addNewStudent()
 {
 	string firstName;
@@ -511,6 +1068,24 @@ void SimpleUI::addEnrollment()
 			{
 				cout << "Enter semester: ";
 				cin >> semester;
+				vector<unsigned int> clashes = this->studentDb.findClashes(
+						matrikelNumber, courseKey, semester);
+				if (!clashes.empty())
+				{
+					string confirm;
+					cout << "Timetable clash with course(s):";
+					for (unsigned int clash : clashes)
+					{
+						cout << " " << clash;
+					}
+					cout << "\nEnroll anyway? (y/n): ";
+					cin >> confirm;
+					if (confirm != "y" && confirm != "Y")
+					{
+						cout << "Enrollment cancelled." << endl;
+						return;
+					}
+				}
 				this->studentDb.addEnrollment(matrikelNumber, courseKey,
 						semester);
 				cout << "Enrollment successfully done." << endl;
@@ -536,15 +1111,26 @@ void SimpleUI::addEnrollment()
 
 void SimpleUI::printStudent()
 {
+	string cached;
+	if (this->queryCache.lookup(this->studentDb, "print", [](const Student&)
+	{	return true;}, cached))
+	{
+		cout << cached;
+		return;
+	}
+
+	ostringstream report;
+	vector<unsigned int> shown;
 	const map<int, Student> students = this->studentDb.getStudents();
 	if (!students.empty())
 	{
 		for (const auto &student : students)
 		{
+			shown.push_back(student.first);
 			const auto studentObj = student.second;
 			const auto address = studentObj.getAddress();
 			const auto enrollments = studentObj.getEnrollments();
-			cout << "\nMatrikel Number: " << student.first << "\nFirst Name: "
+			report << "\nMatrikel Number: " << student.first << "\nFirst Name: "
 					<< studentObj.getFirstName() << "\nLast Name: "
 					<< studentObj.getLastName() << "\nDOB: " << setfill('0')
 					<< setw(2) << studentObj.getDateOfBirth().day() << "."
@@ -554,62 +1140,457 @@ void SimpleUI::printStudent()
 					<< address->getStreet() << ", " << address->getPostalCode()
 					<< ", " << address->getCity() << ", ";
 			if (!address->getAdditionalInfo().empty())
-				cout << address->getAdditionalInfo() << endl;
+				report << address->getAdditionalInfo() << endl;
 
 			if (!enrollments.empty())
 			{
 				for (const auto &enrollment : enrollments)
 				{
-					cout << "\nEnrollment Data\nCourse: "
+					report << "\nEnrollment Data\nCourse: "
 							<< enrollment.getCourse()->getCourseKey()
 							<< "\nSemester: " << enrollment.getSemester();
 
 					if (enrollment.getGrade() != 0)
 					{
-						cout<< "\nGrade: ";
-						cout << fixed << setprecision(1)
+						report<< "\nGrade: ";
+						report << fixed << setprecision(1)
 								<< enrollment.getGrade();
 					}
 
 				}
 			}
-			cout << endl;
+			report << endl;
 		}
 	}
 	else
-		(cout << "No students available.");
+		(report << "No students available.");
 
+	this->queryCache.store(this->studentDb, "print", shown, report.str());
+	cout << report.str();
 }
 
 void SimpleUI::searchStudent()
 {
 	string searchStr;
-	unsigned int found = 0;
 	cout << "Enter search string: ";
 	cin.ignore();
 	getline(cin, searchStr);
+	string ignoreCase;
+	cout << "Ignore case? (y/n): ";
+	cin >> ignoreCase;
 	cout << "Search Results: " << endl;
-	map<int, Student> students = this->studentDb.getStudents();
-	for (const auto &student : students)
+	bool folded = ignoreCase == "y" || ignoreCase == "Y";
+	QueryPredicate predicate =
+			folded ?
+					QueryPredicate::nameContainsIgnoreCase(searchStr) :
+					QueryPredicate::nameContains(searchStr);
+	string key = "search|" + predicate.describe();
+	string cached;
+	if (this->queryCache.lookup(this->studentDb, key,
+			[&predicate](const Student &student)
+			{	return predicate.matches(student);}, cached))
 	{
-		string fullName = student.second.getFirstName() + " "
-				+ student.second.getLastName();
-		if (fullName.find(searchStr) != string::npos)
+		cout << cached;
+		return;
+	}
+
+	ostringstream out;
+	vector<unsigned int> matches = this->studentDb.searchStudents(searchStr,
+			folded);
+	for (unsigned int matrikelNumber : matches)
+	{
+		const Student &student = this->studentDb.getStudent(matrikelNumber);
+		out << "\nFound: Matrikel Number: " << matrikelNumber << " Name: "
+				<< student.getFirstName() << " " << student.getLastName()
+				<< "\n";
+	}
+	if (matches.empty())
+	{
+		out << "Not Found";
+	}
+	out << "\n";
+	this->queryCache.store(this->studentDb, key, matches, out.str());
+	cout << out.str() << flush;
+}
+
+void SimpleUI::listStudentsByName()
+{
+	const size_t pageSize = 50;
+	string start;
+	string prefix;
+	unsigned int choice;
+	cout << "1. Start at last name\n2. Last name prefix\nEnter choice: ";
+	cin >> choice;
+	cout << "Enter last name (- for all): ";
+	cin.ignore();
+	getline(cin, start);
+	if (start == "-")
+		start = "";
+	if (choice == 2)
+		prefix = start;
+	else if (choice != 1)
+	{
+		cout << "Invalid option selected." << endl;
+		return;
+	}
+
+	StudentDb::NameKey cursor =
+	{ start, "", 0 };
+	string answer = "y";
+	while (answer == "y" || answer == "Y")
+	{
+		StudentDb::NamePage page = this->studentDb.listStudentsByName(cursor,
+				pageSize, prefix);
+		if (page.entries.empty())
+		{
+			cout << "No students found." << endl;
+			break;
+		}
+		for (const auto &entry : page.entries)
 		{
-			cout << "\nFound: Matrikel Number: " << student.first << " Name: "
-					<< student.second.getFirstName() << " "
-					<< student.second.getLastName() << endl;
-			++found;
+			cout << entry.matrikelNumber << " " << entry.lastName << ", "
+					<< entry.firstName << "\n";
+		}
+		if (!page.hasMore)
+		{
+			cout << "End of list." << endl;
+			break;
+		}
+		cout << "Show next page? (y/n): ";
+		cin >> answer;
+		cursor = page.nextCursor;
+	}
+}
+
+void SimpleUI::queryStudents()
+{
+	string queryString;
+	cout << "Conditions: city=X postal=LOW..HIGH born=DD.MM.YYYY..DD.MM.YYYY "
+			"course=KEY grade<X name~X last^X\nOptions: select=field,... "
+			"limit=N\nEnter query: ";
+	cin.ignore();
+	getline(cin, queryString);
+
+	StudentQuery query;
+	try
+	{
+		query = StudentQuery::parse(queryString);
+	} catch (const std::invalid_argument &e)
+	{
+		cout << "Query failed: " << e.what() << endl;
+		return;
+	}
+
+	string key = "query|" + query.normalize();
+	string cached;
+	if (this->queryCache.lookup(this->studentDb, key,
+			[&query](const Student &student)
+			{	return query.matches(student);}, cached))
+	{
+		cout << cached << "(served from cache)" << endl;
+		return;
+	}
+
+	StudentDb::QueryResult result = this->studentDb.executeQuery(query);
+	ostringstream out;
+	out << "Plan: " << result.plan << "\n";
+	for (size_t i = 0; i < result.columns.size(); ++i)
+	{
+		out << (i > 0 ? " | " : "") << result.columns[i];
+	}
+	out << "\n";
+	for (const auto &row : result.rows)
+	{
+		for (size_t i = 0; i < row.size(); ++i)
+		{
+			out << (i > 0 ? " | " : "") << row[i];
+		}
+		out << "\n";
+	}
+	out << result.rows.size() << " row(s)\n";
+	this->queryCache.store(this->studentDb, key, result.matrikelNumbers,
+			out.str());
+	cout << out.str() << flush;
+}
+
+void SimpleUI::printTopStudents()
+{
+	size_t count;
+	cout << "Number of students: ";
+	if (!(cin >> count))
+	{
+		cout << "Invalid number." << endl;
+		cin.clear();
+		cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+		return;
+	}
+
+	vector<StudentDb::GradeSummary> ranking =
+			this->studentDb.topStudentsByGpa(count);
+	size_t rank = 0;
+	for (const auto &summary : ranking)
+	{
+		const Student &student = this->studentDb.getStudent(
+				summary.matrikelNumber);
+		cout << ++rank << ". " << summary.matrikelNumber << " "
+				<< student.getFirstName() << " " << student.getLastName()
+				<< " GPA: " << fixed << setprecision(2) << summary.gpa
+				<< " Credits: " << setprecision(1) << summary.earnedCredits
+				<< "/" << summary.gradedCredits << endl;
+	}
+	if (ranking.empty())
+	{
+		cout << "No graded students." << endl;
+	}
+}
+
+void SimpleUI::printRollup()
+{
+	vector<string> names = this->studentDb.getRollupNames();
+	for (size_t i = 0; i < names.size(); ++i)
+	{
+		cout << i + 1 << ". " << names[i] << endl;
+	}
+	size_t choice;
+	cout << "Enter choice: ";
+	if (!(cin >> choice) || choice < 1 || choice > names.size())
+	{
+		cout << "Invalid choice." << endl;
+		cin.clear();
+		cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+		return;
+	}
+
+	const RollupView &view = this->studentDb.getRollup(names[choice - 1]);
+	unsigned int dimensions = view.getDimensions();
+	for (const auto &group : view.getGroups())
+	{
+		if (dimensions & RollupView::SEMESTER)
+		{
+			cout << group.first.semester << " | ";
+		}
+		if (dimensions & RollupView::MAJOR)
+		{
+			cout << group.first.major << " | ";
+		}
+		if (dimensions & RollupView::COURSE)
+		{
+			cout << group.first.courseKey << " | ";
+		}
+		cout << group.second.enrollmentCount << " enrollments | "
+				<< group.second.gradedCount << " graded | average "
+				<< fixed << setprecision(2) << group.second.averageGrade()
+				<< endl;
+	}
+	if (view.getGroups().empty())
+	{
+		cout << "No enrollments." << endl;
+	}
+}
+
+void SimpleUI::printClashReport()
+{
+	vector<StudentDb::Clash> clashes = this->studentDb.findAllClashes();
+	for (const auto &clash : clashes)
+	{
+		cout << "Matrikel Number: " << clash.matrikelNumber << " Semester: "
+				<< clash.semester << " Courses: " << clash.firstCourse
+				<< " / " << clash.secondCourse << endl;
+	}
+	cout << clashes.size() << " clash(es)" << endl;
+}
+
+void SimpleUI::runIngestionPipeline()
+{
+	int choice;
+	cout << "Import from\n1. Generator server\n2. JSON lines file"
+			"\n3. Database file\n";
+	cin >> choice;
+
+	IngestionPipeline::Format format = IngestionPipeline::JSON_LINES;
+	IngestionPipeline::Source source;
+	std::unique_ptr<GeneratorServer> localServer;
+	ifstream inFile;
+	if (choice == 1)
+	{
+		unsigned int studentCount, connections, window;
+		cout << "Enter the number of students: ";
+		cin >> studentCount;
+		cout << "Enter the number of connections: ";
+		cin >> connections;
+		cout << "Enter the number of requests in flight per connection: ";
+		cin >> window;
+		char useLocal;
+		cout << "Use the local stand-in server? (y/n): ";
+		cin >> useLocal;
+		string host = this->generatorHost;
+		string port = this->generatorPort;
+		if (useLocal == 'y' || useLocal == 'Y')
+		{
+			GeneratorServer::Settings settings =
+			{ std::chrono::milliseconds(0), 0, 0 };
+			localServer.reset(new GeneratorServer(0, settings));
+			host = "127.0.0.1";
+			port = to_string(localServer->getPort());
+		}
+		source = IngestionPipeline::fromGenerator(host, port, studentCount,
+				connections, window);
+	}
+	else if (choice == 2 || choice == 3)
+	{
+		string filePath;
+		cout << "Enter the file path: ";
+		cin >> filePath;
+		inFile.open(filePath);
+		if (!inFile)
+		{
+			cerr << "Failed to open file: " << filePath << endl;
+			return;
+		}
+		if (choice == 3)
+		{
+			format = IngestionPipeline::CSV;
+		}
+		source = IngestionPipeline::fromStream(inFile, format);
+	}
+	else
+	{
+		cout << "Invalid option.\n";
+		return;
+	}
+
+	IngestionPipeline pipeline(this->studentDb,
+			[this](const StudentRecord &student)
+			{
+				return this->recordValidator.isValid(student);
+			});
+	try
+	{
+		printPipelineStatistics(pipeline.run(format, source));
+	} catch (const std::exception &e)
+	{
+		cout << e.what() << endl;
+		printPipelineStatistics(pipeline.getStatistics());
+	}
+	this->queryCache.clear();
+}
+
+void SimpleUI::printPipelineStatistics(
+		const IngestionPipeline::Statistics &statistics)
+{
+	cout << fixed << setprecision(2) << "Pipeline ran " << statistics.seconds
+			<< " s" << endl;
+	cout << left << setw(10) << "Stage" << right << setw(8) << "Threads"
+			<< setw(10) << "Items" << setw(10) << "Rejected" << setw(12)
+			<< "Items/s" << setw(10) << "Busy s" << setw(8) << "Queue"
+			<< setw(10) << "Max queue" << endl;
+	for (const IngestionPipeline::StageStatistics &stage : statistics.stages)
+	{
+		double rate =
+				statistics.seconds > 0 ? stage.items / statistics.seconds : 0;
+		cout << left << setw(10) << stage.name << right << setw(8)
+				<< stage.threads << setw(10) << stage.items << setw(10)
+				<< stage.rejected << setw(12) << rate << setw(10)
+				<< stage.busySeconds << setw(8) << stage.queueDepth << setw(10)
+				<< stage.maxQueueDepth << endl;
+	}
+	cout << defaultfloat;
+}
 
+void SimpleUI::runServer()
+{
+	string address;
+	unsigned int port, threads;
+	cout << "Enter the address to listen on (e.g. 127.0.0.1 or 0.0.0.0): ";
+	cin >> address;
+	cout << "Enter the port: ";
+	cin >> port;
+	cout << "Enter the number of server threads (0 for default): ";
+	cin >> threads;
+	cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+	try
+	{
+		serveDatabase(address, static_cast<unsigned short>(port), threads);
+	} catch (const std::exception &e)
+	{
+		cout << "Server failed: " << e.what() << endl;
+	}
+}
+
+void SimpleUI::printFreeTime()
+{
+	const char *dayNames[] =
+	{ "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday",
+			"Saturday" };
+	unsigned int matrikelNumber;
+	string semester;
+	cout << "Enter Matrikel Number: ";
+	cin >> matrikelNumber;
+	if (!this->studentDb.matrikelNumberExists(matrikelNumber))
+	{
+		cout << "Matrikel Number doesn't exist" << endl;
+		return;
+	}
+	cout << "Enter semester (- for all): ";
+	cin >> semester;
+	if (semester == "-")
+	{
+		semester.clear();
+	}
+
+	// Working hours Monday to Friday, 08:00 to 20:00.
+	WeekBitmap window;
+	for (int day = 1; day <= 5; ++day)
+	{
+		window.set(day * CourseSchedule::minutesPerDay + 8 * 60,
+				day * CourseSchedule::minutesPerDay + 20 * 60);
+	}
+	int lastDay = -1;
+	for (const auto &range : this->studentDb.findFreeTime(matrikelNumber,
+			semester, window))
+	{
+		int day = range.first / CourseSchedule::minutesPerDay;
+		int start = range.first % CourseSchedule::minutesPerDay;
+		int end = range.second - day * CourseSchedule::minutesPerDay;
+		if (day != lastDay)
+		{
+			cout << "\n" << dayNames[day] << ":";
+			lastDay = day;
 		}
+		cout << " " << setfill('0') << setw(2) << start / 60 << ":"
+				<< setw(2) << start % 60 << "-" << setw(2) << end / 60 << ":"
+				<< setw(2) << end % 60;
 	}
-	if (found == 0)
+	if (lastDay < 0)
 	{
-		cout << "Not Found";
+		cout << "No free time.";
 	}
 	cout << endl;
 }
 
+void SimpleUI::printStatistics()
+{
+	StudentDb::Statistics stats = this->studentDb.computeStatistics();
+	TaskScheduler::Statistics pool =
+			this->studentDb.getScheduler().getStatistics();
+	cout << "\nStudents: " << stats.studentCount << "\nCourses: "
+			<< stats.courseCount << "\nEnrollments: " << stats.enrollmentCount
+			<< "\nGraded enrollments: " << stats.gradedEnrollmentCount
+			<< "\nAverage grade: " << fixed << setprecision(2)
+			<< stats.averageGrade << endl;
+	cout << "\nWorker threads: " << pool.workerCount << "\nTasks submitted: "
+			<< pool.tasksSubmitted << "\nTasks executed: "
+			<< pool.tasksExecuted << "\nTasks stolen: " << pool.tasksStolen
+			<< "\nBusy time (us): " << pool.busyMicroseconds
+			<< "\nUtilization: " << setprecision(1)
+			<< pool.utilization * 100.0 << " %" << endl;
+	QueryCache::Statistics cache = this->queryCache.getStatistics();
+	cout << "\nCache entries: " << cache.entries << "\nCache hits: "
+			<< cache.hits << "\nCache misses: " << cache.misses
+			<< "\nCache invalidations: " << cache.invalidations
+			<< "\nCache revalidations: " << cache.revalidations << endl;
+}
+
 void SimpleUI::updateStudent()
 {
 	unsigned int matrikelNumber;
@@ -794,72 +1775,337 @@ void SimpleUI::readFromFile()
 		cerr << "Could not open file: " << filePath << std::endl;
 		return;
 	}
-	status = this->studentDb.read(inFile);
+	unsigned int rejected = 0;
+	status = this->studentDb.read(inFile, &this->recordValidator, &rejected);
 	if (status)
+	{
 		cout << "Data loaded successfully from " << filePath << std::endl;
+		if (rejected > 0)
+		{
+			cout << rejected << " students with invalid fields were skipped."
+					<< std::endl;
+		}
+	}
 	else
-		cout << "Data loading failed.";
+	{
+		cout << "Data loading failed." << std::endl;
+	}
 
 	inFile.close();
 }
 
-void SimpleUI::parseData(std::string str)
+unsigned long long SimpleUI::runBatch(istream &in, ostream &out)
 {
-	boost::json::value parsedData = boost::json::parse(str);
-	std::string firstName =
-			parsedData.at("name").at("firstName").as_string().c_str();
-
-	std::string lastName =
-			parsedData.at("name").at("lastName").as_string().c_str();
-
-	int date = parsedData.at("dateOfBirth").at("date").as_int64();
-	int month = parsedData.at("dateOfBirth").at("month").as_int64() + 1;
-	int year = parsedData.at("dateOfBirth").at("year").as_int64() + 1900;
-	Poco::DateTime dateOfBirth = Poco::DateTime(year, month, date);
+	/**
+	 * @brief Time spent on one kind of command.
+	 */
+	struct Timing
+	{
+		unsigned long long count = 0; ///< Commands run.
+		unsigned long long failed = 0; ///< Commands that failed.
+		chrono::steady_clock::duration time = chrono::steady_clock::duration::zero(); ///< Time on the writer thread.
+	};
+	/// A parsed command, run on the writer thread. Returns false with a
+	/// message if it fails, otherwise it may set a result.
+	typedef function<bool(StudentDb&, string&)> Step;
+
+	auto started = chrono::steady_clock::now();
+	// Only touched by the writer thread until the pipeline is flushed.
+	string output;
+	array<Timing, batchCommandCount> timings;
+	unsigned long long failures = 0;
+	unsigned int lastAdded = 0;
+	MutationPipeline pipeline(this->studentDb);
+
+	auto report = [&output, &out, &failures](unsigned long long number,
+			bool failed, const string &text)
+	{
+		if (failed)
+		{
+			++failures;
+			output += "Line " + to_string(number) + ": " + text + "\n";
+		}
+		else
+		{
+			output += text;
+		}
+		if (output.size() >= batchOutputBlock)
+		{
+			out.write(output.data(), output.size());
+			output.clear();
+		}
+	};
+	auto queue = [&](BatchCommand command, unsigned long long number,
+			Step step)
+	{
+		pipeline.execute([&, command, number, step](StudentDb &db)
+		{
+			string text;
+			bool done;
+			auto start = chrono::steady_clock::now();
+			try
+			{
+				done = step(db, text);
+			} catch (const exception &e)
+			{
+				done = false;
+				text = e.what();
+			}
+			Timing &timing = timings[command];
+			timing.time += chrono::steady_clock::now() - start;
+			++timing.count;
+			if (!done)
+			{
+				++timing.failed;
+			}
+			report(number, !done, text);
+		});
+	};
+	// 0 stands for the student the script added last.
+	auto matrikel = [](FieldParser &fields)
+	{
+		string_view field = fields.text();
+		int value;
+		if (field == "last")
+		{
+			return 0u;
+		}
+		if (!FieldParser::parseInt(field, value) || value <= 0)
+		{
+			throw invalid_argument("Invalid matrikel number " + string(field));
+		}
+		return static_cast<unsigned int>(value);
+	};
 
-	std::string street =
-			parsedData.at("location").at("street").as_string().c_str();
-	std::string postal =
-			parsedData.at("location").at("postCode").as_string().c_str();
-	std::string city = parsedData.at("location").at("city").as_string().c_str();
-	std::string additionalInfo =
-			parsedData.at("location").at("state").as_string().c_str();
-	if (checkData(firstName, lastName, street, postal, city, additionalInfo))
+	string line;
+	unsigned long long number = 0;
+	unsigned long long commands = 0;
+	while (getline(in, line))
 	{
-		unsigned short postalCode = stoi(postal);
-		this->studentDb.addStudent(firstName, lastName, dateOfBirth, street,
-				postalCode, city, additionalInfo);
+		++number;
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+		++commands;
+		try
+		{
+			FieldParser fields(line);
+			string command(fields.text());
+			if (command == batchCommandNames[BATCH_ADD])
+			{
+				string firstName(fields.text());
+				string lastName(fields.text());
+				Poco::DateTime dateOfBirth = fields.date().toDateTime();
+				string street(fields.text());
+				unsigned int postalCode = fields.unsignedInteger();
+				string city(fields.text());
+				string additionalInfo(fields.remainder());
+				if (additionalInfo == "null" || additionalInfo == "-")
+					additionalInfo = "";
+				if (postalCode > numeric_limits<unsigned short>::max()
+						|| !this->recordValidator.isValid(firstName, lastName,
+								street, city, additionalInfo))
+				{
+					throw invalid_argument("Invalid student fields.");
+				}
+				queue(BATCH_ADD, number,
+						[=, &lastAdded](StudentDb &db, string &text)
+						{
+							lastAdded = db.addStudent(firstName, lastName,
+									dateOfBirth, street,
+									static_cast<unsigned short>(postalCode),
+									city, additionalInfo);
+							text = "Added " + to_string(lastAdded) + "\n";
+							return true;
+						});
+			}
+			else if (command == batchCommandNames[BATCH_ENROLL])
+			{
+				unsigned int matrikelNumber = matrikel(fields);
+				unsigned int courseKey = fields.unsignedInteger();
+				string semester(fields.text());
+				queue(BATCH_ENROLL, number,
+						[=, &lastAdded](StudentDb &db, string &text)
+						{
+							unsigned int student =
+									matrikelNumber != 0 ? matrikelNumber : lastAdded;
+							if (!db.matrikelNumberExists(student))
+								text = "Matrikel Number doesn't exist";
+							else if (!db.courseExists(courseKey))
+								text = "Course doesn't exist";
+							else if (db.enrollmentExists(student, courseKey))
+								text = "Enrollment exists";
+							else
+							{
+								db.addEnrollment(student, courseKey, semester);
+								return true;
+							}
+							return false;
+						});
+			}
+			else if (command == batchCommandNames[BATCH_GRADE])
+			{
+				unsigned int matrikelNumber = matrikel(fields);
+				unsigned int courseKey = fields.unsignedInteger();
+				float grade = fields.decimal();
+				queue(BATCH_GRADE, number,
+						[=, &lastAdded](StudentDb &db, string &text)
+						{
+							unsigned int student =
+									matrikelNumber != 0 ? matrikelNumber : lastAdded;
+							if (!db.enrollmentExists(student, courseKey))
+							{
+								text = "Enrollment doesn't exist";
+								return false;
+							}
+							db.updateGrade(student, courseKey, grade);
+							return true;
+						});
+			}
+			else if (command == batchCommandNames[BATCH_LOAD]
+					|| command == batchCommandNames[BATCH_SAVE])
+			{
+				string fileName(fields.remainder());
+				if (fileName.empty())
+				{
+					throw invalid_argument("Missing file name.");
+				}
+				if (command == batchCommandNames[BATCH_LOAD])
+				{
+					queue(BATCH_LOAD, number,
+							[this, fileName](StudentDb &db, string &text)
+							{
+								ifstream inFile(fileName);
+								unsigned int rejected = 0;
+								if (!inFile)
+								{
+									text = "Could not open file: " + fileName;
+									return false;
+								}
+								if (!db.read(inFile, &this->recordValidator,
+										&rejected))
+								{
+									text = "Data loading failed from " + fileName;
+									return false;
+								}
+								text = "Data loaded successfully from "
+										+ fileName + "\n";
+								if (rejected > 0)
+								{
+									text += to_string(rejected)
+											+ " students with invalid fields were skipped.\n";
+								}
+								return true;
+							});
+				}
+				else
+				{
+					queue(BATCH_SAVE, number,
+							[fileName](StudentDb &db, string &text)
+							{
+								ofstream outFile(fileName);
+								if (outFile)
+								{
+									db.write(outFile);
+								}
+								if (!outFile)
+								{
+									text = "Error writing file: " + fileName;
+									return false;
+								}
+								text = "Data has been written to " + fileName
+										+ "\n";
+								return true;
+							});
+				}
+			}
+			else if (command == batchCommandNames[BATCH_SEARCH])
+			{
+				string searchStr(fields.text());
+				string_view flag;
+				bool folded = fields.next(flag) && (flag == "i" || flag == "I");
+				queue(BATCH_SEARCH, number,
+						[searchStr, folded](StudentDb &db, string &text)
+						{
+							for (unsigned int matrikelNumber : db.searchStudents(
+									searchStr, folded))
+							{
+								const Student &student = db.getStudent(
+										matrikelNumber);
+								text += "Found: Matrikel Number: "
+										+ to_string(matrikelNumber) + " Name: "
+										+ student.getFirstName() + " "
+										+ student.getLastName() + "\n";
+							}
+							if (text.empty())
+							{
+								text = "Not Found: " + searchStr + "\n";
+							}
+							return true;
+						});
+			}
+			else
+			{
+				throw invalid_argument("Unknown command " + command);
+			}
+		} catch (const invalid_argument &e)
+		{
+			string message = e.what();
+			pipeline.execute([&report, number, message](StudentDb&)
+			{
+				report(number, true, message);
+			});
+		}
 	}
-}
-
-bool SimpleUI::checkData(std::string firstName, std::string lastName,
-		std::string street, std::string postalCode, std::string city,
-		std::string additionalInfo)
-{
-
-	bool fName =
-			std::all_of(firstName.begin(), firstName.end(), ::isalpha) ?
-					true : false;
-	bool lName =
-			std::all_of(lastName.begin(), lastName.end(), ::isalpha) ?
-					true : false;
-	bool streetOK =
-			std::all_of(street.begin(), street.end(), ::isprint) ? true : false;
-	bool postal =
-			std::all_of(postalCode.begin(), postalCode.end(), ::isdigit) ?
-					true : false;
-	bool cityOK =
-			std::all_of(city.begin(), city.end(), ::isprint) ? true : false;
-	bool additionalOK =
-			std::all_of(additionalInfo.begin(), additionalInfo.end(),
-					::isprint) ? true : false;
-	if (fName && lName && streetOK && postal && postal && cityOK
-			&& additionalOK)
+	pipeline.flush().wait();
+	// Waits until the writer has finished the batch of the flush.
+	MutationPipeline::Statistics statistics;
+	pipeline.query([&pipeline, &statistics](const StudentDb&)
 	{
-		return true;
+		statistics = pipeline.getStatistics();
+	});
+
+	double seconds = chrono::duration<double>(
+			chrono::steady_clock::now() - started).count();
+	ostringstream summary;
+	summary << fixed << setprecision(3) << "\n" << commands
+			<< " commands in " << seconds << " s, " << setprecision(0)
+			<< (seconds > 0 ? commands / seconds : 0.0) << " commands/s, "
+			<< failures << " failed, " << statistics.batchesApplied
+			<< " batches applied (largest " << statistics.largestBatch << ")\n"
+			<< left << setw(8) << "Command" << right << setw(10) << "Count"
+			<< setw(10) << "Failed" << setw(12) << "Total ms" << setw(12)
+			<< "Mean us" << "\n";
+	for (int command = 0; command < batchCommandCount; command++)
+	{
+		const Timing &timing = timings[command];
+		if (timing.count == 0)
+		{
+			continue;
+		}
+		double milliseconds = chrono::duration<double, milli>(timing.time).count();
+		summary << left << setw(8) << batchCommandNames[command] << right
+				<< setw(10) << timing.count << setw(10) << timing.failed
+				<< setprecision(3) << setw(12) << milliseconds
+				<< setprecision(1) << setw(12)
+				<< milliseconds * 1000 / timing.count << "\n";
 	}
+	output += summary.str();
+	out.write(output.data(), output.size());
+	out.flush();
+	this->queryCache.clear();
+	return failures;
+}
 
-	return false;
+bool SimpleUI::parseData(const std::string &str, StudentRecord &student)
+{
+	return StudentRecord::fromJson(str, student)
+			&& this->recordValidator.isValid(student);
 }
 
 SimpleUI::~SimpleUI()
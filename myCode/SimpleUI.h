@@ -13,15 +13,35 @@
 #include <map>
 #include <fstream>
 #include <memory>
+#include <chrono>
+#include <future>
+#include <vector>
 #include <Poco/Data/Date.h>
 #include <Poco/Data/Time.h>
 #include <Poco/DateTime.h>
 #include <boost/asio.hpp>
 #include <string>
+#include <string_view>
 #include <boost/json.hpp>
 #include <cctype>
 #include <algorithm>
 #include "StudentDb.h"
+#include "FieldParser.h"
+#include "MutationPipeline.h"
+#include "QueryCache.h"
+#include "GeneratorClient.h"
+#include "GeneratorServer.h"
+#include "StudentImporter.h"
+#include "StudentRecord.h"
+#include "RecordValidator.h"
+#include "IngestionPipeline.h"
+#include "StudentServer.h"
+#include "ReplicationLog.h"
+#include "ReplicationPrimary.h"
+#include "ReplicaFollower.h"
+#include "ShardMap.h"
+#include "StudentRouter.h"
+#include "StudentLoadClient.h"
 #include "BlockCourse.h"
 #include "WeeklyCourse.h"
 
@@ -38,6 +58,10 @@ class SimpleUI
 {
 private:
 	StudentDb &studentDb; ///< Reference to the student database for data management.
+	QueryCache queryCache; ///< Rendered results of searches, listings and queries.
+	RecordValidator recordValidator; ///< Rules for imported and loaded students.
+	std::string generatorHost; ///< Host of the student data generator.
+	std::string generatorPort; ///< Port of the student data generator.
 
 	/**
 	 * @brief Converts a string to a Poco::Data::Date object.
@@ -77,6 +101,11 @@ private:
 	 */
 	void listCourses();
 
+	/**
+	 * @brief Lists the grade distribution of every course.
+	 */
+	void listCourseStatistics();
+
 	/**
 	 * @brief Adds a new student to the database.
 	 */
@@ -97,6 +126,66 @@ private:
 	 */
 	void searchStudent();
 
+	/**
+	 * @brief Lists students ordered by name, 50 per page.
+	 */
+	void listStudentsByName();
+
+	/**
+	 * @brief Reads a query string and prints the matching students.
+	 */
+	void queryStudents();
+
+	/**
+	 * @brief Prints the students with the best credit weighted average grade.
+	 */
+	void printTopStudents();
+
+	/**
+	 * @brief Prints a materialized enrollment rollup chosen by the user.
+	 */
+	void printRollup();
+
+	/**
+	 * @brief Prints all enrollments that clash in the students' timetables.
+	 */
+	void printClashReport();
+
+	/**
+	 * @brief Prints the free working hours of a student's week.
+	 */
+	void printFreeTime();
+
+	/**
+	 * @brief Bulk imports students from the generator, a JSON lines file or
+	 * a database file through an IngestionPipeline.
+	 */
+	void runIngestionPipeline();
+
+	/**
+	 * @brief Prints the per stage counters of an IngestionPipeline run.
+	 * @param statistics The counters.
+	 */
+	void printPipelineStatistics(const IngestionPipeline::Statistics &statistics);
+
+	/**
+	 * @brief Prints the replication state of a server.
+	 * @param status The state.
+	 */
+	void printReplicationStatus(
+			const StudentProtocol::ReplicationStatus &status);
+
+	/**
+	 * @brief Asks for an address, port and pool size and serves the
+	 * database until Enter is pressed.
+	 */
+	void runServer();
+
+	/**
+	 * @brief Prints database statistics and the worker pool utilization.
+	 */
+	void printStatistics();
+
 	/**
 	 * @brief Updates information of a specific student.
 	 */
@@ -113,36 +202,204 @@ private:
 	void readFromFile();
 
 	/**
-	 * @brief Generates random student data for testing purposes.
+	 * @brief Imports generated students from the generator server.
+	 *
+	 * Asks for the number of students, the number of connections, the
+	 * request window and whether to use a local GeneratorServer instead of
+	 * the external host.
 	 */
 	void generateStudentData();
 
 	/**
-	 * @brief Parses string data to extract student or course information.
-	 * @param str The string containing data to be parsed.
+	 * @brief Imports generated students over one pipelined connection.
+	 *
+	 * Records are parsed while later ones are still arriving and added in
+	 * the order they were received.
+	 * @param host Host of the generator.
+	 * @param port Port of the generator.
+	 * @param studentCount Number of students to request.
+	 * @param window Requests kept in flight.
 	 */
-	void parseData(std::string str);
+	void fetchStudentData(const std::string &host, const std::string &port,
+			unsigned int studentCount, unsigned int window);
 
 	/**
-	 * @brief Checks the validity of the input data for a new student
-	 * @param firstName Student's first name.
-	 * @param lastName Student's last name.
-	 * @param street Student's street address.
-	 * @param postalCode Student's postal code.
-	 * @param city Student's city.
-	 * @param additionalInfo Any additional information.
-	 * @return True if the data is valid, false otherwise.
+	 * @brief Imports generated students over several connections with a
+	 * StudentImporter and reports the import rate and request latencies.
+	 * @param host Host of the generator.
+	 * @param port Port of the generator.
+	 * @param studentCount Number of students to request.
+	 * @param connections Number of connections.
+	 * @param window Requests kept in flight per connection.
 	 */
-	bool checkData(std::string firstName, std::string lastName,
-			std::string street, std::string postalCode, std::string city,
-			std::string additionalInfo);
+	void importStudentData(const std::string &host, const std::string &port,
+			unsigned int studentCount, unsigned int connections,
+			unsigned int window);
+
+	/**
+	 * @brief Parses a batch of generated records in parallel and adds the
+	 * valid ones in order.
+	 * @param records JSON lines of the records.
+	 * @return Number of students added.
+	 */
+	unsigned int addGeneratedStudents(std::vector<std::string> &records);
+
+	/**
+	 * @brief Parses one generated student record and checks its fields.
+	 *
+	 * Does not touch the database, so records can be parsed concurrently.
+	 * @param str The record as JSON.
+	 * @param student Receives the fields of the record.
+	 * @return True if StudentRecord::fromJson() accepts the record and its
+	 * fields pass the recordValidator.
+	 */
+	bool parseData(const std::string &str, StudentRecord &student);
 
 public:
 	/**
 	 * @brief Constructs a SimpleUI object with a reference to a StudentDb.
 	 * @param db Reference to the student database to manage.
+	 * @param generatorHost Host of the student data generator.
+	 * @param generatorPort Port of the student data generator.
+	 */
+	SimpleUI(StudentDb &db, const std::string &generatorHost =
+			"www.hhs.users.h-da.cloud", const std::string &generatorPort = "4242");
+
+	/**
+	 * @brief Measures the import throughput and request latencies.
+	 * @param studentCount Number of students to import.
+	 * @param connections Number of connections.
+	 * @param window Requests kept in flight per connection.
+	 * @param localSettings Settings of a local GeneratorServer to import
+	 * from, nullptr uses the configured generator.
+	 * @param pipeline True to import through an IngestionPipeline.
+	 */
+	void benchmarkImport(unsigned int studentCount, unsigned int connections,
+			unsigned int window, const GeneratorServer::Settings *localSettings,
+			bool pipeline = false);
+
+	/**
+	 * @brief Serves the database over TCP until Enter is pressed.
+	 * @param address Address to listen on.
+	 * @param port TCP port, 0 picks a free one.
+	 * @param threads Size of the server's thread pool, 0 for the default.
+	 */
+	void serveDatabase(const std::string &address, unsigned short port,
+			unsigned int threads);
+
+	/**
+	 * @brief Serves the database over TCP and ships its mutations to read
+	 * replicas.
+	 *
+	 * Enter prints the replication state, "q" and Enter stop the server.
+	 * @param address Address to listen on, for clients and followers.
+	 * @param port TCP port for clients, 0 picks a free one.
+	 * @param threads Size of the server's thread pool, 0 for the default.
+	 * @param replicationPort TCP port for followers, 0 picks a free one.
+	 * @param logEntries Log records kept for followers that fall behind.
+	 */
+	void servePrimary(const std::string &address, unsigned short port,
+			unsigned int threads, unsigned short replicationPort,
+			std::size_t logEntries);
+
+	/**
+	 * @brief Serves a read replica of a primary's database over TCP.
+	 *
+	 * Enter prints the replication state, "q" and Enter stop the server.
+	 * @param primaryHost Host of the primary.
+	 * @param primaryPort Replication port of the primary.
+	 * @param directory Existing directory for the replica's local state.
+	 * @param address Address to listen on.
+	 * @param port TCP port for clients, 0 picks a free one.
+	 * @param threads Size of the server's thread pool, 0 for the default.
+	 */
+	void serveReplica(const std::string &primaryHost,
+			const std::string &primaryPort, const std::string &directory,
+			const std::string &address, unsigned short port,
+			unsigned int threads);
+
+	/**
+	 * @brief Serves the database as one shard of a StudentRouter deployment
+	 * until Enter is pressed.
+	 *
+	 * The database holds the students of the shard's range, loaded with
+	 * their matrikel numbers, and the whole course catalog. Added students
+	 * get numbers from the shard's range.
+	 * @param map Matrikel ranges of the deployment.
+	 * @param shard Index of this shard.
+	 * @param address Address to listen on.
+	 * @param port TCP port, 0 picks a free one.
+	 * @param threads Size of the server's thread pool, 0 for the default.
+	 */
+	void serveShard(const ShardMap &map, unsigned int shard,
+			const std::string &address, unsigned short port,
+			unsigned int threads);
+
+	/**
+	 * @brief Splits a database file into one file per shard.
+	 *
+	 * The students keep their matrikel numbers, file i holds the students of
+	 * range i and every file the whole course catalog. The files are named
+	 * after the input file with ".shard" and the index appended.
+	 * @param file The database file.
+	 * @param map Matrikel ranges of the deployment.
+	 * @return False if a file cannot be read or written.
+	 */
+	bool splitShards(const std::string &file, const ShardMap &map);
+
+	/**
+	 * @brief Routes clients to the shards of a database until Enter is
+	 * pressed.
+	 * @param shards "host:port" of each shard's server, shard 0 first.
+	 * @param rangeSize Matrikel numbers per shard.
+	 * @param address Address to listen on.
+	 * @param port TCP port, 0 picks a free one.
+	 * @param threads Size of the router's thread pool, 0 for the default.
+	 */
+	void serveRouter(const std::vector<std::string> &shards,
+			unsigned int rangeSize, const std::string &address,
+			unsigned short port, unsigned int threads);
+
+	/**
+	 * @brief Asks a StudentServer for its replication state and prints it.
+	 * @param host Host of the server.
+	 * @param port Port of the server.
+	 */
+	void printServerStatus(const std::string &host, const std::string &port);
+
+	/**
+	 * @brief Measures the request latency and throughput of a StudentServer.
+	 * @param host Host of the server, empty to start one in this process on
+	 * a database filled with random students.
+	 * @param port Port of the server.
+	 * @param settings Shape of the load. For a local server the matrikel
+	 * range is set to the added students.
+	 * @param localStudents Students added to the database for a local server.
+	 */
+	void benchmarkServer(const std::string &host, const std::string &port,
+			StudentLoadClient::Settings settings, unsigned int localStudents);
+
+	/**
+	 * @brief Runs a script of commands without prompts.
+	 *
+	 * One command per line, fields separated by ';' as in the database
+	 * file; empty lines and lines starting with '#' are skipped:
+	 * - add;FIRST;LAST;D.M.YYYY;STREET;POSTAL CODE;CITY;ADDITIONAL INFO
+	 * - enroll;MATRIKEL;COURSE;SEMESTER
+	 * - grade;MATRIKEL;COURSE;GRADE
+	 * - load;FILE and save;FILE
+	 * - search;TEXT, or search;TEXT;i to ignore case
+	 *
+	 * MATRIKEL may be "last", the student the script added last. The lines
+	 * are parsed while a MutationPipeline applies the commands before them
+	 * in batches, timetable clashes are not asked about. Results and
+	 * failures are collected and written in large blocks, followed by the
+	 * time spent per command.
+	 * @param in The script.
+	 * @param out Receives the results and the summary.
+	 * @return Number of lines that failed.
 	 */
-	SimpleUI(StudentDb &db);
+	unsigned long long runBatch(std::istream &in, std::ostream &out);
 
 	/**
 	 * @brief Initiates the user interaction loop.
@@ -0,0 +1,63 @@
+/**
+ * @file SocketChannel.cpp
+ * @brief SocketChannel class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "SocketChannel.h"
+
+using boost::asio::ip::tcp;
+
+SocketChannel::SocketChannel(tcp::socket socket) :
+		socket(std::move(socket))
+{
+}
+
+SocketChannel::SocketChannel(const tcp::socket::executor_type &executor) :
+		socket(executor)
+{
+}
+
+tcp::socket& SocketChannel::getSocket()
+{
+	return this->socket;
+}
+
+std::string& SocketChannel::getInput()
+{
+	return this->input;
+}
+
+std::string& SocketChannel::getOutbox()
+{
+	return this->outbox;
+}
+
+bool SocketChannel::isReading() const
+{
+	return this->reading;
+}
+
+bool SocketChannel::isWriting() const
+{
+	return this->writing;
+}
+
+bool SocketChannel::isClosed() const
+{
+	return this->closed;
+}
+
+bool SocketChannel::close()
+{
+	if (this->closed)
+	{
+		return false;
+	}
+	this->closed = true;
+	boost::system::error_code ignored;
+	this->socket.shutdown(tcp::socket::shutdown_both, ignored);
+	this->socket.close(ignored);
+	return true;
+}
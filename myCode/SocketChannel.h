@@ -0,0 +1,165 @@
+/**
+ * @file SocketChannel.h
+ * @brief SocketChannel class declaration, the buffered socket of one
+ * connection.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef SOCKETCHANNEL_H_
+#define SOCKETCHANNEL_H_
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <boost/asio.hpp>
+
+/**
+ * @class SocketChannel
+ * @brief A TCP socket with the read and write buffers every connection of
+ * the servers and clients needs.
+ *
+ * Reads append to an input buffer, writes send an outbox. Bytes queued while
+ * a write runs go out with the next one, so at most one read and one write
+ * run at a time. The channel is only touched on its socket's executor or
+ * strand. Completion handlers have to keep the owner of the channel alive,
+ * usually by holding a shared_ptr to it.
+ */
+class SocketChannel
+{
+public:
+	/**
+	 * @brief Size of the buffer a single read fills.
+	 */
+	static const std::size_t chunkSize = 16384;
+
+private:
+	boost::asio::ip::tcp::socket socket; ///< The socket.
+	std::array<char, chunkSize> chunk; ///< Target of the running read.
+	std::string input; ///< Received bytes.
+	std::string outbox; ///< Bytes waiting for the next write.
+	std::string sending; ///< Buffer of the running write.
+	bool reading = false; ///< Set while a read runs.
+	bool writing = false; ///< Set while a write runs.
+	bool closed = false; ///< Set once the socket is closed.
+
+public:
+	/**
+	 * @brief Wraps a connected socket.
+	 * @param socket The socket.
+	 */
+	explicit SocketChannel(boost::asio::ip::tcp::socket socket);
+
+	/**
+	 * @brief Creates a channel whose socket still has to connect.
+	 * @param executor Executor or strand of the socket.
+	 */
+	explicit SocketChannel(
+			const boost::asio::ip::tcp::socket::executor_type &executor);
+
+	SocketChannel(const SocketChannel&) = delete;
+	SocketChannel& operator=(const SocketChannel&) = delete;
+
+	/**
+	 * @brief Returns the socket, e.g. for connecting or options.
+	 * @return The socket.
+	 */
+	boost::asio::ip::tcp::socket& getSocket();
+
+	/**
+	 * @brief Returns the received bytes, the owner removes what it parsed.
+	 * @return The input buffer.
+	 */
+	std::string& getInput();
+
+	/**
+	 * @brief Returns the bytes waiting to be sent, the owner appends to it.
+	 * @return The outbox.
+	 */
+	std::string& getOutbox();
+
+	/**
+	 * @brief Tells if a read runs.
+	 * @return True while a read runs.
+	 */
+	bool isReading() const;
+
+	/**
+	 * @brief Tells if a write runs.
+	 * @return True while a write runs.
+	 */
+	bool isWriting() const;
+
+	/**
+	 * @brief Tells if the channel was closed.
+	 * @return True once close() was called.
+	 */
+	bool isClosed() const;
+
+	/**
+	 * @brief Reads the available bytes into the input buffer.
+	 * @param done Called with the error code once the read completed, the
+	 * bytes are already appended to the input then.
+	 * @return False if a read runs already or the channel is closed.
+	 */
+	template<typename Handler>
+	bool read(Handler &&done)
+	{
+		if (this->reading || this->closed)
+		{
+			return false;
+		}
+		this->reading = true;
+		this->socket.async_read_some(boost::asio::buffer(this->chunk),
+				[this, done = std::forward<Handler>(done)](
+						const boost::system::error_code &error,
+						std::size_t size) mutable
+				{
+					this->reading = false;
+					if (!error)
+					{
+						this->input.append(this->chunk.data(), size);
+					}
+					done(error);
+				});
+		return true;
+	}
+
+	/**
+	 * @brief Sends the outbox.
+	 * @param done Called with the error code once the write completed.
+	 * @return False if a write runs already, the outbox is empty or the
+	 * channel is closed.
+	 */
+	template<typename Handler>
+	bool write(Handler &&done)
+	{
+		if (this->writing || this->closed || this->outbox.empty())
+		{
+			return false;
+		}
+		this->writing = true;
+		this->sending.swap(this->outbox);
+		boost::asio::async_write(this->socket,
+				boost::asio::buffer(this->sending),
+				[this, done = std::forward<Handler>(done)](
+						const boost::system::error_code &error,
+						std::size_t) mutable
+				{
+					this->writing = false;
+					this->sending.clear();
+					done(error);
+				});
+		return true;
+	}
+
+	/**
+	 * @brief Shuts the socket down and closes it, running operations
+	 * complete with an error.
+	 * @return False if the channel was closed already.
+	 */
+	bool close();
+};
+
+#endif /* SOCKETCHANNEL_H_ */
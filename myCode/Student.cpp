@@ -12,16 +12,46 @@ unsigned int Student::nextMatrikelNumber = 100000;
 Student::Student(const std::string fName, const std::string lName,
 		const Poco::DateTime dob, const std::shared_ptr<Address> &addressIn) :
 		matrikelNumber(nextMatrikelNumber++), firstName(fName), lastName(lName), dateOfBirth(
-				dob), address(addressIn)
+				CompactDate::fromDateTime(dob)), address(addressIn)
 {
 }
 
-Poco::DateTime Student::convertDate(std::string dateString)
+Student::Student(unsigned int matrikelNumber, const std::string fName,
+		const std::string lName, const Poco::DateTime dob,
+		const std::shared_ptr<Address> &addressIn) :
+		matrikelNumber(matrikelNumber), firstName(fName), lastName(lName), dateOfBirth(
+				CompactDate::fromDateTime(dob)), address(addressIn)
 {
-	int year, month, day;
-	sscanf(dateString.c_str(), "%d.%d.%d", &day, &month, &year);
-	return Poco::DateTime(year, month, day);
 }
+
+Student::Student(unsigned int matrikelNumber, std::string fName,
+		std::string lName, CompactDate dob,
+		const std::shared_ptr<Address> &addressIn) :
+		matrikelNumber(matrikelNumber), firstName(std::move(fName)), lastName(
+				std::move(lName)), dateOfBirth(dob), address(addressIn)
+{
+}
+
+unsigned int Student::reserveMatrikelNumbers(unsigned int count)
+{
+	unsigned int first = nextMatrikelNumber;
+	nextMatrikelNumber += count;
+	return first;
+}
+
+void Student::skipMatrikelNumbersThrough(unsigned int matrikelNumber)
+{
+	if (nextMatrikelNumber <= matrikelNumber)
+	{
+		nextMatrikelNumber = matrikelNumber + 1;
+	}
+}
+
+unsigned int Student::getNextMatrikelNumber()
+{
+	return nextMatrikelNumber;
+}
+
 unsigned int Student::getMatrikelNumber() const
 {
 	return matrikelNumber;
@@ -38,6 +68,11 @@ std::string Student::getLastName() const
 }
 
 Poco::DateTime Student::getDateOfBirth() const
+{
+	return dateOfBirth.toDateTime();
+}
+
+CompactDate Student::getBirthDate() const
 {
 	return dateOfBirth;
 }
@@ -54,14 +89,14 @@ void Student::setLastName(std::string lastNameIN)
 
 void Student::setDateOfBirth(Poco::DateTime dateOfBirthIN)
 {
-	this->dateOfBirth = dateOfBirthIN;
+	this->dateOfBirth = CompactDate::fromDateTime(dateOfBirthIN);
 }
 std::shared_ptr<Address> Student::getAddress() const
 {
 	return this->address;
 }
 
-std::vector<Enrollment> Student::getEnrollments() const
+const std::vector<Enrollment>& Student::getEnrollments() const
 {
 	return this->enrollments;
 }
@@ -103,29 +138,33 @@ void Student::deleteEnrollment(unsigned int courseKey)
 
 void Student::write(std::ostream &out) const
 {
-	out << this->getFirstName() << ";" << this->getLastName() << ";"
-			<< this->getDateOfBirth().day() << "."
-			<< this->getDateOfBirth().month() << "."
-			<< this->getDateOfBirth().year() << ";";
+	int year, month, day;
+	this->dateOfBirth.toYmd(year, month, day);
+	out << this->getFirstName() << ";" << this->getLastName() << ";" << day
+			<< "." << month << "." << year << ";";
 	this->getAddress()->write(out);
 	out << std::endl;
 }
 
 Student Student::read(std::istream &in)
 {
-	std::string firstName;
-	std::string lastName;
-	Poco::DateTime dateOfBirth;
-	std::shared_ptr<Address> address;
-	std::string inp;
-	std::getline(in, firstName, ';');
-	std::getline(in, lastName, ';');
-	std::getline(in, inp, ';');
-	dateOfBirth = convertDate(inp);
-	address = Address::read(in);
-	Student sObj(firstName, lastName, dateOfBirth, address);
-	return sObj;
+	return read(in, reserveMatrikelNumbers(1));
+}
+
+Student Student::read(std::istream &in, unsigned int matrikelNumber)
+{
+	FieldParser fields(FieldParser::readLine(in));
+	return read(fields, matrikelNumber);
+}
 
+Student Student::read(FieldParser &fields, unsigned int matrikelNumber)
+{
+	std::string_view firstName = fields.text();
+	std::string_view lastName = fields.text();
+	CompactDate dateOfBirth = fields.date();
+	std::shared_ptr<Address> address = Address::read(fields);
+	return Student(matrikelNumber, std::string(firstName),
+			std::string(lastName), dateOfBirth, address);
 }
 
 Student::~Student()
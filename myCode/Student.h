@@ -15,6 +15,8 @@
 #include "Address.h"
 #include "Enrollment.h"
 #include <Poco/DateTime.h>
+#include "CompactDate.h"
+#include "FieldParser.h"
 
 /**
  * @class Student
@@ -27,17 +29,10 @@ private:
 	const unsigned int matrikelNumber; ///< Unique matrikel number for the student.
 	std::string firstName; ///< Student's first name.
 	std::string lastName; ///< Student's last name.
-	Poco::DateTime dateOfBirth; ///< Student's date of birth.
+	CompactDate dateOfBirth; ///< Student's date of birth.
 	std::shared_ptr<Address> address; ///< Student's address.
 	std::vector<Enrollment> enrollments; ///< List of student's course enrollments.
 
-	/**
-	 * @brief Converts a string to a Poco::DateTime object.
-	 * @param dateString The date in string format to be converted.
-	 * @return A Poco::DateTime object representing the date.
-	 */
-	static Poco::DateTime convertDate(std::string dateString);
-
 public:
 	/**
 	 * @brief Constructs a Student object.
@@ -50,15 +45,67 @@ public:
 			const Poco::DateTime dob,
 			const std::shared_ptr<Address> &addressIn);
 
+	/**
+	 * @brief Constructs a Student object with a previously reserved matrikel number.
+	 * @param matrikelNumber Matrikel number obtained from reserveMatrikelNumbers().
+	 * @param fName Student's first name.
+	 * @param lName Student's last name.
+	 * @param dob Student's date of birth.
+	 * @param addressIn Student's address.
+	 */
+	Student(unsigned int matrikelNumber, const std::string fName,
+			const std::string lName, const Poco::DateTime dob,
+			const std::shared_ptr<Address> &addressIn);
+
+	/**
+	 * @brief Constructs a Student object from already converted fields.
+	 * @param matrikelNumber Matrikel number obtained from reserveMatrikelNumbers().
+	 * @param fName Student's first name.
+	 * @param lName Student's last name.
+	 * @param dob Student's date of birth.
+	 * @param addressIn Student's address.
+	 */
+	Student(unsigned int matrikelNumber, std::string fName, std::string lName,
+			CompactDate dob, const std::shared_ptr<Address> &addressIn);
+
+	/**
+	 * @brief Reserves a block of consecutive matrikel numbers.
+	 *
+	 * Allows constructing students in parallel while keeping the numbering
+	 * identical to sequential construction.
+	 * @param count Number of matrikel numbers to reserve.
+	 * @return The first reserved matrikel number.
+	 */
+	static unsigned int reserveMatrikelNumbers(unsigned int count);
+
+	/**
+	 * @brief Makes sure numbers handed out later are larger than a number
+	 * that was assigned elsewhere, e.g. read from a file.
+	 * @param matrikelNumber Matrikel number in use.
+	 */
+	static void skipMatrikelNumbersThrough(unsigned int matrikelNumber);
+
+	/**
+	 * @brief Returns the matrikel number the next new student gets.
+	 * @return The next matrikel number.
+	 */
+	static unsigned int getNextMatrikelNumber();
+
 	unsigned int getMatrikelNumber() const;
 	std::string getFirstName() const;
 	std::string getLastName() const;
 	Poco::DateTime getDateOfBirth() const;
+
+	/**
+	 * @brief Returns the date of birth without converting it.
+	 * @return Date of birth as a day number.
+	 */
+	CompactDate getBirthDate() const;
 	void setFirstName(std::string firstName);
 	void setLastName(std::string lastName);
 	void setDateOfBirth(Poco::DateTime dateOfBirth);
 	std::shared_ptr<Address> getAddress() const;
-	std::vector<Enrollment> getEnrollments() const;
+	const std::vector<Enrollment>& getEnrollments() const;
 
 	/**
 	 * @brief Adds a new enrollment to the student's record.
@@ -98,6 +145,22 @@ public:
 	 */
 	static Student read(std::istream &in);
 
+	/**
+	 * @brief Reads student data using a reserved matrikel number.
+	 * @param in Input stream reference.
+	 * @param matrikelNumber Matrikel number obtained from reserveMatrikelNumbers().
+	 * @return A Student object.
+	 */
+	static Student read(std::istream &in, unsigned int matrikelNumber);
+
+	/**
+	 * @brief Creates a Student from the next fields of a record.
+	 * @param fields Parser positioned at the first name.
+	 * @param matrikelNumber Matrikel number obtained from reserveMatrikelNumbers().
+	 * @return A Student object.
+	 */
+	static Student read(FieldParser &fields, unsigned int matrikelNumber);
+
 	/**
 	 * @brief Destructor for the Student class.
 	 */
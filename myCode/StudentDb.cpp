@@ -6,11 +6,23 @@
  */
 
 #include "StudentDb.h"
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
 
-StudentDb::StudentDb()
-{
-	// TODO Auto-generated constructor stub
+const std::size_t StudentDb::changeJournalCapacity;
+constexpr float StudentDb::passingGrade;
+const std::size_t StudentDb::gradeBuckets;
 
+StudentDb::StudentDb(unsigned int workerCount) :
+		scheduler(std::make_unique<TaskScheduler>(workerCount)), rollupsDeferred(
+				false), version(0), journalFloor(0)
+{
+	registerRollup("semester_major",
+			RollupView::SEMESTER | RollupView::MAJOR);
+	registerRollup("semester_course",
+			RollupView::SEMESTER | RollupView::COURSE);
 }
 
 void StudentDb::addBlockedCourse(unsigned int courseKey,
@@ -20,11 +32,15 @@ void StudentDb::addBlockedCourse(unsigned int courseKey,
 		const Poco::Data::Time endT)
 {
 
-	this->courses.insert(
+	auto inserted = this->courses.insert(
 			std::make_pair(courseKey,
 					std::make_unique < BlockCourse
 							> (courseKey, majorStr, title, creditPts, startD, endD, startT, endT)));
-
+	if (inserted.second)
+	{
+		this->schedule.insert(*inserted.first->second);
+	}
+	recordMutation(0);
 }
 
 bool StudentDb::courseExists(int courseKey) const
@@ -38,22 +54,72 @@ void StudentDb::addWeeklyCourse(unsigned int courseKey,
 		const Poco::Data::Time startT, const Poco::Data::Time endT)
 {
 
-	this->courses.insert(
+	auto inserted = this->courses.insert(
 			std::make_pair(courseKey,
 					std::make_unique < WeeklyCourse
 							> (courseKey, majorStr, title, creditPts, dayOfWeek, startT, endT)));
+	if (inserted.second)
+	{
+		this->schedule.insert(*inserted.first->second);
+	}
+	recordMutation(0);
+}
+
+unsigned int StudentDb::addStudent(const std::string fName,
+		const std::string lName, const Poco::DateTime dob,
+		const std::string street, unsigned short postalCode,
+		const std::string city, const std::string additionalInfo)
+{
+	auto addressPtr = std::make_shared<Address>(street, postalCode, city,
+			additionalInfo);
+	Student s1(fName, lName, dob, addressPtr);
+	this->students.insert(std::make_pair(s1.getMatrikelNumber(), s1));
+	indexStudent(s1);
+	recordMutation(s1.getMatrikelNumber());
+	return s1.getMatrikelNumber();
+}
 
+unsigned int StudentDb::addStudents(std::vector<StudentRecord> &records)
+{
+	unsigned int firstMatrikel = Student::reserveMatrikelNumbers(
+			static_cast<unsigned int>(records.size()));
+	unsigned int matrikelNumber = firstMatrikel;
+	for (StudentRecord &record : records)
+	{
+		auto addressPtr = std::make_shared<Address>(std::move(record.street),
+				record.postalCode, std::move(record.city),
+				std::move(record.additionalInfo));
+		auto it = this->students.emplace_hint(this->students.end(),
+				matrikelNumber,
+				Student(matrikelNumber, std::move(record.firstName),
+						std::move(record.lastName),
+						CompactDate::fromDateTime(record.dateOfBirth),
+						addressPtr));
+		indexStudent(it->second);
+		recordMutation(matrikelNumber);
+		++matrikelNumber;
+	}
+	return firstMatrikel;
 }
 
-void StudentDb::addStudent(const std::string fName, const std::string lName,
+bool StudentDb::restoreStudent(unsigned int matrikelNumber,
+		const std::string fName, const std::string lName,
 		const Poco::DateTime dob, const std::string street,
 		unsigned short postalCode, const std::string city,
 		const std::string additionalInfo)
 {
+	if (matrikelNumberExists(matrikelNumber))
+	{
+		return false;
+	}
+	Student::skipMatrikelNumbersThrough(matrikelNumber);
 	auto addressPtr = std::make_shared<Address>(street, postalCode, city,
 			additionalInfo);
-	Student s1(fName, lName, dob, addressPtr);
-	this->students.insert(std::make_pair(s1.getMatrikelNumber(), s1));
+	Student s1(matrikelNumber, fName, lName, dob, addressPtr);
+	this->students.insert(std::make_pair(matrikelNumber, s1));
+	indexStudent(s1);
+	recordMutation(matrikelNumber);
+	return true;
 }
 
 bool StudentDb::matrikelNumberExists(int matrikelNumber) const
@@ -61,12 +127,40 @@ bool StudentDb::matrikelNumberExists(int matrikelNumber) const
 	return this->students.find(matrikelNumber) != this->students.end();
 }
 
+bool StudentDb::enrollmentExists(unsigned int matrikelNumber,
+		unsigned int courseKey) const
+{
+	auto it = this->students.find(matrikelNumber);
+	if (it == this->students.end())
+	{
+		return false;
+	}
+	for (const auto &enrollment : it->second.getEnrollments())
+	{
+		if (enrollment.getCourse()->getCourseKey() == courseKey)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void StudentDb::addEnrollment(unsigned int matrikelNumber,
 		unsigned int courseKey, const std::string semester)
 {
 	auto &coursePtr = this->courses.at(courseKey);
 	Enrollment newEnrollment(coursePtr.get(), semester);
 	this->students.at(matrikelNumber).setEnrollments(newEnrollment);
+	++this->courseAggregates[courseKey].enrolledCount;
+	if (!this->rollupsDeferred)
+	{
+		for (auto &rollup : this->rollups)
+		{
+			rollup.second.countEnrollment(newEnrollment, 1);
+		}
+	}
+	applyGrade(matrikelNumber, newEnrollment, 1);
+	recordMutation(matrikelNumber);
 }
 
 std::map<int, std::unique_ptr<Course>>& StudentDb::getCourses()
@@ -79,16 +173,770 @@ std::map<int, Student> StudentDb::getStudents() const
 	return this->students;
 }
 
+const Student& StudentDb::getStudent(unsigned int matrikelNumber) const
+{
+	return this->students.at(matrikelNumber);
+}
+
+void StudentDb::indexStudent(const Student &student)
+{
+	unsigned int matrikelNumber = student.getMatrikelNumber();
+	std::string fullName = fullNameOf(student);
+	this->nameIndex.insert(matrikelNumber, fullName);
+	this->nameScanner.insert(matrikelNumber, fullName);
+	this->nameOrder.insert(
+	{ student.getLastName(), student.getFirstName(), matrikelNumber });
+	this->birthDateIndex.insert(student.getBirthDate().getDayNumber(),
+			matrikelNumber);
+	this->postalCodeIndex.insert(student.getAddress()->getPostalCode(),
+			matrikelNumber);
+}
+
+std::string StudentDb::fullNameOf(const Student &student)
+{
+	return student.getFirstName() + " " + student.getLastName();
+}
+
+std::vector<const Student*> StudentDb::getStudentRange(
+		unsigned int firstMatrikel, unsigned int lastMatrikel) const
+{
+	std::vector<const Student*> range;
+	if (firstMatrikel == 0
+			&& lastMatrikel == std::numeric_limits<unsigned int>::max())
+	{
+		range.reserve(this->students.size());
+	}
+	auto it = this->students.lower_bound(
+			static_cast<int>(std::min<unsigned int>(firstMatrikel,
+					std::numeric_limits<int>::max())));
+	for (; it != this->students.end()
+			&& static_cast<unsigned int>(it->first) <= lastMatrikel; ++it)
+	{
+		range.push_back(&it->second);
+	}
+	return range;
+}
+
+std::vector<unsigned int> StudentDb::searchStudents(
+		const std::string &searchStr, bool ignoreCase) const
+{
+	if (ignoreCase)
+	{
+		return this->nameScanner.search(searchStr, this->scheduler.get());
+	}
+	if (searchStr.size() >= TrigramIndex::minQueryLength)
+	{
+		return this->nameIndex.search(searchStr);
+	}
+
+	// Short case sensitive queries: the folded scan narrows the candidates,
+	// the exact comparison is done on the few remaining names.
+	std::vector<unsigned int> result;
+	for (unsigned int matrikelNumber : this->nameScanner.search(searchStr,
+			this->scheduler.get()))
+	{
+		const Student &student = this->students.at(matrikelNumber);
+		if (fullNameOf(student).find(searchStr) != std::string::npos)
+		{
+			result.push_back(matrikelNumber);
+		}
+	}
+	return result;
+}
+
+bool StudentDb::NameKey::operator<(const NameKey &other) const
+{
+	int order = this->lastName.compare(other.lastName);
+	if (order != 0)
+	{
+		return order < 0;
+	}
+	order = this->firstName.compare(other.firstName);
+	if (order != 0)
+	{
+		return order < 0;
+	}
+	return this->matrikelNumber < other.matrikelNumber;
+}
+
+std::vector<StudentDb::NameKey> StudentDb::findByLastNamePrefix(
+		const std::string &prefix, std::size_t limit) const
+{
+	return listStudentsByName(
+	{ prefix, "", 0 }, limit, prefix).entries;
+}
+
+StudentDb::NamePage StudentDb::listStudentsByName(const NameKey &cursor,
+		std::size_t pageSize, const std::string &prefix) const
+{
+	NamePage page;
+	page.hasMore = false;
+	auto it = this->nameOrder.lower_bound(cursor);
+	while (it != this->nameOrder.end()
+			&& it->lastName.compare(0, prefix.size(), prefix) == 0)
+	{
+		if (page.entries.size() == pageSize)
+		{
+			page.hasMore = true;
+			page.nextCursor = *it;
+			break;
+		}
+		page.entries.push_back(*it);
+		++it;
+	}
+	return page;
+}
+
+int StudentDb::toDayNumber(int year, int month, int day)
+{
+	return CompactDate::fromYmd(year, month, day).getDayNumber();
+}
+
+std::vector<unsigned int> StudentDb::findByBirthDate(
+		const Poco::DateTime &from, const Poco::DateTime &to) const
+{
+	return this->birthDateIndex.range(
+			toDayNumber(from.year(), from.month(), from.day()),
+			toDayNumber(to.year(), to.month(), to.day()));
+}
+
+std::size_t StudentDb::countByBirthDate(const Poco::DateTime &from,
+		const Poco::DateTime &to) const
+{
+	return this->birthDateIndex.count(
+			toDayNumber(from.year(), from.month(), from.day()),
+			toDayNumber(to.year(), to.month(), to.day()));
+}
+
+std::vector<unsigned int> StudentDb::findByPostalCode(unsigned short low,
+		unsigned short high) const
+{
+	return this->postalCodeIndex.range(low, high);
+}
+
+std::size_t StudentDb::countByPostalCode(unsigned short low,
+		unsigned short high) const
+{
+	return this->postalCodeIndex.count(low, high);
+}
+
+bool StudentDb::estimateCandidates(const QueryPredicate &predicate,
+		std::size_t &estimate) const
+{
+	switch (predicate.getKind())
+	{
+	case QueryPredicate::NAME_CONTAINS:
+		if (predicate.getText().size() < TrigramIndex::minQueryLength)
+		{
+			return false;
+		}
+		estimate = this->nameIndex.estimate(predicate.getText());
+		return true;
+	case QueryPredicate::NAME_CONTAINS_IGNORE_CASE:
+		// Scans every name, only preferred to scanning the students.
+		estimate = this->students.size();
+		return true;
+	case QueryPredicate::LAST_NAME_PREFIX:
+		estimate = 0;
+		for (auto it = this->nameOrder.lower_bound(
+		{ predicate.getText(), "", 0 });
+				it != this->nameOrder.end()
+						&& it->lastName.compare(0, predicate.getText().size(),
+								predicate.getText()) == 0; ++it)
+		{
+			++estimate;
+		}
+		return true;
+	case QueryPredicate::BORN_BETWEEN:
+		estimate = this->birthDateIndex.count(
+				static_cast<int>(predicate.getLow()),
+				static_cast<int>(predicate.getHigh()));
+		return true;
+	case QueryPredicate::POSTAL_CODE_BETWEEN:
+		estimate = this->postalCodeIndex.count(
+				static_cast<unsigned short>(predicate.getLow()),
+				static_cast<unsigned short>(predicate.getHigh()));
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool StudentDb::indexCandidates(const QueryPredicate &predicate,
+		std::vector<unsigned int> &candidates) const
+{
+	switch (predicate.getKind())
+	{
+	case QueryPredicate::NAME_CONTAINS:
+		if (predicate.getText().size() < TrigramIndex::minQueryLength)
+		{
+			return false;
+		}
+		candidates = this->nameIndex.search(predicate.getText());
+		return true;
+	case QueryPredicate::NAME_CONTAINS_IGNORE_CASE:
+		candidates = this->nameScanner.search(predicate.getText(),
+				this->scheduler.get());
+		return true;
+	case QueryPredicate::LAST_NAME_PREFIX:
+		candidates.clear();
+		for (auto it = this->nameOrder.lower_bound(
+		{ predicate.getText(), "", 0 });
+				it != this->nameOrder.end()
+						&& it->lastName.compare(0, predicate.getText().size(),
+								predicate.getText()) == 0; ++it)
+		{
+			candidates.push_back(it->matrikelNumber);
+		}
+		std::sort(candidates.begin(), candidates.end());
+		return true;
+	case QueryPredicate::BORN_BETWEEN:
+	{
+		candidates = this->birthDateIndex.range(
+				static_cast<int>(predicate.getLow()),
+				static_cast<int>(predicate.getHigh()));
+		std::sort(candidates.begin(), candidates.end());
+		return true;
+	}
+	case QueryPredicate::POSTAL_CODE_BETWEEN:
+		candidates = this->postalCodeIndex.range(
+				static_cast<unsigned short>(predicate.getLow()),
+				static_cast<unsigned short>(predicate.getHigh()));
+		std::sort(candidates.begin(), candidates.end());
+		return true;
+	default:
+		return false;
+	}
+}
+
+StudentDb::QueryResult StudentDb::executeQuery(const StudentQuery &query) const
+{
+	QueryResult result;
+	const QueryPredicate *best = nullptr;
+	std::size_t bestEstimate = 0;
+	for (const auto &predicate : query.getPredicates())
+	{
+		std::size_t estimate;
+		if (estimateCandidates(predicate, estimate)
+				&& (best == nullptr || estimate < bestEstimate))
+		{
+			best = &predicate;
+			bestEstimate = estimate;
+		}
+	}
+
+	std::vector<const Student*> range;
+	std::vector<unsigned int> candidates;
+	bool indexed = best != nullptr && indexCandidates(*best, candidates);
+	if (indexed)
+	{
+		result.plan = (best->getKind()
+				== QueryPredicate::NAME_CONTAINS_IGNORE_CASE ?
+				"name scan (" : "index lookup (") + best->describe() + ")";
+		range.reserve(candidates.size());
+		for (unsigned int matrikelNumber : candidates)
+		{
+			range.push_back(&this->students.at(matrikelNumber));
+		}
+	}
+	else
+	{
+		range = getStudentRange();
+		result.plan = "parallel scan";
+	}
+
+	std::size_t grain = this->scheduler->defaultGrainSize(range.size());
+	std::vector<std::vector<const Student*>> chunkMatches(
+			(range.size() + grain - 1) / grain);
+	this->scheduler->parallelFor(0, range.size(), grain,
+			[&](std::size_t begin, std::size_t end)
+			{
+				auto &matches = chunkMatches[begin / grain];
+				for (std::size_t i = begin; i < end
+						&& matches.size() < query.getLimit(); ++i)
+				{
+					if (query.matches(*range[i]))
+					{
+						matches.push_back(range[i]);
+					}
+				}
+			});
+
+	std::vector<StudentQuery::Field> projection = query.getProjection();
+	for (StudentQuery::Field field : projection)
+	{
+		result.columns.push_back(StudentQuery::fieldName(field));
+	}
+	for (const auto &matches : chunkMatches)
+	{
+		for (const Student *student : matches)
+		{
+			if (result.rows.size() == query.getLimit())
+			{
+				return result;
+			}
+			std::vector<std::string> row;
+			for (StudentQuery::Field field : projection)
+			{
+				row.push_back(StudentQuery::project(*student, field));
+			}
+			result.rows.push_back(row);
+			result.matrikelNumbers.push_back(student->getMatrikelNumber());
+		}
+	}
+	return result;
+}
+
+StudentDb::Statistics StudentDb::computeStatistics() const
+{
+	struct Partial
+	{
+		std::size_t enrollments = 0;
+		std::size_t graded = 0;
+		double gradeSum = 0.0;
+	};
+
+	auto range = getStudentRange();
+	std::size_t grain = this->scheduler->defaultGrainSize(range.size());
+	std::vector<Partial> partials((range.size() + grain - 1) / grain);
+
+	this->scheduler->parallelFor(0, range.size(), grain,
+			[&](std::size_t begin, std::size_t end)
+			{
+				Partial &partial = partials[begin / grain];
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					for (const auto &enrollment : range[i]->getEnrollments())
+					{
+						++partial.enrollments;
+						if (enrollment.getGrade() != 0)
+						{
+							++partial.graded;
+							partial.gradeSum += enrollment.getGrade();
+						}
+					}
+				}
+			});
+
+	Statistics stats;
+	stats.studentCount = this->students.size();
+	stats.courseCount = this->courses.size();
+	stats.enrollmentCount = 0;
+	stats.gradedEnrollmentCount = 0;
+	double gradeSum = 0.0;
+	for (const auto &partial : partials)
+	{
+		stats.enrollmentCount += partial.enrollments;
+		stats.gradedEnrollmentCount += partial.graded;
+		gradeSum += partial.gradeSum;
+	}
+	stats.averageGrade =
+			stats.gradedEnrollmentCount > 0 ?
+					gradeSum / stats.gradedEnrollmentCount : 0.0;
+	return stats;
+}
+
+void StudentDb::applyGrade(unsigned int matrikelNumber,
+		const Enrollment &enrollment, int sign)
+{
+	float grade = enrollment.getGrade();
+	if (grade == 0)
+	{
+		return;
+	}
+	if (!this->rollupsDeferred)
+	{
+		for (auto &rollup : this->rollups)
+		{
+			rollup.second.countGrade(enrollment, sign);
+		}
+	}
+
+	double credits = enrollment.getCourse()->getCreditPoints();
+	GradeAggregate &aggregate = this->gradeAggregates[matrikelNumber];
+	aggregate.weightedGradeSum += sign * grade * credits;
+	aggregate.creditSum += sign * credits;
+	if (grade <= passingGrade)
+	{
+		aggregate.earnedCredits += sign * credits;
+	}
+	aggregate.gradedCount += sign;
+	if (aggregate.gradedCount == 0)
+	{
+		this->gradeAggregates.erase(matrikelNumber);
+	}
+
+	CourseAggregate &course =
+			this->courseAggregates[enrollment.getCourse()->getCourseKey()];
+	course.gradedCount += sign;
+	course.gradeSum += sign * grade;
+	course.gradeSquareSum += sign * grade * grade;
+	if (grade <= passingGrade)
+	{
+		course.passedCount += sign;
+	}
+	course.histogram[gradeBucketOf(grade)] += sign;
+	if (course.gradedCount == 0)
+	{
+		course.gradeSum = 0.0;
+		course.gradeSquareSum = 0.0;
+	}
+}
+
+void StudentDb::registerRollup(const std::string &name,
+		unsigned int dimensions)
+{
+	this->rollups.erase(name);
+	this->rollups.insert(std::make_pair(name, RollupView(dimensions)));
+	rebuildRollups();
+}
+
+const RollupView& StudentDb::getRollup(const std::string &name) const
+{
+	return this->rollups.at(name);
+}
+
+std::vector<std::string> StudentDb::getRollupNames() const
+{
+	std::vector<std::string> names;
+	for (const auto &rollup : this->rollups)
+	{
+		names.push_back(rollup.first);
+	}
+	return names;
+}
+
+void StudentDb::rebuildRollups()
+{
+	// Every chunk aggregates into its own copies, which are merged afterwards.
+	auto range = getStudentRange();
+	std::size_t grain = this->scheduler->defaultGrainSize(range.size());
+	std::vector<std::vector<RollupView>> partials(
+			(range.size() + grain - 1) / grain);
+	this->scheduler->parallelFor(0, range.size(), grain,
+			[&](std::size_t begin, std::size_t end)
+			{
+				std::vector<RollupView> &views = partials[begin / grain];
+				for (const auto &rollup : this->rollups)
+				{
+					views.push_back(RollupView(rollup.second.getDimensions()));
+				}
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					for (const auto &enrollment : range[i]->getEnrollments())
+					{
+						for (auto &view : views)
+						{
+							view.countEnrollment(enrollment, 1);
+							view.countGrade(enrollment, 1);
+						}
+					}
+				}
+			});
+
+	std::size_t index = 0;
+	for (auto &rollup : this->rollups)
+	{
+		rollup.second.clear();
+		for (const auto &views : partials)
+		{
+			if (!views.empty())
+			{
+				rollup.second.merge(views[index]);
+			}
+		}
+		++index;
+	}
+}
+
+std::vector<unsigned int> StudentDb::findClashes(unsigned int matrikelNumber,
+		unsigned int courseKey, const std::string &semester) const
+{
+	std::vector<unsigned int> result;
+	for (const auto &enrollment : this->students.at(matrikelNumber).getEnrollments())
+	{
+		unsigned int otherKey = enrollment.getCourse()->getCourseKey();
+		if (enrollment.getSemester() == semester
+				&& this->schedule.clash(courseKey, otherKey))
+		{
+			result.push_back(otherKey);
+		}
+	}
+	return result;
+}
+
+std::vector<unsigned int> StudentDb::findCoursesDuring(
+		Poco::DateTime::DaysOfWeek day, const Poco::Data::Time &start,
+		const Poco::Data::Time &end) const
+{
+	int dayStart = day * CourseSchedule::minutesPerDay;
+	WeekBitmap window;
+	window.set(dayStart + start.hour() * 60 + start.minute(),
+			dayStart + end.hour() * 60 + end.minute());
+	return this->schedule.coursesDuring(window);
+}
+
+WeekBitmap StudentDb::getStudentOccupancy(unsigned int matrikelNumber,
+		const std::string &semester) const
+{
+	WeekBitmap occupied;
+	for (const auto &enrollment : this->students.at(matrikelNumber).getEnrollments())
+	{
+		if (semester.empty() || enrollment.getSemester() == semester)
+		{
+			occupied |= this->schedule.occupancyOf(
+					enrollment.getCourse()->getCourseKey());
+		}
+	}
+	return occupied;
+}
+
+std::vector<std::pair<int, int>> StudentDb::findFreeTime(
+		unsigned int matrikelNumber, const std::string &semester,
+		const WeekBitmap &window) const
+{
+	WeekBitmap free(window);
+	free.subtract(getStudentOccupancy(matrikelNumber, semester));
+	return free.ranges();
+}
+
+std::vector<StudentDb::Clash> StudentDb::findAllClashes() const
+{
+	struct Event
+	{
+		const std::string *semester;
+		CourseSchedule::Slot slot;
+	};
+
+	auto range = getStudentRange();
+	std::size_t grain = this->scheduler->defaultGrainSize(range.size());
+	std::vector<std::vector<Clash>> partials(
+			(range.size() + grain - 1) / grain);
+	this->scheduler->parallelFor(0, range.size(), grain,
+			[&](std::size_t begin, std::size_t end)
+			{
+				std::vector<Clash> &found = partials[begin / grain];
+				std::vector<Event> events;
+				std::vector<Event> active;
+				std::vector<std::string> semesters;
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					const auto &enrollments = range[i]->getEnrollments();
+					semesters.clear();
+					for (const auto &enrollment : enrollments)
+					{
+						semesters.push_back(enrollment.getSemester());
+					}
+					events.clear();
+					for (std::size_t e = 0; e < enrollments.size(); ++e)
+					{
+						for (const auto &slot : CourseSchedule::slotsOf(
+								*enrollments[e].getCourse()))
+						{
+							events.push_back(
+							{	&semesters[e], slot});
+						}
+					}
+					std::sort(events.begin(), events.end(),
+							[](const Event &a, const Event &b)
+							{
+								if (*a.semester != *b.semester)
+								{
+									return *a.semester < *b.semester;
+								}
+								return a.slot.startMinute < b.slot.startMinute;
+							});
+
+					// Only enrollments of the same semester can clash, so each
+					// semester is swept on its own and reports its own pairs.
+					std::set<std::pair<unsigned int, unsigned int>> pairs;
+					std::size_t first = 0;
+					while (first < events.size())
+					{
+						const std::string &semester = *events[first].semester;
+						std::size_t last = first + 1;
+						while (last < events.size()
+								&& *events[last].semester == semester)
+						{
+							++last;
+						}
+						pairs.clear();
+						active.clear();
+						for (std::size_t e = first; e < last; ++e)
+						{
+							const Event &event = events[e];
+							int start = event.slot.startMinute;
+							active.erase(
+									std::remove_if(active.begin(), active.end(),
+											[start](const Event &other)
+											{	return other.slot.endMinute <= start;}),
+									active.end());
+							for (const auto &other : active)
+							{
+								unsigned int firstCourse = std::min(
+										other.slot.courseKey,
+										event.slot.courseKey);
+								unsigned int secondCourse = std::max(
+										other.slot.courseKey,
+										event.slot.courseKey);
+								if (firstCourse != secondCourse
+										&& CourseSchedule::overlaps(other.slot,
+												event.slot)
+										&& pairs.insert(std::make_pair(firstCourse,
+												secondCourse)).second)
+								{
+									found.push_back(
+									{	range[i]->getMatrikelNumber(),
+										semester, firstCourse, secondCourse});
+								}
+							}
+							active.push_back(event);
+						}
+						first = last;
+					}
+				}
+			});
+
+	std::vector<Clash> result;
+	for (const auto &partial : partials)
+	{
+		result.insert(result.end(), partial.begin(), partial.end());
+	}
+	return result;
+}
+
+std::size_t StudentDb::gradeBucketOf(float grade)
+{
+	int bucket = static_cast<int>(std::floor((grade - 1.0f) * 2.0f));
+	return static_cast<std::size_t>(
+			std::min(std::max(bucket, 0), static_cast<int>(gradeBuckets) - 1));
+}
+
+StudentDb::CourseStatistics StudentDb::getCourseStatistics(
+		unsigned int courseKey) const
+{
+	CourseStatistics stats =
+	{ courseKey, 0, 0, 0.0, 0.0, 0.0, {{}} };
+	auto it = this->courseAggregates.find(courseKey);
+	if (it == this->courseAggregates.end())
+	{
+		return stats;
+	}
+	const CourseAggregate &course = it->second;
+	stats.enrolledCount = course.enrolledCount;
+	stats.gradedCount = course.gradedCount;
+	stats.histogram = course.histogram;
+	if (course.gradedCount > 0)
+	{
+		double count = static_cast<double>(course.gradedCount);
+		stats.meanGrade = course.gradeSum / count;
+		double variance = course.gradeSquareSum / count
+				- stats.meanGrade * stats.meanGrade;
+		stats.standardDeviation = variance > 0 ? std::sqrt(variance) : 0.0;
+		stats.passRate = course.passedCount / count;
+	}
+	return stats;
+}
+
+std::vector<StudentDb::CourseStatistics> StudentDb::listCourseStatistics() const
+{
+	std::vector<CourseStatistics> list;
+	list.reserve(this->courses.size());
+	for (const auto &course : this->courses)
+	{
+		list.push_back(getCourseStatistics(course.first));
+	}
+	return list;
+}
+
+StudentDb::GradeSummary StudentDb::getGradeSummary(
+		unsigned int matrikelNumber) const
+{
+	GradeSummary summary =
+	{ matrikelNumber, 0.0, 0.0, 0.0, 0 };
+	auto it = this->gradeAggregates.find(matrikelNumber);
+	if (it != this->gradeAggregates.end())
+	{
+		const GradeAggregate &aggregate = it->second;
+		summary.gpa =
+				aggregate.creditSum > 0 ?
+						aggregate.weightedGradeSum / aggregate.creditSum : 0.0;
+		summary.gradedCredits = aggregate.creditSum;
+		summary.earnedCredits = aggregate.earnedCredits;
+		summary.gradedCount = aggregate.gradedCount;
+	}
+	return summary;
+}
+
+std::vector<StudentDb::GradeSummary> StudentDb::topStudentsByGpa(
+		std::size_t count) const
+{
+	// Lower grades are better, the heap keeps the worst kept entry on top.
+	// Averages within rounding noise of the running sums count as equal.
+	auto better = [](const GradeSummary &a, const GradeSummary &b)
+	{
+		if (std::abs(a.gpa - b.gpa) > 1e-9)
+		{
+			return a.gpa < b.gpa;
+		}
+		return a.matrikelNumber < b.matrikelNumber;
+	};
+	std::priority_queue<GradeSummary, std::vector<GradeSummary>,
+			decltype(better)> heap(better);
+	if (count == 0)
+	{
+		return std::vector<GradeSummary>();
+	}
+	for (const auto &entry : this->gradeAggregates)
+	{
+		GradeSummary summary = getGradeSummary(entry.first);
+		if (heap.size() < count)
+		{
+			heap.push(summary);
+		}
+		else if (better(summary, heap.top()))
+		{
+			heap.pop();
+			heap.push(summary);
+		}
+	}
+
+	std::vector<GradeSummary> ranking(heap.size());
+	for (std::size_t i = ranking.size(); i > 0; --i)
+	{
+		ranking[i - 1] = heap.top();
+		heap.pop();
+	}
+	return ranking;
+}
+
+TaskScheduler& StudentDb::getScheduler() const
+{
+	return *this->scheduler;
+}
+
 void StudentDb::updateName(unsigned int matrikelNumber, const std::string fName,
 		const std::string lName)
 {
-	this->students.at(matrikelNumber).setFirstName(fName);
-	this->students.at(matrikelNumber).setLastName(lName);
+	Student &student = this->students.at(matrikelNumber);
+	this->nameOrder.erase(
+	{ student.getLastName(), student.getFirstName(), matrikelNumber });
+	this->nameOrder.insert(
+	{ lName, fName, matrikelNumber });
+	student.setFirstName(fName);
+	student.setLastName(lName);
+	this->nameIndex.insert(matrikelNumber, fullNameOf(student));
+	this->nameScanner.insert(matrikelNumber, fullNameOf(student));
+	recordMutation(matrikelNumber);
 }
 
 void StudentDb::updateDOB(unsigned int matrikelNumber, const Poco::DateTime dob)
 {
-	this->students.at(matrikelNumber).setDateOfBirth(dob);
+	Student &student = this->students.at(matrikelNumber);
+	this->birthDateIndex.update(student.getBirthDate().getDayNumber(),
+			CompactDate::fromDateTime(dob).getDayNumber(), matrikelNumber);
+	student.setDateOfBirth(dob);
+	recordMutation(matrikelNumber);
 }
 
 void StudentDb::updateAddress(unsigned int matrikelNumber,
@@ -97,50 +945,122 @@ void StudentDb::updateAddress(unsigned int matrikelNumber,
 {
 	auto addressPtr = std::make_shared<Address>(street, postalCode, city,
 			additionalInfo);
-	this->students.at(matrikelNumber).setAddress(addressPtr);
+	Student &student = this->students.at(matrikelNumber);
+	this->postalCodeIndex.update(student.getAddress()->getPostalCode(),
+			postalCode, matrikelNumber);
+	student.setAddress(addressPtr);
+	recordMutation(matrikelNumber);
 }
 
 void StudentDb::updateGrade(unsigned int matrikelNumber, unsigned int courseKey,
 		float grade)
 {
-	this->students.at(matrikelNumber).updateGradeForCourse(courseKey, grade);
+	Student &student = this->students.at(matrikelNumber);
+	for (const auto &enrollment : student.getEnrollments())
+	{
+		if (enrollment.getCourse()->getCourseKey() == courseKey)
+		{
+			applyGrade(matrikelNumber, enrollment, -1);
+			break;
+		}
+	}
+	student.updateGradeForCourse(courseKey, grade);
+	for (const auto &enrollment : student.getEnrollments())
+	{
+		if (enrollment.getCourse()->getCourseKey() == courseKey)
+		{
+			applyGrade(matrikelNumber, enrollment, 1);
+			break;
+		}
+	}
+	recordMutation(matrikelNumber);
 }
 
 void StudentDb::deleteEnrollment(unsigned int matrikelNumber,
 		unsigned int courseKey)
 {
-	this->students.at(matrikelNumber).deleteEnrollment(courseKey);
+	Student &student = this->students.at(matrikelNumber);
+	for (const auto &enrollment : student.getEnrollments())
+	{
+		if (enrollment.getCourse()->getCourseKey() == courseKey)
+		{
+			applyGrade(matrikelNumber, enrollment, -1);
+			--this->courseAggregates[courseKey].enrolledCount;
+			if (!this->rollupsDeferred)
+			{
+				for (auto &rollup : this->rollups)
+				{
+					rollup.second.countEnrollment(enrollment, -1);
+				}
+			}
+			break;
+		}
+	}
+	student.deleteEnrollment(courseKey);
+	recordMutation(matrikelNumber);
 }
 
-void StudentDb::write(std::ostream &out)
+void StudentDb::write(std::ostream &out, unsigned int firstMatrikel,
+		unsigned int lastMatrikel)
 {
 	out << this->getCourses().size() << std::endl;
 	for (const auto &course : this->getCourses())
 	{
 		course.second->write(out);
 	}
+
+	// Students and enrollments are serialized chunk-wise in parallel and
+	// then emitted in matrikel order.
+	auto range = getStudentRange(firstMatrikel, lastMatrikel);
+	std::size_t grain = this->scheduler->defaultGrainSize(range.size());
+	std::size_t chunkCount = (range.size() + grain - 1) / grain;
+	std::vector<std::string> studentChunks(chunkCount);
+	std::vector<std::string> enrollmentChunks(chunkCount);
+	std::vector<std::size_t> enrollmentCounts(chunkCount, 0);
+
+	this->scheduler->parallelFor(0, range.size(), grain,
+			[&](std::size_t begin, std::size_t end)
+			{
+				std::size_t chunk = begin / grain;
+				std::ostringstream studentOut;
+				std::ostringstream enrollmentOut;
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					const Student &student = *range[i];
+					studentOut << student.getMatrikelNumber() << ";";
+					student.write(studentOut);
+					for (const auto &enrollment : student.getEnrollments())
+					{
+						enrollmentOut << student.getMatrikelNumber() << ";";
+						enrollment.write(enrollmentOut);
+						++enrollmentCounts[chunk];
+					}
+				}
+				studentChunks[chunk] = studentOut.str();
+				enrollmentChunks[chunk] = enrollmentOut.str();
+			});
+
 	size_t enrollmentSize = 0;
-	out << this->getStudents().size() << std::endl;
-	for (const auto &student : this->getStudents())
+	out << range.size() << std::endl;
+	for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
 	{
-		enrollmentSize += student.second.getEnrollments().size();
-		out << student.first << ";";
-		student.second.write(out);
+		out << studentChunks[chunk];
+		enrollmentSize += enrollmentCounts[chunk];
 	}
 	out << enrollmentSize << std::endl;
-	for (const auto &student : this->getStudents())
+	for (const auto &chunk : enrollmentChunks)
 	{
-		for (const auto &enrollment : student.second.getEnrollments())
-		{
-			out << student.first;
-			out << ";";
-			enrollment.write(out);
-		}
+		out << chunk;
 	}
 
 }
-bool StudentDb::read(std::istream &in)
+bool StudentDb::read(std::istream &in, const RecordValidator *validator,
+		unsigned int *rejected, bool keepMatrikelNumbers)
 {
+	if (rejected != nullptr)
+	{
+		*rejected = 0;
+	}
 	clearDatabase();
 	bool status = false;
 	bool noCourses = false;
@@ -158,6 +1078,7 @@ bool StudentDb::read(std::istream &in)
 			auto courseKey = course->getCourseKey();
 			if (!courseExists(courseKey))
 			{
+				this->schedule.insert(*course);
 				this->courses.insert(
 				{ courseKey, std::move(course) });
 				status = true;
@@ -183,33 +1104,106 @@ bool StudentDb::read(std::istream &in)
 		in.ignore();
 	}
 
+	// Student records are one per line: the lines are collected first and
+	// parsed in parallel, matrikel numbers are reserved in file order.
+	std::vector<std::string> studentLines;
 	for (int i = 0; i < studentsCount; ++i)
 	{
-		std::string inp1;
-		std::getline(in, inp1, ';');
+		std::string line;
+		std::getline(in, line);
 		if (firstItr)
 		{
-			try
-			{
-				std::stoi(inp1);
-				studentDataExists = true;
-			} catch (std::invalid_argument &e)
+			int matrikelNumber;
+			std::string_view first;
+			FieldParser fields(line);
+			if (!fields.next(first)
+					|| !FieldParser::parseInt(first, matrikelNumber))
 			{
 				return false;
 			}
+			studentDataExists = true;
 		}
 		firstItr = false;
+		studentLines.push_back(line);
+	}
 
-		if (!studentDataExists)
+	// Matrikel number of the file to the number in the database, rejected
+	// students map to 0, so their enrollments are skipped as well.
+	std::unordered_map<unsigned int, unsigned int> assigned;
+	if (!studentLines.empty())
+	{
+		unsigned int firstMatrikel = keepMatrikelNumbers ?
+				0 : Student::reserveMatrikelNumbers(
+						static_cast<unsigned int>(studentLines.size()));
+		std::vector<std::unique_ptr<Student>> parsed(studentLines.size());
+		std::vector<unsigned int> fileNumbers(studentLines.size());
+		this->scheduler->parallelFor(0, studentLines.size(), 0,
+				[&](std::size_t begin, std::size_t end)
+				{
+					for (std::size_t i = begin; i < end; ++i)
+					{
+						FieldParser fields(studentLines[i]);
+						unsigned int matrikelNumber = fields.unsignedInteger();
+						fileNumbers[i] = matrikelNumber;
+						if (!keepMatrikelNumbers)
+						{
+							matrikelNumber = firstMatrikel
+									+ static_cast<unsigned int>(i);
+						}
+						try
+						{
+							if (validator != nullptr)
+							{
+								// Check the text fields on a copy before
+								// anything is allocated for the student.
+								FieldParser check = fields;
+								std::string_view firstName = check.text();
+								std::string_view lastName = check.text();
+								check.text();
+								std::string_view street = check.text();
+								check.text();
+								std::string_view city = check.text();
+								if (!validator->isValid(firstName, lastName,
+										street, city, check.remainder()))
+								{
+									continue;
+								}
+							}
+							parsed[i] = std::make_unique<Student>(
+									Student::read(fields, matrikelNumber));
+						} catch (const std::invalid_argument&)
+						{
+							// Malformed fields, e.g. an impossible date,
+							// skip the student like a rejected one.
+						}
+					}
+				});
+		unsigned int skipped = 0;
+		for (std::size_t i = 0; i < parsed.size(); ++i)
 		{
-			return false;
+			std::unique_ptr<Student> &student = parsed[i];
+			if (!student)
+			{
+				assigned[fileNumbers[i]] = 0;
+				++skipped;
+				continue;
+			}
+			assigned[fileNumbers[i]] = student->getMatrikelNumber();
+			if (keepMatrikelNumbers)
+			{
+				Student::skipMatrikelNumbersThrough(
+						student->getMatrikelNumber());
+			}
+			indexStudent(*student);
+			this->students.insert(
+					std::make_pair(student->getMatrikelNumber(),
+							std::move(*student)));
+		}
+		if (rejected != nullptr)
+		{
+			*rejected = skipped;
 		}
-
-		auto student = Student::read(in);
-		this->students.insert(
-				std::make_pair(student.getMatrikelNumber(), student));
 		status = true;
-
 	}
 
 	if (studentDataExists && !noCourses)
@@ -217,24 +1211,60 @@ bool StudentDb::read(std::istream &in)
 		//enrollments
 		int enrollments;
 		unsigned int matrikelNumber;
-		std::string inp;
 		unsigned int courseKey;
 		std::string semester;
 		float grade;
 
 		in >> enrollments;
 		in.ignore();
-		for (int i = 0; i < enrollments; ++i)
+
+		std::vector<std::string> enrollmentLines(
+				enrollments > 0 ? enrollments : 0);
+		for (auto &line : enrollmentLines)
 		{
-			std::getline(in, inp, ';');
-			matrikelNumber = static_cast<unsigned int>(std::stoi(inp));
+			std::getline(in, line);
+		}
 
-			std::getline(in, inp, ';');
-			courseKey = static_cast<unsigned int>(std::stoi(inp));
+		struct EnrollmentRecord
+		{
+			unsigned int matrikelNumber;
+			unsigned int courseKey;
+			std::string semester;
+			float grade;
+		};
+		std::vector<EnrollmentRecord> records(enrollmentLines.size());
+		this->scheduler->parallelFor(0, enrollmentLines.size(), 0,
+				[&](std::size_t begin, std::size_t end)
+				{
+					for (std::size_t i = begin; i < end; ++i)
+					{
+						FieldParser fields(enrollmentLines[i]);
+						records[i].matrikelNumber = fields.unsignedInteger();
+						records[i].courseKey = fields.unsignedInteger();
 
-			auto eObj = Enrollment::read(in);
-			semester = eObj.getSemester();
-			grade = eObj.getGrade();
+						auto eObj = Enrollment::read(fields);
+						records[i].semester = eObj.getSemester();
+						records[i].grade = eObj.getGrade();
+					}
+				});
+
+		this->rollupsDeferred = true;
+		for (const auto &record : records)
+		{
+			auto student = assigned.find(record.matrikelNumber);
+			if (student == assigned.end())
+			{
+				status = false;
+				continue;
+			}
+			if (student->second == 0)
+			{
+				continue;
+			}
+			matrikelNumber = student->second;
+			courseKey = record.courseKey;
+			semester = record.semester;
+			grade = record.grade;
 
 			if (matrikelNumberExists(matrikelNumber) && courseExists(courseKey))
 			{
@@ -248,15 +1278,71 @@ bool StudentDb::read(std::istream &in)
 				status = false;
 			}
 		}
+		this->rollupsDeferred = false;
+		rebuildRollups();
 	}
 
+	resetVersions();
 	return status;
 }
 void StudentDb::clearDatabase()
 {
 	this->courses.clear();
 	this->students.clear();
+	this->nameIndex.clear();
+	this->nameScanner.clear();
+	this->nameOrder.clear();
+	this->birthDateIndex.clear();
+	this->postalCodeIndex.clear();
+	this->gradeAggregates.clear();
+	this->courseAggregates.clear();
+	this->schedule.clear();
+	for (auto &rollup : this->rollups)
+	{
+		rollup.second.clear();
+	}
+	resetVersions();
+}
+
+void StudentDb::recordMutation(unsigned int matrikelNumber)
+{
+	++this->version;
+	this->changeJournal.push_back(std::make_pair(this->version, matrikelNumber));
+	if (this->changeJournal.size() > changeJournalCapacity)
+	{
+		this->journalFloor = this->changeJournal.front().first;
+		this->changeJournal.pop_front();
+	}
+}
+
+void StudentDb::resetVersions()
+{
+	++this->version;
+	this->journalFloor = this->version;
+	this->changeJournal.clear();
+}
 
+unsigned long long StudentDb::getVersion() const
+{
+	return this->version;
+}
+
+bool StudentDb::getChangedStudents(unsigned long long since,
+		std::vector<unsigned int> &changed) const
+{
+	if (since < this->journalFloor)
+	{
+		return false;
+	}
+	for (auto it = this->changeJournal.rbegin();
+			it != this->changeJournal.rend() && it->first > since; ++it)
+	{
+		if (it->second != 0)
+		{
+			changed.push_back(it->second);
+		}
+	}
+	return true;
 }
 StudentDb::~StudentDb()
 {
@@ -8,7 +8,12 @@
 #ifndef STUDENTDB_H_
 #define STUDENTDB_H_
 
+#include <array>
+#include <deque>
+#include <limits>
 #include <map>
+#include <set>
+#include <unordered_map>
 #include <memory>
 #include <fstream>
 #include <sstream>
@@ -18,6 +23,15 @@
 #include "Course.h"
 #include "BlockCourse.h"
 #include "WeeklyCourse.h"
+#include "TaskScheduler.h"
+#include "TrigramIndex.h"
+#include "NameScanner.h"
+#include "StudentQuery.h"
+#include "RangeIndex.h"
+#include "RollupView.h"
+#include "CourseSchedule.h"
+#include "RecordValidator.h"
+#include "StudentRecord.h"
 
 /**
  * @class StudentDb
@@ -25,20 +39,236 @@
  */
 class StudentDb
 {
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Aggregated figures over all students and enrollments.
+	 */
+	struct Statistics
+	{
+		std::size_t studentCount; ///< Number of students.
+		std::size_t courseCount; ///< Number of courses.
+		std::size_t enrollmentCount; ///< Number of enrollments.
+		std::size_t gradedEnrollmentCount; ///< Number of enrollments with a grade.
+		double averageGrade; ///< Mean grade over the graded enrollments.
+	};
+
+	/**
+	 * @struct GradeSummary
+	 * @brief Credit weighted grade figures of one student.
+	 */
+	struct GradeSummary
+	{
+		unsigned int matrikelNumber; ///< The student's unique identifier.
+		double gpa; ///< Credit weighted average grade, 0 without grades.
+		double gradedCredits; ///< Credit points of the graded enrollments.
+		double earnedCredits; ///< Credit points of the passed enrollments.
+		unsigned int gradedCount; ///< Number of graded enrollments.
+	};
+
+	/**
+	 * @brief Number of histogram buckets, 0.5 grade steps from 1.0 to 5.0.
+	 */
+	static const std::size_t gradeBuckets = 8;
+
+	/**
+	 * @struct CourseStatistics
+	 * @brief Grade distribution of one course.
+	 */
+	struct CourseStatistics
+	{
+		unsigned int courseKey; ///< The unique identifier for the course.
+		std::size_t enrolledCount; ///< Number of enrollments.
+		std::size_t gradedCount; ///< Number of graded enrollments.
+		double meanGrade; ///< Mean over the graded enrollments, 0 without grades.
+		double standardDeviation; ///< Standard deviation of the grades.
+		double passRate; ///< Share of the graded enrollments that passed.
+		std::array<std::size_t, gradeBuckets> histogram; ///< Grades per bucket, bucket i covers [1.0 + i/2, 1.5 + i/2).
+	};
+
+	/**
+	 * @struct Clash
+	 * @brief Two enrollments of a student that take place at the same time.
+	 */
+	struct Clash
+	{
+		unsigned int matrikelNumber; ///< The student's unique identifier.
+		std::string semester; ///< Semester of both enrollments.
+		unsigned int firstCourse; ///< Key of the course with the lower key.
+		unsigned int secondCourse; ///< Key of the course with the higher key.
+	};
+
+	/**
+	 * @struct NameKey
+	 * @brief Entry of the ordered name index.
+	 */
+	struct NameKey
+	{
+		std::string lastName; ///< Student's last name, primary sort key.
+		std::string firstName; ///< Student's first name, secondary sort key.
+		unsigned int matrikelNumber; ///< Tie breaker for equal names.
+
+		/**
+		 * @brief Orders by last name, first name, matrikel number.
+		 * @param other Key to compare with.
+		 * @return True if this key sorts before other.
+		 */
+		bool operator<(const NameKey &other) const;
+	};
+
+	/**
+	 * @struct QueryResult
+	 * @brief Rows produced by executeQuery().
+	 */
+	struct QueryResult
+	{
+		std::vector<std::string> columns; ///< Names of the projected columns.
+		std::vector<std::vector<std::string>> rows; ///< One row per student in matrikel order.
+		std::vector<unsigned int> matrikelNumbers; ///< Student of each row.
+		std::string plan; ///< Access path chosen by the planner.
+	};
+
+	/**
+	 * @struct NamePage
+	 * @brief One page of the ordered student listing.
+	 */
+	struct NamePage
+	{
+		std::vector<NameKey> entries; ///< Students of this page in name order.
+		bool hasMore; ///< True if further students follow.
+		NameKey nextCursor; ///< Cursor to pass for the following page.
+	};
+
 private:
 	std::map<int, Student> students; ///< Stores student records indexed by matrikel number.
 	std::map<int, std::unique_ptr<Course>> courses; ///< Stores courses, allowing polymorphic course management.
+	std::unique_ptr<TaskScheduler> scheduler; ///< Worker pool for the bulk operations.
+	TrigramIndex nameIndex; ///< Trigram index over "first last" of every student.
+	NameScanner nameScanner; ///< Contiguous case folded names for unindexed scans.
+	std::set<NameKey> nameOrder; ///< Students ordered by (last name, first name, matrikel).
+	RangeIndex<int> birthDateIndex; ///< Students by day number of their date of birth.
+	RangeIndex<unsigned short> postalCodeIndex; ///< Students by postal code.
+	/**
+	 * @struct GradeAggregate
+	 * @brief Running sums over the graded enrollments of a student.
+	 */
+	struct GradeAggregate
+	{
+		double weightedGradeSum = 0.0; ///< Sum of grade times credit points.
+		double creditSum = 0.0; ///< Sum of the credit points.
+		double earnedCredits = 0.0; ///< Sum of the credit points of passed courses.
+		unsigned int gradedCount = 0; ///< Number of graded enrollments.
+	};
 
 	/**
-	 * @brief Clears the current state of the database, removing all students and courses.
+	 * @struct CourseAggregate
+	 * @brief Running moments and histogram of the grades of a course.
 	 */
-	void clearDatabase();
+	struct CourseAggregate
+	{
+		std::size_t enrolledCount = 0; ///< Number of enrollments.
+		std::size_t gradedCount = 0; ///< Number of graded enrollments.
+		std::size_t passedCount = 0; ///< Number of passed enrollments.
+		double gradeSum = 0.0; ///< Sum of the grades.
+		double gradeSquareSum = 0.0; ///< Sum of the squared grades.
+		std::array<std::size_t, gradeBuckets> histogram = {{}}; ///< Grades per bucket.
+	};
+
+	CourseSchedule schedule; ///< Time slots of all courses for clash detection.
+	std::map<std::string, RollupView> rollups; ///< Registered materialized views by name.
+	bool rollupsDeferred; ///< True while a bulk load postpones view maintenance.
+	std::unordered_map<unsigned int, CourseAggregate> courseAggregates; ///< Grade distribution by course key, kept up to date by every grade change.
+	std::unordered_map<unsigned int, GradeAggregate> gradeAggregates; ///< Grade sums by matrikel number, kept up to date by every grade change.
+	unsigned long long version; ///< Global mutation counter.
+	unsigned long long journalFloor; ///< Oldest version the change journal covers.
+	std::deque<std::pair<unsigned long long, unsigned int>> changeJournal; ///< Recent (version, matrikel number) changes, 0 for course-only changes.
+
+	/**
+	 * @brief Bumps the version and journals the change after a mutation.
+	 * @param matrikelNumber Changed student, 0 if none.
+	 */
+	void recordMutation(unsigned int matrikelNumber);
+
+	/**
+	 * @brief Bumps the global version and empties the change journal,
+	 * used after bulk loads.
+	 */
+	void resetVersions();
+
+	/**
+	 * @brief Maps a grade to its histogram bucket.
+	 * @param grade Grade between 1.0 and 5.0.
+	 * @return Bucket index, clamped to the histogram.
+	 */
+	static std::size_t gradeBucketOf(float grade);
+
+	/**
+	 * @brief Adds or removes a grade in the student's and course's running sums.
+	 * @param matrikelNumber The student's unique identifier.
+	 * @param enrollment The enrollment whose grade is counted.
+	 * @param sign 1 to add the grade, -1 to remove it.
+	 */
+	void applyGrade(unsigned int matrikelNumber, const Enrollment &enrollment,
+			int sign);
+
+	/**
+	 * @brief Recomputes every registered view from all enrollments in parallel.
+	 */
+	void rebuildRollups();
+
+	/**
+	 * @brief Adds a student to all secondary indexes.
+	 * @param student The student.
+	 */
+	void indexStudent(const Student &student);
+
+	/**
+	 * @brief Estimates the candidates indexCandidates() would return,
+	 * without collecting them.
+	 * @param predicate The condition.
+	 * @param estimate Receives an upper bound of the candidate count.
+	 * @return False if no index covers the predicate.
+	 */
+	bool estimateCandidates(const QueryPredicate &predicate,
+			std::size_t &estimate) const;
+
+	/**
+	 * @brief Serves a predicate from a secondary index if one fits.
+	 *
+	 * A case-insensitive name predicate is served by scanning the names,
+	 * which is still cheaper than scanning the students.
+	 * @param predicate The condition.
+	 * @param candidates Receives the matching matrikel numbers in ascending order.
+	 * @return False if no index covers the predicate.
+	 */
+	bool indexCandidates(const QueryPredicate &predicate,
+			std::vector<unsigned int> &candidates) const;
+
+	/**
+	 * @brief Builds the text stored in the name index for a student.
+	 * @param student The student.
+	 * @return "first last".
+	 */
+	static std::string fullNameOf(const Student &student);
+
+	/**
+	 * @brief Collects pointers to the students of a matrikel range in
+	 * matrikel order.
+	 * @param firstMatrikel Smallest matrikel number to include.
+	 * @param lastMatrikel Largest matrikel number to include.
+	 * @return Random access view of the students map for parallelFor().
+	 */
+	std::vector<const Student*> getStudentRange(unsigned int firstMatrikel = 0,
+			unsigned int lastMatrikel =
+					std::numeric_limits<unsigned int>::max()) const;
 
 public:
 	/**
 	 * @brief Initializes a new Student Database.
+	 * @param workerCount Number of worker threads for the bulk operations,
+	 * 0 selects the hardware concurrency.
 	 */
-	StudentDb();
+	explicit StudentDb(unsigned int workerCount = 0);
 
 	/**
 	 * @brief Determines if a course exists in the database.
@@ -47,6 +277,11 @@ public:
 	 */
 	bool courseExists(int courseKey) const;
 
+	/**
+	 * @brief Clears the current state of the database, removing all students and courses.
+	 */
+	void clearDatabase();
+
 	/**
 	 * @brief Checks for the existence of a student by their matrikel number.
 	 * @param matrikelNumber The student's unique identifier.
@@ -54,6 +289,15 @@ public:
 	 */
 	bool matrikelNumberExists(int matrikelNumber) const;
 
+	/**
+	 * @brief Checks whether a student is enrolled in a course.
+	 * @param matrikelNumber The student's unique identifier.
+	 * @param courseKey The unique identifier for the course.
+	 * @return True if the student exists and has an enrollment for the course.
+	 */
+	bool enrollmentExists(unsigned int matrikelNumber,
+			unsigned int courseKey) const;
+
 	/**
 	 * @brief Retrieves the courses map.
 	 * @return A reference to the map storing unique pointers to Course objects.
@@ -66,6 +310,250 @@ public:
 	 */
 	std::map<int, Student> getStudents() const;
 
+	/**
+	 * @brief Retrieves a single student without copying the students map.
+	 * @param matrikelNumber The student's unique identifier.
+	 * @return Reference to the student, throws std::out_of_range if unknown.
+	 */
+	const Student& getStudent(unsigned int matrikelNumber) const;
+
+	/**
+	 * @brief Searches all students whose "first last" name contains a string.
+	 *
+	 * Case sensitive queries of at least three characters are answered from
+	 * the trigram index. Case insensitive and shorter queries use a
+	 * vectorized scan over all names, split across the worker pool.
+	 * @param searchStr The substring to look for.
+	 * @param ignoreCase True to compare ASCII letters case insensitively.
+	 * @return Matrikel numbers of the matching students in ascending order.
+	 */
+	std::vector<unsigned int> searchStudents(const std::string &searchStr,
+			bool ignoreCase = false) const;
+
+	/**
+	 * @brief Finds students whose last name starts with a prefix.
+	 * @param prefix Beginning of the last name, case sensitive.
+	 * @param limit Maximum number of results.
+	 * @return Matching entries in name order.
+	 */
+	std::vector<NameKey> findByLastNamePrefix(const std::string &prefix,
+			std::size_t limit) const;
+
+	/**
+	 * @brief Lists students in name order starting at a cursor.
+	 *
+	 * Use NameKey{lastName, "", 0} to start at a last name and the returned
+	 * NamePage::nextCursor to continue. A page costs O(log n + pageSize).
+	 * @param cursor First key to include.
+	 * @param pageSize Maximum number of entries.
+	 * @param prefix Only list last names with this prefix, empty for all.
+	 * @return The page.
+	 */
+	NamePage listStudentsByName(const NameKey &cursor, std::size_t pageSize,
+			const std::string &prefix = "") const;
+
+	/**
+	 * @brief Converts a calendar date to a day number.
+	 * @param year Year.
+	 * @param month Month, 1..12.
+	 * @param day Day of the month.
+	 * @return Days since 01.01.1970, negative before.
+	 */
+	static int toDayNumber(int year, int month, int day);
+
+	/**
+	 * @brief Finds the students born within a date range.
+	 * @param from First date, inclusive.
+	 * @param to Last date, inclusive.
+	 * @return Matrikel numbers ordered by date of birth.
+	 */
+	std::vector<unsigned int> findByBirthDate(const Poco::DateTime &from,
+			const Poco::DateTime &to) const;
+
+	/**
+	 * @brief Counts the students born within a date range.
+	 * @param from First date, inclusive.
+	 * @param to Last date, inclusive.
+	 * @return Number of students.
+	 */
+	std::size_t countByBirthDate(const Poco::DateTime &from,
+			const Poco::DateTime &to) const;
+
+	/**
+	 * @brief Finds the students with a postal code within a range.
+	 * @param low Lowest postal code, inclusive.
+	 * @param high Highest postal code, inclusive.
+	 * @return Matrikel numbers ordered by postal code.
+	 */
+	std::vector<unsigned int> findByPostalCode(unsigned short low,
+			unsigned short high) const;
+
+	/**
+	 * @brief Counts the students with a postal code within a range.
+	 * @param low Lowest postal code, inclusive.
+	 * @param high Highest postal code, inclusive.
+	 * @return Number of students.
+	 */
+	std::size_t countByPostalCode(unsigned short low,
+			unsigned short high) const;
+
+	/**
+	 * @brief Runs a query.
+	 *
+	 * The planner estimates the candidates of every predicate's index and
+	 * collects only those of the smallest estimate, all predicates are then
+	 * verified on them. Without a usable index the students are scanned in
+	 * parallel.
+	 * @param query The query.
+	 * @return Projected rows, limited to the query's limit.
+	 */
+	QueryResult executeQuery(const StudentQuery &query) const;
+
+	/**
+	 * @brief Maximum number of entries kept in the change journal.
+	 */
+	static const std::size_t changeJournalCapacity = 4096;
+
+	/**
+	 * @brief Returns the global mutation counter.
+	 * @return Version that changes with every mutation.
+	 */
+	unsigned long long getVersion() const;
+
+	/**
+	 * @brief Lists the students changed after a version.
+	 * @param since Version to compare with.
+	 * @param changed Receives the matrikel numbers, possibly with duplicates.
+	 * @return False if the journal does not reach back to that version.
+	 */
+	bool getChangedStudents(unsigned long long since,
+			std::vector<unsigned int> &changed) const;
+
+	/**
+	 * @brief Highest grade that still counts as passed.
+	 */
+	static constexpr float passingGrade = 4.0f;
+
+	/**
+	 * @brief Returns the credit weighted grade figures of a student in O(1).
+	 * @param matrikelNumber The student's unique identifier.
+	 * @return The figures, all zero if the student has no grades.
+	 */
+	GradeSummary getGradeSummary(unsigned int matrikelNumber) const;
+
+	/**
+	 * @brief Ranks the students with the best credit weighted average.
+	 *
+	 * A bounded heap of count entries is kept while walking the aggregates,
+	 * so the cost is O(students log count) instead of a full sort.
+	 * @param count Maximum number of students to return.
+	 * @return Best students first, ties ordered by matrikel number.
+	 */
+	std::vector<GradeSummary> topStudentsByGpa(std::size_t count) const;
+
+	/**
+	 * @brief Returns the grade distribution of a course in O(1).
+	 * @param courseKey The unique identifier for the course.
+	 * @return The distribution, all zero if nobody is enrolled.
+	 */
+	CourseStatistics getCourseStatistics(unsigned int courseKey) const;
+
+	/**
+	 * @brief Returns the grade distribution of every course in O(courses).
+	 * @return One entry per course in course key order.
+	 */
+	std::vector<CourseStatistics> listCourseStatistics() const;
+
+	/**
+	 * @brief Registers a materialized group-by view over all enrollments.
+	 *
+	 * The view is built immediately and afterwards maintained by every
+	 * enrollment and grade change. The views "semester_major" and
+	 * "semester_course" are registered by default.
+	 * @param name Name to retrieve the view by, replaces an existing view.
+	 * @param dimensions Bit mask of RollupView::Dimension values.
+	 */
+	void registerRollup(const std::string &name, unsigned int dimensions);
+
+	/**
+	 * @brief Returns a registered view.
+	 * @param name Name of the view.
+	 * @return The view, throws std::out_of_range if unknown.
+	 */
+	const RollupView& getRollup(const std::string &name) const;
+
+	/**
+	 * @brief Lists the registered views.
+	 * @return View names in alphabetical order.
+	 */
+	std::vector<std::string> getRollupNames() const;
+
+	/**
+	 * @brief Finds the enrollments a new enrollment would clash with.
+	 *
+	 * Only enrollments of the same semester are compared, each comparison is
+	 * a lookup in the precomputed course clashes.
+	 * @param matrikelNumber The student's unique identifier.
+	 * @param courseKey Course to enroll in.
+	 * @param semester Semester of the new enrollment.
+	 * @return Keys of the clashing courses the student is enrolled in.
+	 */
+	std::vector<unsigned int> findClashes(unsigned int matrikelNumber,
+			unsigned int courseKey, const std::string &semester) const;
+
+	/**
+	 * @brief Reports all clashing enrollments of all students.
+	 *
+	 * The slots of every student are swept in start order per semester, so
+	 * only slots of the same semester that are active at the same time are
+	 * compared. A pair clashing in several semesters is reported for each.
+	 * Students are processed in parallel.
+	 * @return Clashes ordered by matrikel number.
+	 */
+	std::vector<Clash> findAllClashes() const;
+
+	/**
+	 * @brief Finds the courses taking place within a weekly time range.
+	 * @param day Day of the week.
+	 * @param start Start of the range.
+	 * @param end End of the range, exclusive.
+	 * @return Keys of the courses in ascending order.
+	 */
+	std::vector<unsigned int> findCoursesDuring(
+			Poco::DateTime::DaysOfWeek day, const Poco::Data::Time &start,
+			const Poco::Data::Time &end) const;
+
+	/**
+	 * @brief Combines the weekly slots of a student's enrollments.
+	 * @param matrikelNumber The student's unique identifier.
+	 * @param semester Only count enrollments of this semester, empty for all.
+	 * @return The occupied slots.
+	 */
+	WeekBitmap getStudentOccupancy(unsigned int matrikelNumber,
+			const std::string &semester) const;
+
+	/**
+	 * @brief Finds the free time of a student within a weekly window.
+	 * @param matrikelNumber The student's unique identifier.
+	 * @param semester Only count enrollments of this semester, empty for all.
+	 * @param window Slots to consider, e.g. working hours.
+	 * @return Free (start minute, end minute) ranges since Sunday 00:00.
+	 */
+	std::vector<std::pair<int, int>> findFreeTime(unsigned int matrikelNumber,
+			const std::string &semester, const WeekBitmap &window) const;
+
+	/**
+	 * @brief Computes aggregated figures over all students and enrollments.
+	 * @return The statistics.
+	 */
+	Statistics computeStatistics() const;
+
+	/**
+	 * @brief Returns the worker pool used for the bulk operations.
+	 * @return Reference to the scheduler.
+	 */
+	TaskScheduler& getScheduler() const;
+
 	/**
 	 * @brief Adds a new BlockCourse to the database.
 	 */
@@ -84,12 +572,36 @@ public:
 
 	/**
 	 * @brief Registers a new student in the database.
+	 * @return The matrikel number assigned to the student.
 	 */
-	void addStudent(const std::string fName, const std::string lName,
+	unsigned int addStudent(const std::string fName, const std::string lName,
 			const Poco::DateTime dob, const std::string street,
 			unsigned short postalCode, const std::string city,
 			const std::string additionalInfo);
 
+	/**
+	 * @brief Registers several new students at once.
+	 *
+	 * The students get one block of consecutive matrikel numbers, so they
+	 * are appended behind the existing ones without searching the student
+	 * map, and their strings are moved instead of copied.
+	 * @param records Students to add, in the order they are numbered. The
+	 * strings are moved from.
+	 * @return The matrikel number assigned to the first student.
+	 */
+	unsigned int addStudents(std::vector<StudentRecord> &records);
+
+	/**
+	 * @brief Registers a student under a matrikel number assigned elsewhere,
+	 * e.g. by a replication primary. Numbers assigned later continue after
+	 * it.
+	 * @return False if the matrikel number is taken.
+	 */
+	bool restoreStudent(unsigned int matrikelNumber, const std::string fName,
+			const std::string lName, const Poco::DateTime dob,
+			const std::string street, unsigned short postalCode,
+			const std::string city, const std::string additionalInfo);
+
 	/**
 	 * @brief Enrolls a student in a specified course.
 	 */
@@ -127,16 +639,32 @@ public:
 
 	/**
 	 * @brief Serializes the database to an output stream.
+	 *
+	 * With a matrikel range, all courses but only the students of the range
+	 * and their enrollments are written, e.g. for one shard.
 	 * @param out The output stream to write data to.
+	 * @param firstMatrikel Smallest matrikel number to write.
+	 * @param lastMatrikel Largest matrikel number to write.
 	 */
-	void write(std::ostream &out);
+	void write(std::ostream &out, unsigned int firstMatrikel = 0,
+			unsigned int lastMatrikel = std::numeric_limits<unsigned int>::max());
 
 	/**
 	 * @brief Deserializes data from an input stream to populate the database.
 	 * @param in The input stream from which to read data.
+	 * @param validator Rules for the text fields of the students, nullptr
+	 * accepts every student line. Students breaking a rule or with malformed
+	 * fields, e.g. an impossible date, are skipped, so are their
+	 * enrollments.
+	 * @param rejected Receives the number of skipped students, may be
+	 * nullptr.
+	 * @param keepMatrikelNumbers If true, the students keep the matrikel
+	 * numbers of the file, e.g. for a replica. Otherwise they get new ones in
+	 * file order.
 	 * @return True if the operation is successful, otherwise false.
 	 */
-	bool read(std::istream &in);
+	bool read(std::istream &in, const RecordValidator *validator = nullptr,
+			unsigned int *rejected = nullptr, bool keepMatrikelNumbers = false);
 
 	/**
 	 * @brief Destructs the StudentDb object, freeing up resources.
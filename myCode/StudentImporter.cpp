@@ -0,0 +1,352 @@
+/**
+ * @file StudentImporter.cpp
+ * @brief StudentImporter class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentImporter.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "SocketChannel.h"
+
+using boost::asio::ip::tcp;
+
+double StudentImporter::Statistics::recordsPerSecond() const
+{
+	return this->seconds > 0 ? this->received / this->seconds : 0;
+}
+
+/**
+ * @class StudentImporter::Connection
+ * @brief One connection of the pool, only used on the I/O thread.
+ *
+ * An answer consists of a header line, the record and a trailer line. A
+ * request counts as answered when its trailer has arrived.
+ */
+class StudentImporter::Connection: public std::enable_shared_from_this<
+		StudentImporter::Connection>
+{
+private:
+	StudentImporter &importer; ///< Owner of the pool.
+	SocketChannel channel; ///< Socket to the generator.
+	std::string record; ///< Record of the answer being read.
+	std::deque<std::chrono::steady_clock::time_point> sentAt; ///< Queue times of the requests in flight.
+	unsigned int inFlight = 0; ///< Requests sent but not answered.
+	unsigned int line = 0; ///< Line of the current answer, 0 to 2.
+	bool connected = false; ///< Set once the connection is established.
+	bool quitting = false; ///< Set after "quit" was queued.
+
+	void read()
+	{
+		auto self = shared_from_this();
+		this->channel.read([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->fail();
+				return;
+			}
+			std::string &input = self->channel.getInput();
+			std::size_t start = 0;
+			std::size_t end;
+			while ((end = input.find('\n', start)) != std::string::npos)
+			{
+				if (self->line == 1)
+				{
+					self->record.assign(input, start, end - start);
+				}
+				start = end + 1;
+				self->line = (self->line + 1) % 3;
+				if (self->line == 0)
+				{
+					std::chrono::duration<float, std::milli> latency =
+							std::chrono::steady_clock::now()
+									- self->sentAt.front();
+					self->sentAt.pop_front();
+					--self->inFlight;
+					self->importer.deliver(self->record, latency.count());
+					self->fill();
+				}
+			}
+			input.erase(0, start);
+			self->read();
+		});
+	}
+
+	void flush()
+	{
+		if (this->channel.isWriting() || this->channel.isClosed())
+		{
+			return;
+		}
+		if (this->channel.getOutbox().empty())
+		{
+			if (this->quitting)
+			{
+				this->close();
+			}
+			return;
+		}
+		auto self = shared_from_this();
+		this->channel.write([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->fail();
+				return;
+			}
+			self->flush();
+		});
+	}
+
+	void close()
+	{
+		this->channel.close();
+	}
+
+	void fail()
+	{
+		if (!this->channel.close())
+		{
+			return;
+		}
+		if (this->quitting)
+		{
+			return;
+		}
+		++this->importer.statistics.connectionsFailed;
+		--this->importer.liveConnections;
+		unsigned int lost = this->inFlight;
+		this->inFlight = 0;
+		this->sentAt.clear();
+		this->importer.reassign(lost);
+	}
+
+public:
+	Connection(StudentImporter &importer, boost::asio::io_context &ioContext) :
+			importer(importer), channel(ioContext.get_executor())
+	{
+	}
+
+	/**
+	 * @brief Connects to the first reachable endpoint.
+	 * @param endpoints Resolved addresses of the generator.
+	 */
+	void start(const tcp::resolver::results_type &endpoints)
+	{
+		auto self = shared_from_this();
+		boost::asio::async_connect(this->channel.getSocket(), endpoints,
+				[self](const boost::system::error_code &error,
+						const tcp::endpoint&)
+				{
+					if (error)
+					{
+						self->fail();
+						return;
+					}
+					boost::system::error_code ignored;
+					self->channel.getSocket().set_option(tcp::no_delay(true),
+							ignored);
+					self->connected = true;
+					++self->importer.statistics.connectionsOpened;
+					self->read();
+					self->fill();
+				});
+	}
+
+	/**
+	 * @brief Takes requests until the window is full.
+	 */
+	void fill()
+	{
+		if (!this->connected || this->quitting || this->channel.isClosed())
+		{
+			return;
+		}
+		std::chrono::steady_clock::time_point now =
+				std::chrono::steady_clock::now();
+		while (this->inFlight < this->importer.window
+				&& this->importer.unassigned > 0
+				&& this->importer.pending < this->importer.maxPending)
+		{
+			this->channel.getOutbox() += "generate\n";
+			this->sentAt.push_back(now);
+			++this->inFlight;
+			--this->importer.unassigned;
+		}
+		this->flush();
+	}
+
+	/**
+	 * @brief Sends "quit" and closes after it was written.
+	 */
+	void quit()
+	{
+		if (this->quitting || this->channel.isClosed())
+		{
+			return;
+		}
+		this->quitting = true;
+		if (!this->connected)
+		{
+			this->close();
+			return;
+		}
+		this->channel.getOutbox() += "quit\n";
+		this->flush();
+	}
+};
+
+StudentImporter::StudentImporter(const std::string &host,
+		const std::string &port, unsigned int connectionCount,
+		unsigned int window, std::size_t batchSize, std::size_t maxPending) :
+		host(host), port(port), connectionCount(std::max(connectionCount, 1u)),
+		window(std::max(window, 1u)),
+		batchSize(std::max<std::size_t>(batchSize, 1)),
+		maxPending(std::max(maxPending, this->batchSize)), statistics(),
+		pending(0)
+{
+}
+
+void StudentImporter::fillAll()
+{
+	for (const auto &connection : this->connections)
+	{
+		connection->fill();
+	}
+}
+
+void StudentImporter::deliver(std::string &record, float latency)
+{
+	this->batch.push_back(std::move(record));
+	this->latencies.push_back(latency);
+	++this->pending;
+	++this->statistics.received;
+	--this->outstanding;
+	if (this->batch.size() >= this->batchSize)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->batches.push_back(std::move(this->batch));
+		this->batch.clear();
+		this->batchReady.notify_one();
+	}
+	this->checkFinished();
+}
+
+void StudentImporter::reassign(unsigned int lost)
+{
+	this->unassigned += lost;
+	if (this->liveConnections == 0)
+	{
+		this->outstanding -= this->unassigned;
+		this->unassigned = 0;
+		this->checkFinished();
+		return;
+	}
+	this->fillAll();
+}
+
+void StudentImporter::checkFinished()
+{
+	if (this->outstanding != 0)
+	{
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (!this->batch.empty())
+		{
+			this->batches.push_back(std::move(this->batch));
+			this->batch.clear();
+		}
+		this->finished = true;
+		this->batchReady.notify_one();
+	}
+	for (const auto &connection : this->connections)
+	{
+		connection->quit();
+	}
+}
+
+StudentImporter::Statistics StudentImporter::run(unsigned int count,
+		const std::function<void(std::vector<std::string>&)> &consume)
+{
+	this->statistics = Statistics();
+	this->statistics.requested = count;
+	this->latencies.clear();
+	this->latencies.reserve(count);
+	this->unassigned = count;
+	this->outstanding = count;
+	this->liveConnections = this->connectionCount;
+	this->batch.clear();
+	this->batches.clear();
+	this->finished = false;
+	this->pending = 0;
+	if (count == 0)
+	{
+		return this->statistics;
+	}
+
+	boost::asio::io_context ioContext;
+	tcp::resolver resolver(ioContext);
+	tcp::resolver::results_type endpoints = resolver.resolve(this->host,
+			this->port);
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < this->connectionCount; ++i)
+	{
+		this->connections.push_back(
+				std::make_shared<Connection>(*this, ioContext));
+		this->connections.back()->start(endpoints);
+	}
+	std::thread ioThread([&ioContext]
+	{
+		ioContext.run();
+	});
+
+	try
+	{
+		while (true)
+		{
+			std::vector<std::string> next;
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->batchReady.wait(lock, [this]
+				{
+					return !this->batches.empty() || this->finished;
+				});
+				if (this->batches.empty())
+				{
+					break;
+				}
+				next = std::move(this->batches.front());
+				this->batches.pop_front();
+			}
+			std::size_t size = next.size();
+			consume(next);
+			this->pending -= size;
+			boost::asio::post(ioContext, [this]
+			{
+				this->fillAll();
+			});
+		}
+	} catch (...)
+	{
+		ioContext.stop();
+		ioThread.join();
+		this->connections.clear();
+		throw;
+	}
+	this->statistics.seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	ioThread.join();
+	this->connections.clear();
+
+	this->statistics.latency = LatencySummary::of(this->latencies);
+	return this->statistics;
+}
+
+StudentImporter::~StudentImporter()
+{
+}
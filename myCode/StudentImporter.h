@@ -0,0 +1,142 @@
+/**
+ * @file StudentImporter.h
+ * @brief StudentImporter class declaration for importing generated students
+ * over several connections.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTIMPORTER_H_
+#define STUDENTIMPORTER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include "LatencySummary.h"
+
+/**
+ * @class StudentImporter
+ * @brief Fetches generated student records over a pool of connections.
+ *
+ * All connections are driven asynchronously by one I/O thread. Requests are
+ * handed out to a connection whenever it has room in its window, so faster
+ * connections take more of the work, and the requests of a connection that
+ * fails are handed to the others. Received records are collected into
+ * batches that the calling thread consumes. If the consumer falls behind by
+ * more than a limit, no new requests are sent until it has caught up.
+ * Every answer is timed from the moment its request was queued.
+ */
+class StudentImporter
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Outcome of run().
+	 */
+	struct Statistics
+	{
+		unsigned int requested; ///< Records asked for.
+		unsigned int received; ///< Records delivered to the consumer.
+		unsigned int connectionsOpened; ///< Connections that were established.
+		unsigned int connectionsFailed; ///< Connections that failed or closed early.
+		double seconds; ///< Time from the first connect to the last batch consumed.
+		LatencySummary latency; ///< Time from request to answer.
+
+		/**
+		 * @brief Returns the import rate.
+		 * @return Received records per second.
+		 */
+		double recordsPerSecond() const;
+	};
+
+private:
+	class Connection;
+
+	std::string host; ///< Host of the generator.
+	std::string port; ///< Port of the generator.
+	unsigned int connectionCount; ///< Size of the connection pool.
+	unsigned int window; ///< Requests in flight per connection.
+	std::size_t batchSize; ///< Records per batch handed to the consumer.
+	std::size_t maxPending; ///< Records received but not consumed before sending stops, at least batchSize.
+
+	// State of the I/O thread.
+	unsigned int unassigned = 0; ///< Requests not yet handed to a connection.
+	unsigned int outstanding = 0; ///< Requests not yet answered or failed.
+	unsigned int liveConnections = 0; ///< Connections able to take requests.
+	std::vector<std::shared_ptr<Connection>> connections; ///< The pool.
+	std::vector<std::string> batch; ///< Batch being filled.
+	std::vector<float> latencies; ///< Request latencies in ms of the current run.
+	Statistics statistics; ///< Counters of the current run.
+
+	// State shared with the consumer.
+	std::mutex mutex; ///< Guards batches and finished.
+	std::condition_variable batchReady; ///< Signals new batches or the end.
+	std::deque<std::vector<std::string>> batches; ///< Full batches to consume.
+	bool finished = false; ///< Set when no more batches will come.
+	std::atomic<std::size_t> pending; ///< Records received but not consumed.
+
+	/**
+	 * @brief Hands out requests to all connections with room.
+	 */
+	void fillAll();
+
+	/**
+	 * @brief Adds a received record to the current batch.
+	 * @param record JSON line of the record, moved from.
+	 * @param latency Time from request to answer in ms.
+	 */
+	void deliver(std::string &record, float latency);
+
+	/**
+	 * @brief Takes back the requests of a failed connection.
+	 * @param lost Requests the connection did not answer.
+	 */
+	void reassign(unsigned int lost);
+
+	/**
+	 * @brief Publishes the last batch once nothing is outstanding.
+	 */
+	void checkFinished();
+
+public:
+	/**
+	 * @brief Configures an importer.
+	 * @param host Host name or address of the generator.
+	 * @param port Port of the generator.
+	 * @param connectionCount Number of connections to open, at least 1.
+	 * @param window Requests in flight per connection, at least 1.
+	 * @param batchSize Records per batch handed to the consumer.
+	 * @param maxPending Received records that may wait for the consumer.
+	 */
+	StudentImporter(const std::string &host, const std::string &port,
+			unsigned int connectionCount, unsigned int window,
+			std::size_t batchSize = 256, std::size_t maxPending = 4096);
+
+	StudentImporter(const StudentImporter&) = delete;
+	StudentImporter& operator=(const StudentImporter&) = delete;
+
+	/**
+	 * @brief Requests records and passes them to consume in batches.
+	 *
+	 * consume runs on the calling thread while the I/O thread keeps
+	 * receiving. The order of the records across connections is unspecified.
+	 * @param count Number of records to request.
+	 * @param consume Called with every batch, may move from the records.
+	 * @return Counters of the run, received is less than count if all
+	 * connections failed.
+	 * @throws boost::system::system_error if the host cannot be resolved.
+	 */
+	Statistics run(unsigned int count,
+			const std::function<void(std::vector<std::string>&)> &consume);
+
+	virtual ~StudentImporter();
+};
+
+#endif /* STUDENTIMPORTER_H_ */
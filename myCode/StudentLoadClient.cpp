@@ -0,0 +1,324 @@
+/**
+ * @file StudentLoadClient.cpp
+ * @brief StudentLoadClient class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentLoadClient.h"
+#include "GeneratorServer.h"
+#include "SocketChannel.h"
+#include "StudentProtocol.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <utility>
+
+using boost::asio::ip::tcp;
+
+/**
+ * @class StudentLoadClient::Connection
+ * @brief State of one connection to the server.
+ *
+ * Responses arrive in request order, so the send times of the requests in
+ * flight are kept in a queue together with their ids.
+ */
+class StudentLoadClient::Connection: public std::enable_shared_from_this<
+		StudentLoadClient::Connection>
+{
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	StudentLoadClient &client; ///< Client sharing the work.
+	SocketChannel channel; ///< Socket to the server.
+	std::deque<std::pair<std::uint32_t, Clock::time_point>> inFlight; ///< Unanswered requests.
+	bool connected = false; ///< Set once connected.
+
+	void read()
+	{
+		auto self = shared_from_this();
+		this->channel.read([self](const boost::system::error_code &error)
+		{
+			if (error || !self->receive())
+			{
+				self->fail();
+				return;
+			}
+			self->fill();
+			self->read();
+		});
+	}
+
+	/**
+	 * @brief Takes the complete responses out of the input.
+	 * @return False if a response does not belong to the oldest request.
+	 */
+	bool receive()
+	{
+		std::string &input = this->channel.getInput();
+		std::string_view data(input);
+		std::size_t size;
+		Clock::time_point now = Clock::now();
+		while (StudentProtocol::frameSize(data, size))
+		{
+			if (size < StudentProtocol::headerSize
+					|| size - StudentProtocol::lengthSize
+							> StudentProtocol::maxFrameSize)
+			{
+				return false;
+			}
+			if (data.size() < size)
+			{
+				break;
+			}
+			std::uint32_t requestId;
+			std::uint8_t status;
+			StudentProtocol::split(data.substr(0, size), requestId, status);
+			if (this->inFlight.empty()
+					|| this->inFlight.front().first != requestId)
+			{
+				return false;
+			}
+			data.remove_prefix(size);
+			this->client.latencies.push_back(
+					std::chrono::duration<float, std::milli>(
+							now - this->inFlight.front().second).count());
+			this->inFlight.pop_front();
+			Statistics &statistics = this->client.statistics;
+			++statistics.answered;
+			if (status == StudentProtocol::NOT_FOUND)
+			{
+				++statistics.notFound;
+			}
+			else if (status != StudentProtocol::OK)
+			{
+				++statistics.failed;
+			}
+			if (--this->client.outstanding == 0)
+			{
+				this->client.closeAll();
+				break;
+			}
+		}
+		input.erase(0, input.size() - data.size());
+		return true;
+	}
+
+	void flush()
+	{
+		auto self = shared_from_this();
+		this->channel.write([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->fail();
+				return;
+			}
+			self->flush();
+		});
+	}
+
+	void fail()
+	{
+		if (!this->channel.close())
+		{
+			return;
+		}
+		++this->client.statistics.connectionsFailed;
+		--this->client.liveConnections;
+		this->client.reassign(static_cast<unsigned int>(this->inFlight.size()));
+		this->inFlight.clear();
+	}
+
+public:
+	Connection(StudentLoadClient &client, boost::asio::io_context &ioContext) :
+			client(client), channel(ioContext.get_executor())
+	{
+	}
+
+	/**
+	 * @brief Connects to the first reachable endpoint.
+	 * @param endpoints Resolved addresses of the server.
+	 */
+	void start(const tcp::resolver::results_type &endpoints)
+	{
+		auto self = shared_from_this();
+		boost::asio::async_connect(this->channel.getSocket(), endpoints,
+				[self](const boost::system::error_code &error,
+						const tcp::endpoint&)
+				{
+					if (error)
+					{
+						self->fail();
+						return;
+					}
+					boost::system::error_code ignored;
+					self->channel.getSocket().set_option(tcp::no_delay(true),
+							ignored);
+					self->connected = true;
+					self->read();
+					self->fill();
+				});
+	}
+
+	/**
+	 * @brief Queues requests until the window is full.
+	 */
+	void fill()
+	{
+		if (!this->connected || this->channel.isClosed())
+		{
+			return;
+		}
+		Clock::time_point now = Clock::now();
+		while (this->inFlight.size() < this->client.settings.window
+				&& this->client.unassigned > 0)
+		{
+			std::uint32_t requestId = this->client.nextRequestId++;
+			this->client.encodeRequest(this->channel.getOutbox(), requestId);
+			this->inFlight.emplace_back(requestId, now);
+			--this->client.unassigned;
+			++this->client.statistics.sent;
+		}
+		this->flush();
+	}
+
+	void close()
+	{
+		this->channel.close();
+	}
+};
+
+double StudentLoadClient::Statistics::requestsPerSecond() const
+{
+	return this->seconds > 0 ? this->answered / this->seconds : 0;
+}
+
+StudentLoadClient::StudentLoadClient(const std::string &host,
+		const std::string &port, const Settings &settings) :
+		host(host), port(port), settings(settings), random(
+				std::random_device()()), statistics()
+{
+	this->settings.connections = std::max(settings.connections, 1u);
+	this->settings.window = std::max(settings.window, 1u);
+	this->settings.lastMatrikel = std::max(settings.firstMatrikel,
+			settings.lastMatrikel);
+}
+
+void StudentLoadClient::encodeRequest(std::string &out,
+		std::uint32_t requestId)
+{
+	static const char *nameParts[] =
+	{ "an", "er", "Sch", "mei", "ol", "Ben", "ida", "ner", "ch", "Wolf" };
+
+	std::uniform_int_distribution<unsigned int> matrikel(
+			this->settings.firstMatrikel, this->settings.lastMatrikel);
+	double choice = std::uniform_real_distribution<double>(0, 1)(this->random);
+	if (choice < this->settings.writeShare)
+	{
+		StudentRecord record;
+		StudentRecord::fromJson(GeneratorServer::randomRecord(this->random),
+				record);
+		if (choice < this->settings.writeShare / 2)
+		{
+			StudentProtocol::Writer request(out, requestId,
+					StudentProtocol::ADD_STUDENT);
+			request.student(record);
+			request.finish();
+		}
+		else
+		{
+			StudentProtocol::Writer request(out, requestId,
+					StudentProtocol::UPDATE_ADDRESS);
+			request.u32(matrikel(this->random));
+			request.text(record.street);
+			request.u16(record.postalCode);
+			request.text(record.city);
+			request.text(record.additionalInfo);
+			request.finish();
+		}
+	}
+	else if (choice < this->settings.writeShare + this->settings.searchShare)
+	{
+		StudentProtocol::Writer request(out, requestId, StudentProtocol::SEARCH);
+		request.u8(1);
+		request.u16(20);
+		request.text(
+				nameParts[std::uniform_int_distribution<std::size_t>(0,
+						sizeof(nameParts) / sizeof(*nameParts) - 1)(
+						this->random)]);
+		request.finish();
+	}
+	else
+	{
+		StudentProtocol::Writer request(out, requestId, StudentProtocol::LOOKUP);
+		request.u32(matrikel(this->random));
+		request.finish();
+	}
+}
+
+void StudentLoadClient::fillAll()
+{
+	for (const auto &connection : this->connections)
+	{
+		connection->fill();
+	}
+}
+
+void StudentLoadClient::reassign(unsigned int lost)
+{
+	this->unassigned += lost;
+	this->statistics.sent -= lost;
+	if (this->liveConnections == 0)
+	{
+		this->outstanding -= this->unassigned;
+		this->unassigned = 0;
+		return;
+	}
+	this->fillAll();
+}
+
+void StudentLoadClient::closeAll()
+{
+	for (const auto &connection : this->connections)
+	{
+		connection->close();
+	}
+}
+
+StudentLoadClient::Statistics StudentLoadClient::run()
+{
+	this->statistics = Statistics();
+	this->latencies.clear();
+	this->latencies.reserve(this->settings.requests);
+	this->unassigned = this->settings.requests;
+	this->outstanding = this->settings.requests;
+	this->liveConnections = this->settings.connections;
+	if (this->settings.requests == 0)
+	{
+		return this->statistics;
+	}
+
+	boost::asio::io_context ioContext;
+	tcp::resolver resolver(ioContext);
+	tcp::resolver::results_type endpoints = resolver.resolve(this->host,
+			this->port);
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < this->settings.connections; ++i)
+	{
+		this->connections.push_back(
+				std::make_shared<Connection>(*this, ioContext));
+		this->connections.back()->start(endpoints);
+	}
+	ioContext.run();
+	this->statistics.seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	this->connections.clear();
+
+	this->statistics.latency = LatencySummary::of(this->latencies);
+	return this->statistics;
+}
+
+StudentLoadClient::~StudentLoadClient()
+{
+}
@@ -0,0 +1,128 @@
+/**
+ * @file StudentLoadClient.h
+ * @brief StudentLoadClient class declaration for measuring a StudentServer.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTLOADCLIENT_H_
+#define STUDENTLOADCLIENT_H_
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include "LatencySummary.h"
+
+/**
+ * @class StudentLoadClient
+ * @brief Sends a mix of StudentProtocol requests and times the responses.
+ *
+ * All connections are driven by the calling thread. Each keeps a window of
+ * pipelined requests in flight and refills it as responses arrive. Lookups
+ * and updates pick matrikel numbers from a range, searches use parts of
+ * common names and added students are random generator records. Every
+ * response is timed from the moment its request was queued.
+ */
+class StudentLoadClient
+{
+public:
+	/**
+	 * @struct Settings
+	 * @brief Shape of the load.
+	 */
+	struct Settings
+	{
+		unsigned int connections; ///< Number of connections.
+		unsigned int window; ///< Requests in flight per connection.
+		unsigned int requests; ///< Requests of the whole run.
+		double writeShare; ///< Share of adds and address updates, 0 to 1.
+		double searchShare; ///< Share of searches, 0 to 1.
+		unsigned int firstMatrikel; ///< Smallest matrikel number to look up or update.
+		unsigned int lastMatrikel; ///< Largest matrikel number to look up or update.
+	};
+
+	/**
+	 * @struct Statistics
+	 * @brief Outcome of run().
+	 */
+	struct Statistics
+	{
+		unsigned int sent; ///< Requests sent.
+		unsigned int answered; ///< Responses received.
+		unsigned int notFound; ///< Responses with status NOT_FOUND.
+		unsigned int failed; ///< Responses with another status than OK or NOT_FOUND.
+		unsigned int connectionsFailed; ///< Connections that failed or closed early.
+		double seconds; ///< Time from the first connect to the last response.
+		LatencySummary latency; ///< Time from request to response.
+
+		/**
+		 * @brief Returns the request rate.
+		 * @return Answered requests per second.
+		 */
+		double requestsPerSecond() const;
+	};
+
+private:
+	class Connection;
+
+	std::string host; ///< Host of the server.
+	std::string port; ///< Port of the server.
+	Settings settings; ///< Shape of the load.
+	std::mt19937 random; ///< Source of the requests.
+	unsigned int unassigned = 0; ///< Requests not yet sent.
+	unsigned int outstanding = 0; ///< Requests not yet answered or given up.
+	std::uint32_t nextRequestId = 0; ///< Id of the next request.
+	unsigned int liveConnections = 0; ///< Connections able to send.
+	std::vector<std::shared_ptr<Connection>> connections; ///< The pool.
+	std::vector<float> latencies; ///< Latencies in ms of the current run.
+	Statistics statistics; ///< Counters of the current run.
+
+	/**
+	 * @brief Appends a random request.
+	 * @param out Buffer of the connection.
+	 * @param requestId Id of the request.
+	 */
+	void encodeRequest(std::string &out, std::uint32_t requestId);
+
+	/**
+	 * @brief Lets every live connection fill its window.
+	 */
+	void fillAll();
+
+	/**
+	 * @brief Hands the requests of a failed connection to the others.
+	 * @param lost Number of unanswered requests of the connection.
+	 */
+	void reassign(unsigned int lost);
+
+	/**
+	 * @brief Closes all connections, which ends run().
+	 */
+	void closeAll();
+
+public:
+	/**
+	 * @brief Prepares a load run.
+	 * @param host Host of the server.
+	 * @param port Port of the server.
+	 * @param settings Shape of the load.
+	 */
+	StudentLoadClient(const std::string &host, const std::string &port,
+			const Settings &settings);
+
+	/**
+	 * @brief Sends all requests and waits for their responses.
+	 *
+	 * Requests of a failed connection are sent again over the others. Ends
+	 * early if no connection is left.
+	 * @return Counters and latency percentiles of the run.
+	 */
+	Statistics run();
+
+	virtual ~StudentLoadClient();
+};
+
+#endif /* STUDENTLOADCLIENT_H_ */
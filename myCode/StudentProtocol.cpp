@@ -0,0 +1,276 @@
+/**
+ * @file StudentProtocol.cpp
+ * @brief StudentProtocol class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentProtocol.h"
+#include <algorithm>
+#include <cstring>
+
+StudentProtocol::Writer::Writer(std::string &out, std::uint32_t requestId,
+		std::uint8_t code) :
+		out(out), start(out.size())
+{
+	this->u32(0);
+	this->u32(requestId);
+	this->u8(code);
+}
+
+void StudentProtocol::Writer::u8(std::uint8_t value)
+{
+	this->out.push_back(static_cast<char>(value));
+}
+
+void StudentProtocol::Writer::u16(std::uint16_t value)
+{
+	this->u8(static_cast<std::uint8_t>(value >> 8));
+	this->u8(static_cast<std::uint8_t>(value));
+}
+
+void StudentProtocol::Writer::u32(std::uint32_t value)
+{
+	this->u16(static_cast<std::uint16_t>(value >> 16));
+	this->u16(static_cast<std::uint16_t>(value));
+}
+
+void StudentProtocol::Writer::u64(std::uint64_t value)
+{
+	this->u32(static_cast<std::uint32_t>(value >> 32));
+	this->u32(static_cast<std::uint32_t>(value));
+}
+
+void StudentProtocol::Writer::real(double value)
+{
+	std::uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	this->u64(bits);
+}
+
+void StudentProtocol::Writer::text(std::string_view value)
+{
+	std::size_t size = std::min<std::size_t>(value.size(), 0xFFFF);
+	this->u16(static_cast<std::uint16_t>(size));
+	this->out.append(value.data(), size);
+}
+
+void StudentProtocol::Writer::bytes(std::string_view value)
+{
+	this->out.append(value.data(), value.size());
+}
+
+void StudentProtocol::Writer::date(const Poco::DateTime &value)
+{
+	this->u16(static_cast<std::uint16_t>(value.year()));
+	this->u8(static_cast<std::uint8_t>(value.month()));
+	this->u8(static_cast<std::uint8_t>(value.day()));
+}
+
+void StudentProtocol::Writer::student(const StudentRecord &student)
+{
+	this->text(student.firstName);
+	this->text(student.lastName);
+	this->date(student.dateOfBirth);
+	this->text(student.street);
+	this->u16(student.postalCode);
+	this->text(student.city);
+	this->text(student.additionalInfo);
+}
+
+std::size_t StudentProtocol::Writer::size() const
+{
+	return this->out.size() - this->start;
+}
+
+void StudentProtocol::Writer::u16At(std::size_t offset, std::uint16_t value)
+{
+	this->out[this->start + offset] = static_cast<char>(value >> 8);
+	this->out[this->start + offset + 1] = static_cast<char>(value);
+}
+
+void StudentProtocol::Writer::finish()
+{
+	std::uint32_t length = static_cast<std::uint32_t>(this->out.size()
+			- this->start - lengthSize);
+	for (std::size_t i = 0; i < lengthSize; ++i)
+	{
+		this->out[this->start + i] = static_cast<char>(length
+				>> (8 * (lengthSize - 1 - i)));
+	}
+}
+
+StudentProtocol::Reader::Reader(std::string_view payload) :
+		rest(payload), ok(true)
+{
+}
+
+const unsigned char* StudentProtocol::Reader::take(std::size_t size)
+{
+	if (!this->ok || this->rest.size() < size)
+	{
+		this->ok = false;
+		return nullptr;
+	}
+	const unsigned char *bytes =
+			reinterpret_cast<const unsigned char*>(this->rest.data());
+	this->rest.remove_prefix(size);
+	return bytes;
+}
+
+bool StudentProtocol::Reader::u8(std::uint8_t &value)
+{
+	const unsigned char *bytes = this->take(1);
+	if (bytes == nullptr)
+	{
+		return false;
+	}
+	value = bytes[0];
+	return true;
+}
+
+bool StudentProtocol::Reader::u16(std::uint16_t &value)
+{
+	const unsigned char *bytes = this->take(2);
+	if (bytes == nullptr)
+	{
+		return false;
+	}
+	value = static_cast<std::uint16_t>((bytes[0] << 8) | bytes[1]);
+	return true;
+}
+
+bool StudentProtocol::Reader::u32(std::uint32_t &value)
+{
+	const unsigned char *bytes = this->take(4);
+	if (bytes == nullptr)
+	{
+		return false;
+	}
+	value = (std::uint32_t(bytes[0]) << 24) | (std::uint32_t(bytes[1]) << 16)
+			| (std::uint32_t(bytes[2]) << 8) | std::uint32_t(bytes[3]);
+	return true;
+}
+
+bool StudentProtocol::Reader::u64(std::uint64_t &value)
+{
+	std::uint32_t high, low;
+	if (!this->u32(high) || !this->u32(low))
+	{
+		return false;
+	}
+	value = (std::uint64_t(high) << 32) | low;
+	return true;
+}
+
+bool StudentProtocol::Reader::real(double &value)
+{
+	std::uint64_t bits;
+	if (!this->u64(bits))
+	{
+		return false;
+	}
+	std::memcpy(&value, &bits, sizeof(value));
+	return true;
+}
+
+bool StudentProtocol::Reader::text(std::string_view &value)
+{
+	std::uint16_t size;
+	if (!this->u16(size))
+	{
+		return false;
+	}
+	const unsigned char *bytes = this->take(size);
+	if (bytes == nullptr)
+	{
+		return false;
+	}
+	value = std::string_view(reinterpret_cast<const char*>(bytes), size);
+	return true;
+}
+
+bool StudentProtocol::Reader::date(Poco::DateTime &value)
+{
+	std::uint16_t year;
+	std::uint8_t month, day;
+	if (!this->u16(year) || !this->u8(month) || !this->u8(day)
+			|| !Poco::DateTime::isValid(year, month, day))
+	{
+		this->ok = false;
+		return false;
+	}
+	value.assign(year, month, day);
+	return true;
+}
+
+bool StudentProtocol::Reader::student(StudentRecord &student)
+{
+	std::string_view firstName, lastName, street, city, additionalInfo;
+	if (!this->text(firstName) || !this->text(lastName)
+			|| !this->date(student.dateOfBirth) || !this->text(street)
+			|| !this->u16(student.postalCode) || !this->text(city)
+			|| !this->text(additionalInfo))
+	{
+		return false;
+	}
+	student.firstName = firstName;
+	student.lastName = lastName;
+	student.street = street;
+	student.city = city;
+	student.additionalInfo = additionalInfo;
+	return true;
+}
+
+std::string_view StudentProtocol::Reader::remainder()
+{
+	if (!this->ok)
+	{
+		return std::string_view();
+	}
+	std::string_view rest = this->rest;
+	this->rest = std::string_view();
+	return rest;
+}
+
+bool StudentProtocol::Reader::complete() const
+{
+	return this->ok && this->rest.empty();
+}
+
+bool StudentProtocol::isQuery(std::uint8_t operation)
+{
+	switch (operation)
+	{
+	case LOOKUP:
+	case SEARCH:
+	case STATUS:
+	case STATISTICS:
+	case COURSE_STATISTICS:
+	case TOP_STUDENTS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool StudentProtocol::frameSize(std::string_view data, std::size_t &size)
+{
+	std::uint32_t length;
+	Reader reader(data);
+	if (!reader.u32(length))
+	{
+		return false;
+	}
+	size = lengthSize + length;
+	return true;
+}
+
+std::string_view StudentProtocol::split(std::string_view frame,
+		std::uint32_t &requestId, std::uint8_t &code)
+{
+	Reader reader(frame.substr(lengthSize));
+	reader.u32(requestId);
+	reader.u8(code);
+	return frame.substr(headerSize);
+}
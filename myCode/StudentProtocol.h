@@ -0,0 +1,307 @@
+/**
+ * @file StudentProtocol.h
+ * @brief StudentProtocol class declaration, the binary wire format of the
+ * StudentServer.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTPROTOCOL_H_
+#define STUDENTPROTOCOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "StudentRecord.h"
+
+/**
+ * @class StudentProtocol
+ * @brief Frames of the student server protocol.
+ *
+ * Requests and responses are frames of a 4 byte length, counting the bytes
+ * that follow it, a 4 byte request id, a 1 byte code and the payload. The
+ * code of a request is an Operation, the code of a response a Status. All
+ * integers are big endian, texts are a 2 byte length followed by UTF-8,
+ * dates are a 2 byte year, a 1 byte month and a 1 byte day, reals are IEEE
+ * 754 doubles in 8 bytes.
+ *
+ * A client may send any number of requests without waiting. The responses
+ * of a connection come in request order and carry the id of their request.
+ *
+ * Payloads, request / response with status OK:
+ * - LOOKUP: matrikel / matrikel, student
+ * - SEARCH: flags (1 = ignore case), limit (2 bytes), text / total count
+ *   (4 bytes), returned count (2 bytes), then per returned student the
+ *   matrikel, first name and last name
+ * - ADD_STUDENT: student / matrikel
+ * - UPDATE_NAME: matrikel, first name, last name / nothing
+ * - UPDATE_DOB: matrikel, date / nothing
+ * - UPDATE_ADDRESS: matrikel, street, postal code (2 bytes), city,
+ *   additional info / nothing
+ * - STATUS: nothing / role (1 byte), applied and primary log sequence
+ *   numbers (8 bytes each), replication lag in ms (4 bytes)
+ * - STATISTICS: nothing / student, course, enrollment and graded enrollment
+ *   count (8 bytes each), average grade (real)
+ * - COURSE_STATISTICS: course key (4 bytes) / enrolled and graded count
+ *   (4 bytes each), mean grade, standard deviation, pass rate (reals), the
+ *   StudentDb::gradeBuckets histogram counts (4 bytes each)
+ * - TOP_STUDENTS: count (2 bytes) / returned count (2 bytes), then per
+ *   student the matrikel, GPA, graded and earned credits (reals) and graded
+ *   count (4 bytes), best first, limited to what fits into a frame
+ *
+ * RESTORE_STUDENT (matrikel, student) only appears in replication streams,
+ * servers reject it from clients.
+ *
+ * A student is first name, last name, date of birth, street, postal code,
+ * city and additional info. Other statuses have no payload.
+ *
+ * Replication uses the same frames on a separate port, with request id 0
+ * and a Stream code. The follower sends FOLLOW once, everything else comes
+ * from the primary:
+ * - FOLLOW: log epoch, last received log sequence number (8 bytes each)
+ * - SNAPSHOT: log epoch, log sequence number the snapshot includes
+ * - SNAPSHOT_DATA: the next bytes of the database file (StudentDb::write)
+ * - SNAPSHOT_END: nothing
+ * - RECORD: log sequence number, commit time in ms since 1970 (8 bytes
+ *   each), operation, payload of the mutation request
+ * - HEARTBEAT: last log sequence number, time in ms since 1970
+ */
+class StudentProtocol
+{
+public:
+	/**
+	 * @brief Request codes.
+	 */
+	enum Operation : std::uint8_t
+	{
+		LOOKUP = 1, ///< Fetch a student by matrikel number.
+		SEARCH, ///< Find students by a part of their name.
+		ADD_STUDENT, ///< Add a student.
+		UPDATE_NAME, ///< Change the name of a student.
+		UPDATE_DOB, ///< Change the date of birth of a student.
+		UPDATE_ADDRESS, ///< Change the address of a student.
+		STATUS, ///< Report the replication state of the server.
+		RESTORE_STUDENT, ///< Add a student under a given matrikel number.
+		STATISTICS, ///< Aggregate figures over all students.
+		COURSE_STATISTICS, ///< Grade distribution of a course.
+		TOP_STUDENTS ///< Students with the best GPA.
+	};
+
+	/**
+	 * @brief Codes of replication frames.
+	 */
+	enum Stream : std::uint8_t
+	{
+		FOLLOW = 1, ///< Asks for the log after a sequence number.
+		SNAPSHOT, ///< Starts a snapshot of the database.
+		SNAPSHOT_DATA, ///< Carries a part of the snapshot.
+		SNAPSHOT_END, ///< Ends the snapshot.
+		RECORD, ///< Carries an applied mutation.
+		HEARTBEAT ///< Reports the end of the log while it is idle.
+	};
+
+	/**
+	 * @brief Role of a server in the STATUS response.
+	 */
+	enum Role : std::uint8_t
+	{
+		STANDALONE = 0, ///< Not replicated.
+		PRIMARY, ///< Ships its mutations to followers.
+		FOLLOWER ///< Applies the mutations of a primary, read only.
+	};
+
+	/**
+	 * @brief Response codes.
+	 */
+	enum Status : std::uint8_t
+	{
+		OK = 0, ///< Done, the payload follows.
+		NOT_FOUND, ///< The student does not exist.
+		INVALID, ///< A field breaks the validation rules.
+		MALFORMED, ///< The payload does not match the operation.
+		UNKNOWN_OPERATION, ///< The request code is not an Operation.
+		FAILED, ///< The database reported an error.
+		READ_ONLY ///< Mutations are not accepted by a follower.
+	};
+
+	/**
+	 * @struct ReplicationStatus
+	 * @brief Payload of a STATUS response.
+	 */
+	struct ReplicationStatus
+	{
+		Role role; ///< Role of the server.
+		std::uint64_t appliedLsn; ///< Last log record applied to the database.
+		std::uint64_t primaryLsn; ///< Last log record the primary reported.
+		std::uint32_t lagMilliseconds; ///< Age of the oldest change not yet applied.
+	};
+
+	static const std::size_t lengthSize = 4; ///< Bytes of the length prefix.
+	static const std::size_t headerSize = 9; ///< Length, request id and code.
+	static const std::uint32_t maxFrameSize = 65536; ///< Largest value of the length prefix.
+
+	/**
+	 * @class Writer
+	 * @brief Appends one frame to a buffer.
+	 */
+	class Writer
+	{
+	private:
+		std::string &out; ///< Buffer the frame is appended to.
+		std::size_t start; ///< Offset of the frame in out.
+
+	public:
+		/**
+		 * @brief Starts a frame.
+		 * @param out Buffer to append to, may hold other frames already.
+		 * @param requestId Id of the request.
+		 * @param code Operation or Status.
+		 */
+		Writer(std::string &out, std::uint32_t requestId, std::uint8_t code);
+
+		void u8(std::uint8_t value);
+		void u16(std::uint16_t value);
+		void u32(std::uint32_t value);
+		void u64(std::uint64_t value);
+		void real(double value);
+
+		/**
+		 * @brief Appends a text, cut to 65535 bytes.
+		 * @param value The text.
+		 */
+		void text(std::string_view value);
+
+		/**
+		 * @brief Appends bytes without a length.
+		 * @param value The bytes.
+		 */
+		void bytes(std::string_view value);
+
+		/**
+		 * @brief Appends a date.
+		 * @param value The date, only the day counts.
+		 */
+		void date(const Poco::DateTime &value);
+
+		/**
+		 * @brief Appends the fields of a student.
+		 * @param student The student.
+		 */
+		void student(const StudentRecord &student);
+
+		/**
+		 * @brief Returns the size of the frame so far.
+		 * @return Bytes written since the frame was started.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * @brief Overwrites a 2 byte field written before, e.g. a count
+		 * that is known only after its items.
+		 * @param offset Position of the field in the frame.
+		 * @param value The new value.
+		 */
+		void u16At(std::size_t offset, std::uint16_t value);
+
+		/**
+		 * @brief Writes the length prefix, call once after the payload.
+		 */
+		void finish();
+	};
+
+	/**
+	 * @class Reader
+	 * @brief Takes the fields of a payload in order.
+	 *
+	 * Every accessor returns false once the payload is too short, and keeps
+	 * returning false afterwards.
+	 */
+	class Reader
+	{
+	private:
+		std::string_view rest; ///< Unread part of the payload.
+		bool ok; ///< False after a read went past the end.
+
+		/**
+		 * @brief Takes raw bytes.
+		 * @param size Number of bytes.
+		 * @return Pointer to them, nullptr if fewer are left.
+		 */
+		const unsigned char* take(std::size_t size);
+
+	public:
+		/**
+		 * @brief Starts reading a payload.
+		 * @param payload The payload, must outlive the reader.
+		 */
+		explicit Reader(std::string_view payload);
+
+		bool u8(std::uint8_t &value);
+		bool u16(std::uint16_t &value);
+		bool u32(std::uint32_t &value);
+		bool u64(std::uint64_t &value);
+		bool real(double &value);
+
+		/**
+		 * @brief Takes a text.
+		 * @param value View into the payload.
+		 * @return False if the payload is too short.
+		 */
+		bool text(std::string_view &value);
+
+		/**
+		 * @brief Takes a date.
+		 * @param value Receives the date.
+		 * @return False if the payload is too short or the date impossible.
+		 */
+		bool date(Poco::DateTime &value);
+
+		/**
+		 * @brief Takes the fields of a student.
+		 * @param student Receives the fields.
+		 * @return False if the payload is too short or the date impossible.
+		 */
+		bool student(StudentRecord &student);
+
+		/**
+		 * @brief Takes everything that is left.
+		 * @return View into the payload, empty after a failed read.
+		 */
+		std::string_view remainder();
+
+		/**
+		 * @brief Checks that the whole payload was read.
+		 * @return True if every read succeeded and nothing is left.
+		 */
+		bool complete() const;
+	};
+
+	/**
+	 * @brief Tells reads from mutations.
+	 * @param operation Code of a request.
+	 * @return True for operations that do not change the database.
+	 */
+	static bool isQuery(std::uint8_t operation);
+
+	/**
+	 * @brief Decodes the header of the first frame in a buffer.
+	 * @param data Received bytes.
+	 * @param size Receives the size of the whole frame once its length
+	 * prefix is complete.
+	 * @return False if the length prefix is incomplete.
+	 */
+	static bool frameSize(std::string_view data, std::size_t &size);
+
+	/**
+	 * @brief Splits a complete frame.
+	 * @param frame The frame including its length prefix.
+	 * @param requestId Receives the request id.
+	 * @param code Receives the code.
+	 * @return The payload.
+	 */
+	static std::string_view split(std::string_view frame,
+			std::uint32_t &requestId, std::uint8_t &code);
+};
+
+#endif /* STUDENTPROTOCOL_H_ */
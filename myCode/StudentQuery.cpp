@@ -0,0 +1,368 @@
+/**
+ * @file StudentQuery.cpp
+ * @brief StudentQuery class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentQuery.h"
+#include <iomanip>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include "FieldParser.h"
+
+/**
+ * @brief Splits a query string at whitespace outside of double quotes.
+ * @param queryString The query.
+ * @return Tokens with the quotes removed.
+ */
+static std::vector<std::string> tokenize(const std::string &queryString)
+{
+	std::vector<std::string> tokens;
+	std::string token;
+	bool quoted = false;
+	bool pending = false;
+	for (char c : queryString)
+	{
+		if (c == '"')
+		{
+			quoted = !quoted;
+			pending = true;
+		}
+		else if (!quoted && (c == ' ' || c == '\t'))
+		{
+			if (pending)
+			{
+				tokens.push_back(token);
+				token.clear();
+				pending = false;
+			}
+		}
+		else
+		{
+			token += c;
+			pending = true;
+		}
+	}
+	if (quoted)
+	{
+		throw std::invalid_argument("Unterminated quote in query.");
+	}
+	if (pending)
+	{
+		tokens.push_back(token);
+	}
+	return tokens;
+}
+
+/**
+ * @brief Splits "LOW..HIGH".
+ * @param value The range text.
+ * @param low Receives the lower bound text.
+ * @param high Receives the upper bound text.
+ */
+static void splitRange(const std::string &value, std::string &low,
+		std::string &high)
+{
+	std::size_t pos = value.find("..");
+	if (pos == std::string::npos)
+	{
+		low = value;
+		high = value;
+	}
+	else
+	{
+		low = value.substr(0, pos);
+		high = value.substr(pos + 2);
+	}
+}
+
+/**
+ * @brief Parses an unsigned number of a query.
+ * @param value The text.
+ * @return The number.
+ */
+static unsigned long parseNumber(const std::string &value)
+{
+	std::size_t used = 0;
+	unsigned long number = 0;
+	try
+	{
+		number = std::stoul(value, &used);
+	} catch (const std::exception &e)
+	{
+		used = 0;
+	}
+	if (used == 0 || used != value.size())
+	{
+		throw std::invalid_argument("Invalid number in query: " + value);
+	}
+	return number;
+}
+
+/**
+ * @brief Parses DD.MM.YYYY to YYYYMMDD.
+ * @param value The text.
+ * @return The date number.
+ */
+static long parseYmd(const std::string &value)
+{
+	CompactDate date;
+	if (!FieldParser::parseDate(value, date))
+	{
+		throw std::invalid_argument(
+				"Invalid date in query. Expected format: DD.MM.YYYY");
+	}
+	int year, month, day;
+	date.toYmd(year, month, day);
+	return year * 10000L + month * 100L + day;
+}
+
+StudentQuery::StudentQuery() :
+		limit(std::numeric_limits<std::size_t>::max())
+{
+}
+
+StudentQuery& StudentQuery::where(const QueryPredicate &predicate)
+{
+	this->predicates.push_back(predicate);
+	return *this;
+}
+
+StudentQuery& StudentQuery::select(Field field)
+{
+	this->projection.push_back(field);
+	return *this;
+}
+
+StudentQuery& StudentQuery::setLimit(std::size_t maxRows)
+{
+	this->limit = maxRows;
+	return *this;
+}
+
+const std::vector<QueryPredicate>& StudentQuery::getPredicates() const
+{
+	return this->predicates;
+}
+
+std::vector<StudentQuery::Field> StudentQuery::getProjection() const
+{
+	if (this->projection.empty())
+	{
+		return
+		{	MATRIKEL, FIRST_NAME, LAST_NAME};
+	}
+	return this->projection;
+}
+
+std::size_t StudentQuery::getLimit() const
+{
+	return this->limit;
+}
+
+bool StudentQuery::matches(const Student &student) const
+{
+	for (const auto &predicate : this->predicates)
+	{
+		if (!predicate.matches(student))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+std::string StudentQuery::normalize() const
+{
+	std::vector<std::string> conditions;
+	for (const auto &predicate : this->predicates)
+	{
+		conditions.push_back(predicate.describe());
+	}
+	std::sort(conditions.begin(), conditions.end());
+	conditions.erase(std::unique(conditions.begin(), conditions.end()),
+			conditions.end());
+
+	std::string normalized;
+	for (const auto &condition : conditions)
+	{
+		normalized += condition + " ";
+	}
+	normalized += "select=";
+	for (Field field : getProjection())
+	{
+		normalized += fieldName(field) + ",";
+	}
+	normalized += " limit=" + std::to_string(this->limit);
+	return normalized;
+}
+
+std::string StudentQuery::fieldName(Field field)
+{
+	switch (field)
+	{
+	case MATRIKEL:
+		return "matrikel";
+	case FIRST_NAME:
+		return "firstname";
+	case LAST_NAME:
+		return "lastname";
+	case FULL_NAME:
+		return "name";
+	case DATE_OF_BIRTH:
+		return "dob";
+	case STREET:
+		return "street";
+	case POSTAL_CODE:
+		return "postal";
+	case CITY:
+		return "city";
+	case ADDITIONAL_INFO:
+		return "info";
+	case ENROLLMENT_COUNT:
+		return "enrollments";
+	}
+	return "";
+}
+
+std::string StudentQuery::project(const Student &student, Field field)
+{
+	switch (field)
+	{
+	case MATRIKEL:
+		return std::to_string(student.getMatrikelNumber());
+	case FIRST_NAME:
+		return student.getFirstName();
+	case LAST_NAME:
+		return student.getLastName();
+	case FULL_NAME:
+		return student.getFirstName() + " " + student.getLastName();
+	case DATE_OF_BIRTH:
+	{
+		int year, month, day;
+		student.getBirthDate().toYmd(year, month, day);
+		std::ostringstream out;
+		out << std::setfill('0') << std::setw(2) << day << "."
+				<< std::setfill('0') << std::setw(2) << month << "." << year;
+		return out.str();
+	}
+	case STREET:
+		return student.getAddress()->getStreet();
+	case POSTAL_CODE:
+		return std::to_string(student.getAddress()->getPostalCode());
+	case CITY:
+		return student.getAddress()->getCity();
+	case ADDITIONAL_INFO:
+		return student.getAddress()->getAdditionalInfo();
+	case ENROLLMENT_COUNT:
+		return std::to_string(student.getEnrollments().size());
+	}
+	return "";
+}
+
+StudentQuery StudentQuery::parse(const std::string &queryString)
+{
+	StudentQuery query;
+	for (const auto &token : tokenize(queryString))
+	{
+		if (token == "and")
+		{
+			continue;
+		}
+		std::size_t opPos = token.find_first_of("=<~^");
+		if (opPos == std::string::npos || opPos == 0)
+		{
+			throw std::invalid_argument("Invalid query condition: " + token);
+		}
+		std::string key = token.substr(0, opPos);
+		char op = token[opPos];
+		std::string value = token.substr(opPos + 1);
+		std::string low, high;
+
+		if (key == "city" && op == '=')
+		{
+			query.where(QueryPredicate::cityEquals(value));
+		}
+		else if (key == "postal" && op == '=')
+		{
+			splitRange(value, low, high);
+			unsigned long lowCode = parseNumber(low);
+			unsigned long highCode = parseNumber(high);
+			if (lowCode > 0xFFFF || highCode > 0xFFFF)
+			{
+				throw std::invalid_argument(
+						"Postal code out of range: " + value);
+			}
+			query.where(
+					QueryPredicate::postalCodeBetween(
+							static_cast<unsigned short>(lowCode),
+							static_cast<unsigned short>(highCode)));
+		}
+		else if (key == "born" && op == '=')
+		{
+			splitRange(value, low, high);
+			query.where(QueryPredicate::bornBetween(parseYmd(low), parseYmd(high)));
+		}
+		else if (key == "course" && op == '=')
+		{
+			query.where(
+					QueryPredicate::enrolledIn(
+							static_cast<unsigned int>(parseNumber(value))));
+		}
+		else if (key == "grade" && op == '<')
+		{
+			try
+			{
+				query.where(QueryPredicate::gradeBelow(std::stof(value)));
+			} catch (const std::logic_error &e)
+			{
+				throw std::invalid_argument("Invalid grade in query: " + value);
+			}
+		}
+		else if (key == "name" && op == '~')
+		{
+			query.where(QueryPredicate::nameContains(value));
+		}
+		else if (key == "iname" && op == '~')
+		{
+			query.where(QueryPredicate::nameContainsIgnoreCase(value));
+		}
+		else if (key == "last" && op == '^')
+		{
+			query.where(QueryPredicate::lastNameStartsWith(value));
+		}
+		else if (key == "limit" && op == '=')
+		{
+			query.setLimit(parseNumber(value));
+		}
+		else if (key == "select" && op == '=')
+		{
+			std::istringstream fields(value);
+			std::string name;
+			while (std::getline(fields, name, ','))
+			{
+				bool known = false;
+				for (int f = MATRIKEL; f <= ENROLLMENT_COUNT; ++f)
+				{
+					if (fieldName(static_cast<Field>(f)) == name)
+					{
+						query.select(static_cast<Field>(f));
+						known = true;
+						break;
+					}
+				}
+				if (!known)
+				{
+					throw std::invalid_argument("Unknown field in query: " + name);
+				}
+			}
+		}
+		else
+		{
+			throw std::invalid_argument("Invalid query condition: " + token);
+		}
+	}
+	return query;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file StudentQuery.h
+ * @brief StudentQuery class declaration for composable student queries.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTQUERY_H_
+#define STUDENTQUERY_H_
+
+#include <limits>
+#include <string>
+#include <vector>
+#include "QueryPredicate.h"
+#include "Student.h"
+
+/**
+ * @class StudentQuery
+ * @brief Conjunction of predicates with projection and limit.
+ *
+ * Queries are built with where(), select() and setLimit() or parsed from a
+ * query string such as
+ * @code
+ * city="Frankfurt am Main" born=01.01.2000..31.12.2002 grade<2.0 select=matrikel,name limit=20
+ * @endcode
+ * Conditions: city=X, postal=LOW..HIGH, born=DD.MM.YYYY..DD.MM.YYYY,
+ * course=KEY, grade<X, name~X, iname~X (ignoring case), last^X.
+ * Fields: matrikel, firstname, lastname, name, dob, street, postal, city,
+ * info, enrollments.
+ */
+class StudentQuery
+{
+public:
+	/**
+	 * @enum Field
+	 * @brief Columns available for the projection.
+	 */
+	enum Field
+	{
+		MATRIKEL, ///< Matrikel number.
+		FIRST_NAME, ///< First name.
+		LAST_NAME, ///< Last name.
+		FULL_NAME, ///< "first last".
+		DATE_OF_BIRTH, ///< DD.MM.YYYY.
+		STREET, ///< Street of the address.
+		POSTAL_CODE, ///< Postal code of the address.
+		CITY, ///< City of the address.
+		ADDITIONAL_INFO, ///< Additional address info.
+		ENROLLMENT_COUNT ///< Number of enrollments.
+	};
+
+private:
+	std::vector<QueryPredicate> predicates; ///< All must hold.
+	std::vector<Field> projection; ///< Selected columns.
+	std::size_t limit; ///< Maximum number of rows.
+
+public:
+	/**
+	 * @brief Creates a query matching every student without limit.
+	 */
+	StudentQuery();
+
+	/**
+	 * @brief Adds a condition.
+	 * @param predicate Condition that has to hold.
+	 * @return This query.
+	 */
+	StudentQuery& where(const QueryPredicate &predicate);
+
+	/**
+	 * @brief Adds a column to the projection.
+	 * @param field The column.
+	 * @return This query.
+	 */
+	StudentQuery& select(Field field);
+
+	/**
+	 * @brief Restricts the number of result rows.
+	 * @param maxRows Maximum number of rows.
+	 * @return This query.
+	 */
+	StudentQuery& setLimit(std::size_t maxRows);
+
+	const std::vector<QueryPredicate>& getPredicates() const;
+
+	/**
+	 * @brief Returns the projection, matrikel and name if none was selected.
+	 * @return Selected columns.
+	 */
+	std::vector<Field> getProjection() const;
+
+	std::size_t getLimit() const;
+
+	/**
+	 * @brief Checks all predicates.
+	 * @param student The student to test.
+	 * @return True if every predicate holds.
+	 */
+	bool matches(const Student &student) const;
+
+	/**
+	 * @brief Builds a canonical text form, equal for equivalent queries.
+	 * @return Sorted conditions followed by projection and limit.
+	 */
+	std::string normalize() const;
+
+	/**
+	 * @brief Returns the name of a column as used in query strings.
+	 * @param field The column.
+	 * @return Column name.
+	 */
+	static std::string fieldName(Field field);
+
+	/**
+	 * @brief Formats one column of a student.
+	 * @param student The student.
+	 * @param field The column.
+	 * @return Column value as text.
+	 */
+	static std::string project(const Student &student, Field field);
+
+	/**
+	 * @brief Parses a query string.
+	 * @param queryString The query, see the class description.
+	 * @return The parsed query.
+	 * @throw std::invalid_argument on syntax errors.
+	 */
+	static StudentQuery parse(const std::string &queryString);
+};
+
+#endif /* STUDENTQUERY_H_ */
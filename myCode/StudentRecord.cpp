@@ -0,0 +1,63 @@
+/**
+ * @file StudentRecord.cpp
+ * @brief StudentRecord struct implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentRecord.h"
+#include "FieldParser.h"
+#include "RecordValidator.h"
+#include "StudentRecordParser.h"
+#include <stdexcept>
+
+bool StudentRecord::fromJson(std::string_view json, StudentRecord &record)
+{
+	// One parser per thread, its buffers are reused for every record.
+	thread_local StudentRecordParser parser;
+	if (!parser.parse(json))
+	{
+		return false;
+	}
+
+	std::string_view postal = parser.text(StudentRecordParser::POST_CODE);
+	int postalCode;
+	std::size_t length;
+	int date = parser.number(StudentRecordParser::DAY);
+	int month = parser.number(StudentRecordParser::MONTH_SINCE_JANUARY) + 1;
+	int year = parser.number(StudentRecordParser::YEARS_SINCE_1900) + 1900;
+	if (RecordValidator::classify(postal, length) != RecordValidator::DIGIT
+			|| !FieldParser::parseInt(postal, postalCode)
+			|| !Poco::DateTime::isValid(year, month, date))
+	{
+		return false;
+	}
+	record.firstName = parser.text(StudentRecordParser::FIRST_NAME);
+	record.lastName = parser.text(StudentRecordParser::LAST_NAME);
+	record.dateOfBirth.assign(year, month, date);
+	record.street = parser.text(StudentRecordParser::STREET);
+	record.postalCode = postalCode;
+	record.city = parser.text(StudentRecordParser::CITY);
+	record.additionalInfo = parser.text(StudentRecordParser::STATE);
+	return true;
+}
+
+bool StudentRecord::fromCsv(std::string_view line, StudentRecord &record)
+{
+	try
+	{
+		FieldParser fields(line);
+		fields.text();
+		record.firstName = fields.text();
+		record.lastName = fields.text();
+		record.dateOfBirth = fields.date().toDateTime();
+		record.street = fields.text();
+		record.postalCode = static_cast<unsigned short>(fields.unsignedInteger());
+		record.city = fields.text();
+		record.additionalInfo = fields.remainder();
+	} catch (const std::invalid_argument&)
+	{
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file StudentRecord.h
+ * @brief StudentRecord struct declaration, the fields of a student being
+ * imported.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTRECORD_H_
+#define STUDENTRECORD_H_
+
+#include <string>
+#include <string_view>
+#include <Poco/DateTime.h>
+
+/**
+ * @struct StudentRecord
+ * @brief Fields of a student received from the generator or read from a
+ * file, before it is added to the database.
+ */
+struct StudentRecord
+{
+	std::string firstName; ///< First name.
+	std::string lastName; ///< Last name.
+	Poco::DateTime dateOfBirth; ///< Date of birth.
+	std::string street; ///< Street and house number.
+	unsigned short postalCode = 0; ///< Postal code.
+	std::string city; ///< City.
+	std::string additionalInfo; ///< State or other additional information.
+
+	/**
+	 * @brief Extracts a record sent by the student data generator.
+	 *
+	 * Uses a StudentRecordParser kept per thread, so no allocation happens
+	 * besides the strings of the record.
+	 * @param json The record as one JSON object.
+	 * @param record Receives the fields.
+	 * @return False if the JSON is malformed, a field is missing or has the
+	 * wrong type, the postal code is not a number or the date is impossible.
+	 */
+	static bool fromJson(std::string_view json, StudentRecord &record);
+
+	/**
+	 * @brief Extracts a student line of the database file format.
+	 *
+	 * The matrikel number of the line is skipped.
+	 * @param line matrikel;first name;last name;D.M.YYYY;street;postal
+	 * code;city;additional info
+	 * @param record Receives the fields.
+	 * @return False if a field is missing or malformed.
+	 */
+	static bool fromCsv(std::string_view line, StudentRecord &record);
+};
+
+#endif /* STUDENTRECORD_H_ */
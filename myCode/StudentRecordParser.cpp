@@ -0,0 +1,266 @@
+/**
+ * @file StudentRecordParser.cpp
+ * @brief StudentRecordParser class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentRecordParser.h"
+#include <boost/json/basic_parser_impl.hpp>
+
+namespace
+{
+/**
+ * @brief Converts the parser's string_view.
+ * @param view View passed by basic_parser.
+ * @return The same characters as std::string_view.
+ */
+std::string_view toView(boost::json::string_view view)
+{
+	return std::string_view(view.data(), view.size());
+}
+
+const unsigned int allFields = (1u
+		<< (StudentRecordParser::TEXT_FIELDS
+				+ StudentRecordParser::NUMBER_FIELDS)) - 1;
+}
+
+void StudentRecordParser::Handler::reset()
+{
+	this->found = 0;
+	this->key.clear();
+	this->depth = 0;
+	this->section = ROOT;
+	this->keySection = OTHER;
+	this->target = -1;
+}
+
+void StudentRecordParser::Handler::selectTarget(std::string_view name)
+{
+	this->target = -1;
+	if (this->depth == 1)
+	{
+		this->keySection =
+				name == "name" ? NAME :
+				name == "dateOfBirth" ? DATE_OF_BIRTH :
+				name == "location" ? LOCATION : OTHER;
+		return;
+	}
+	if (this->depth != 2)
+	{
+		return;
+	}
+	switch (this->section)
+	{
+	case NAME:
+		if (name == "firstName")
+			this->target = FIRST_NAME;
+		else if (name == "lastName")
+			this->target = LAST_NAME;
+		break;
+	case DATE_OF_BIRTH:
+		if (name == "date")
+			this->target = TEXT_FIELDS + DAY;
+		else if (name == "month")
+			this->target = TEXT_FIELDS + MONTH_SINCE_JANUARY;
+		else if (name == "year")
+			this->target = TEXT_FIELDS + YEARS_SINCE_1900;
+		break;
+	case LOCATION:
+		if (name == "street")
+			this->target = STREET;
+		else if (name == "postCode")
+			this->target = POST_CODE;
+		else if (name == "city")
+			this->target = CITY;
+		else if (name == "state")
+			this->target = STATE;
+		break;
+	default:
+		break;
+	}
+	if (this->target >= 0 && this->target < TEXT_FIELDS)
+	{
+		this->texts[this->target].clear();
+	}
+}
+
+bool StudentRecordParser::Handler::on_document_begin(boost::json::error_code&)
+{
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_document_end(boost::json::error_code&)
+{
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_object_begin(boost::json::error_code&)
+{
+	++this->depth;
+	if (this->depth == 2)
+	{
+		this->section = this->keySection;
+	}
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_object_end(std::size_t,
+		boost::json::error_code&)
+{
+	if (--this->depth < 2)
+	{
+		this->section = ROOT;
+	}
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_array_begin(boost::json::error_code&)
+{
+	if (++this->depth == 2)
+	{
+		this->section = OTHER;
+	}
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_array_end(std::size_t,
+		boost::json::error_code&)
+{
+	if (--this->depth < 2)
+	{
+		this->section = ROOT;
+	}
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_key_part(boost::json::string_view part,
+		std::size_t, boost::json::error_code&)
+{
+	this->key.append(part.data(), part.size());
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_key(boost::json::string_view part,
+		std::size_t, boost::json::error_code&)
+{
+	if (this->key.empty())
+	{
+		this->selectTarget(toView(part));
+	}
+	else
+	{
+		this->key.append(part.data(), part.size());
+		this->selectTarget(this->key);
+		this->key.clear();
+	}
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_string_part(
+		boost::json::string_view part, std::size_t, boost::json::error_code&)
+{
+	if (this->target >= 0 && this->target < TEXT_FIELDS)
+	{
+		this->texts[this->target].append(part.data(), part.size());
+	}
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_string(boost::json::string_view part,
+		std::size_t, boost::json::error_code&)
+{
+	if (this->target >= 0 && this->target < TEXT_FIELDS)
+	{
+		this->texts[this->target].append(part.data(), part.size());
+		this->found |= 1u << this->target;
+	}
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_number_part(boost::json::string_view,
+		boost::json::error_code&)
+{
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_int64(std::int64_t value,
+		boost::json::string_view, boost::json::error_code&)
+{
+	if (this->target >= TEXT_FIELDS)
+	{
+		this->numbers[this->target - TEXT_FIELDS] = value;
+		this->found |= 1u << this->target;
+	}
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_uint64(std::uint64_t,
+		boost::json::string_view, boost::json::error_code&)
+{
+	// Only values beyond the int64 range arrive here, as_int64() rejected
+	// them as well.
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_double(double, boost::json::string_view,
+		boost::json::error_code&)
+{
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_bool(bool, boost::json::error_code&)
+{
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_null(boost::json::error_code&)
+{
+	this->target = -1;
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_comment_part(boost::json::string_view,
+		boost::json::error_code&)
+{
+	return true;
+}
+
+bool StudentRecordParser::Handler::on_comment(boost::json::string_view,
+		boost::json::error_code&)
+{
+	return true;
+}
+
+StudentRecordParser::StudentRecordParser() :
+		parser(boost::json::parse_options())
+{
+}
+
+bool StudentRecordParser::parse(std::string_view json)
+{
+	this->parser.reset();
+	Handler &handler = this->parser.handler();
+	handler.reset();
+	boost::json::error_code error;
+	std::size_t consumed = this->parser.write_some(false, json.data(),
+			json.size(), error);
+	return !error && consumed == json.size() && handler.found == allFields;
+}
+
+std::string_view StudentRecordParser::text(TextField field) const
+{
+	return this->parser.handler().texts[field];
+}
+
+std::int64_t StudentRecordParser::number(NumberField field) const
+{
+	return this->parser.handler().numbers[field];
+}
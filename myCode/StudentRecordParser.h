@@ -0,0 +1,135 @@
+/**
+ * @file StudentRecordParser.h
+ * @brief StudentRecordParser class declaration for extracting generated
+ * student records from JSON.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTRECORDPARSER_H_
+#define STUDENTRECORDPARSER_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <boost/json/basic_parser.hpp>
+
+/**
+ * @class StudentRecordParser
+ * @brief Streams a generator record through boost::json::basic_parser and
+ * keeps only the fields of a student.
+ *
+ * No DOM is built. The wanted strings are copied into buffers owned by the
+ * parser whose capacity is reused, so a parser that is kept across records
+ * stops allocating once its buffers have grown to the longest field.
+ * Unknown keys and values are skipped.
+ */
+class StudentRecordParser
+{
+public:
+	/**
+	 * @brief Text fields of a record.
+	 */
+	enum TextField
+	{
+		FIRST_NAME, LAST_NAME, STREET, POST_CODE, CITY, STATE, TEXT_FIELDS
+	};
+
+	/**
+	 * @brief Integer fields of a record, as sent by the generator.
+	 */
+	enum NumberField
+	{
+		DAY, MONTH_SINCE_JANUARY, YEARS_SINCE_1900, NUMBER_FIELDS
+	};
+
+private:
+	/**
+	 * @struct Handler
+	 * @brief Callbacks of basic_parser, tracks the position in the record.
+	 */
+	struct Handler
+	{
+		/**
+		 * @brief Object of the record a key belongs to.
+		 */
+		enum Section
+		{
+			ROOT, NAME, DATE_OF_BIRTH, LOCATION, OTHER
+		};
+
+		static constexpr std::size_t max_object_size = std::size_t(-1);
+		static constexpr std::size_t max_array_size = std::size_t(-1);
+		static constexpr std::size_t max_key_size = std::size_t(-1);
+		static constexpr std::size_t max_string_size = std::size_t(-1);
+
+		std::array<std::string, TEXT_FIELDS> texts; ///< Values of the text fields.
+		std::array<std::int64_t, NUMBER_FIELDS> numbers; ///< Values of the integer fields.
+		unsigned int found = 0; ///< Bit per field that had a value of the right type.
+		std::string key; ///< Key being assembled from parts.
+		int depth = 0; ///< Nesting of objects and arrays.
+		Section section = ROOT; ///< Object at depth 2.
+		Section keySection = OTHER; ///< Section named by the last key at depth 1.
+		int target = -1; ///< Field of the next value, text fields first.
+
+		void reset();
+		void selectTarget(std::string_view name);
+
+		bool on_document_begin(boost::json::error_code&);
+		bool on_document_end(boost::json::error_code&);
+		bool on_object_begin(boost::json::error_code&);
+		bool on_object_end(std::size_t, boost::json::error_code&);
+		bool on_array_begin(boost::json::error_code&);
+		bool on_array_end(std::size_t, boost::json::error_code&);
+		bool on_key_part(boost::json::string_view part, std::size_t,
+				boost::json::error_code&);
+		bool on_key(boost::json::string_view part, std::size_t,
+				boost::json::error_code&);
+		bool on_string_part(boost::json::string_view part, std::size_t,
+				boost::json::error_code&);
+		bool on_string(boost::json::string_view part, std::size_t,
+				boost::json::error_code&);
+		bool on_number_part(boost::json::string_view, boost::json::error_code&);
+		bool on_int64(std::int64_t value, boost::json::string_view,
+				boost::json::error_code&);
+		bool on_uint64(std::uint64_t, boost::json::string_view,
+				boost::json::error_code&);
+		bool on_double(double, boost::json::string_view,
+				boost::json::error_code&);
+		bool on_bool(bool, boost::json::error_code&);
+		bool on_null(boost::json::error_code&);
+		bool on_comment_part(boost::json::string_view,
+				boost::json::error_code&);
+		bool on_comment(boost::json::string_view, boost::json::error_code&);
+	};
+
+	boost::json::basic_parser<Handler> parser; ///< Reused parser state.
+
+public:
+	StudentRecordParser();
+
+	/**
+	 * @brief Parses one record.
+	 * @param json The record, one JSON object.
+	 * @return False if the JSON is malformed or a field is missing or has
+	 * the wrong type.
+	 */
+	bool parse(std::string_view json);
+
+	/**
+	 * @brief Returns a text field of the last record parsed successfully.
+	 * @param field The field.
+	 * @return View into the parser, valid until the next parse().
+	 */
+	std::string_view text(TextField field) const;
+
+	/**
+	 * @brief Returns an integer field of the last record parsed successfully.
+	 * @param field The field.
+	 * @return The value.
+	 */
+	std::int64_t number(NumberField field) const;
+};
+
+#endif /* STUDENTRECORDPARSER_H_ */
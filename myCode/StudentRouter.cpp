@@ -0,0 +1,864 @@
+/**
+ * @file StudentRouter.cpp
+ * @brief StudentRouter class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentRouter.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "SocketChannel.h"
+#include "StudentDb.h"
+#include "StudentProtocol.h"
+
+using boost::asio::ip::tcp;
+
+/**
+ * @brief Bytes of one TOP_STUDENTS entry.
+ */
+static const std::size_t rankingEntrySize = 32;
+
+/**
+ * @brief Concatenates the matches of the shards in shard order.
+ * @return False if a payload is malformed.
+ */
+static bool mergeSearch(std::uint32_t requestId, std::string_view request,
+		const std::vector<std::string_view> &payloads, std::string &out)
+{
+	StudentProtocol::Reader query(request);
+	std::uint8_t flags;
+	std::uint16_t limit;
+	if (!query.u8(flags) || !query.u16(limit))
+	{
+		return false;
+	}
+	std::uint64_t total = 0;
+	for (std::string_view payload : payloads)
+	{
+		StudentProtocol::Reader shard(payload);
+		std::uint32_t count;
+		if (!shard.u32(count))
+		{
+			return false;
+		}
+		total += count;
+	}
+	StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+	response.u32(static_cast<std::uint32_t>(std::min<std::uint64_t>(total,
+			std::numeric_limits<std::uint32_t>::max())));
+	std::size_t countAt = response.size();
+	response.u16(0);
+	std::uint16_t returned = 0;
+	bool full = false;
+	for (std::string_view payload : payloads)
+	{
+		StudentProtocol::Reader shard(payload);
+		std::uint32_t count;
+		std::uint16_t entries;
+		if (!shard.u32(count) || !shard.u16(entries))
+		{
+			return false;
+		}
+		for (std::uint16_t i = 0; i < entries && returned < limit && !full;
+				++i)
+		{
+			std::uint32_t matrikelNumber;
+			std::string_view firstName;
+			std::string_view lastName;
+			if (!shard.u32(matrikelNumber) || !shard.text(firstName)
+					|| !shard.text(lastName))
+			{
+				return false;
+			}
+			// Stop before the response outgrows a frame.
+			if (response.size() + 8 + firstName.size() + lastName.size()
+					> StudentProtocol::lengthSize
+							+ StudentProtocol::maxFrameSize)
+			{
+				full = true;
+				break;
+			}
+			response.u32(matrikelNumber);
+			response.text(firstName);
+			response.text(lastName);
+			++returned;
+		}
+	}
+	response.u16At(countAt, returned);
+	response.finish();
+	return true;
+}
+
+/**
+ * @brief Adds up the figures of the shards, the catalog is the same on all.
+ * @return False if a payload is malformed.
+ */
+static bool mergeStatistics(std::uint32_t requestId,
+		const std::vector<std::string_view> &payloads, std::string &out)
+{
+	std::uint64_t students = 0;
+	std::uint64_t courses = 0;
+	std::uint64_t enrollments = 0;
+	std::uint64_t graded = 0;
+	double gradeSum = 0.0;
+	for (std::string_view payload : payloads)
+	{
+		StudentProtocol::Reader shard(payload);
+		std::uint64_t shardStudents;
+		std::uint64_t shardCourses;
+		std::uint64_t shardEnrollments;
+		std::uint64_t shardGraded;
+		double average;
+		if (!shard.u64(shardStudents) || !shard.u64(shardCourses)
+				|| !shard.u64(shardEnrollments) || !shard.u64(shardGraded)
+				|| !shard.real(average))
+		{
+			return false;
+		}
+		students += shardStudents;
+		courses = std::max(courses, shardCourses);
+		enrollments += shardEnrollments;
+		graded += shardGraded;
+		gradeSum += average * shardGraded;
+	}
+	StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+	response.u64(students);
+	response.u64(courses);
+	response.u64(enrollments);
+	response.u64(graded);
+	response.real(graded > 0 ? gradeSum / graded : 0.0);
+	response.finish();
+	return true;
+}
+
+/**
+ * @brief Combines the grade distributions of a course on all shards.
+ *
+ * Means and pass rates are weighted by the graded count, the standard
+ * deviation is recombined from the mean squares of the shards.
+ * @return False if a payload is malformed.
+ */
+static bool mergeCourseStatistics(std::uint32_t requestId,
+		const std::vector<std::string_view> &payloads, std::string &out)
+{
+	std::uint64_t enrolled = 0;
+	std::uint64_t graded = 0;
+	double gradeSum = 0.0;
+	double squareSum = 0.0;
+	double passed = 0.0;
+	std::array<std::uint64_t, StudentDb::gradeBuckets> histogram = {{}};
+	for (std::string_view payload : payloads)
+	{
+		StudentProtocol::Reader shard(payload);
+		std::uint32_t shardEnrolled;
+		std::uint32_t shardGraded;
+		double mean;
+		double deviation;
+		double passRate;
+		if (!shard.u32(shardEnrolled) || !shard.u32(shardGraded)
+				|| !shard.real(mean) || !shard.real(deviation)
+				|| !shard.real(passRate))
+		{
+			return false;
+		}
+		for (std::uint64_t &bucket : histogram)
+		{
+			std::uint32_t count;
+			if (!shard.u32(count))
+			{
+				return false;
+			}
+			bucket += count;
+		}
+		enrolled += shardEnrolled;
+		graded += shardGraded;
+		gradeSum += mean * shardGraded;
+		squareSum += (deviation * deviation + mean * mean) * shardGraded;
+		passed += passRate * shardGraded;
+	}
+	double mean = 0.0;
+	double deviation = 0.0;
+	double passRate = 0.0;
+	if (graded > 0)
+	{
+		mean = gradeSum / graded;
+		double variance = squareSum / graded - mean * mean;
+		deviation = variance > 0 ? std::sqrt(variance) : 0.0;
+		passRate = passed / graded;
+	}
+	StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+	response.u32(static_cast<std::uint32_t>(enrolled));
+	response.u32(static_cast<std::uint32_t>(graded));
+	response.real(mean);
+	response.real(deviation);
+	response.real(passRate);
+	for (std::uint64_t count : histogram)
+	{
+		response.u32(static_cast<std::uint32_t>(count));
+	}
+	response.finish();
+	return true;
+}
+
+/**
+ * @brief Ranks the best students of all shards like
+ * StudentDb::topStudentsByGpa().
+ * @return False if a payload is malformed.
+ */
+static bool mergeTopStudents(std::uint32_t requestId,
+		std::string_view request, const std::vector<std::string_view> &payloads,
+		std::string &out)
+{
+	StudentProtocol::Reader query(request);
+	std::uint16_t count;
+	if (!query.u16(count))
+	{
+		return false;
+	}
+	std::vector<StudentDb::GradeSummary> ranking;
+	for (std::string_view payload : payloads)
+	{
+		StudentProtocol::Reader shard(payload);
+		std::uint16_t returned;
+		if (!shard.u16(returned))
+		{
+			return false;
+		}
+		for (std::uint16_t i = 0; i < returned; ++i)
+		{
+			std::uint32_t matrikelNumber;
+			StudentDb::GradeSummary summary;
+			if (!shard.u32(matrikelNumber) || !shard.real(summary.gpa)
+					|| !shard.real(summary.gradedCredits)
+					|| !shard.real(summary.earnedCredits)
+					|| !shard.u32(summary.gradedCount))
+			{
+				return false;
+			}
+			summary.matrikelNumber = matrikelNumber;
+			ranking.push_back(summary);
+		}
+	}
+	std::sort(ranking.begin(), ranking.end(),
+			[](const StudentDb::GradeSummary &a,
+					const StudentDb::GradeSummary &b)
+			{
+				if (std::abs(a.gpa - b.gpa) > 1e-9)
+				{
+					return a.gpa < b.gpa;
+				}
+				return a.matrikelNumber < b.matrikelNumber;
+			});
+	ranking.resize(std::min<std::size_t>(ranking.size(),
+			std::min<std::size_t>(count,
+					(StudentProtocol::maxFrameSize - 16) / rankingEntrySize)));
+	StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+	response.u16(static_cast<std::uint16_t>(ranking.size()));
+	for (const StudentDb::GradeSummary &summary : ranking)
+	{
+		response.u32(summary.matrikelNumber);
+		response.real(summary.gpa);
+		response.real(summary.gradedCredits);
+		response.real(summary.earnedCredits);
+		response.u32(summary.gradedCount);
+	}
+	response.finish();
+	return true;
+}
+
+/**
+ * @class StudentRouter::Connection
+ * @brief State of one client and its shard connections, only touched on the
+ * connection's strand.
+ *
+ * Every request gets a response slot in request order. Forwarded requests
+ * are queued on their shard connection, whose responses come back in the
+ * same order, scattered requests on all of them. The filled slots at the
+ * front are sent with one write.
+ */
+class StudentRouter::Connection: public std::enable_shared_from_this<
+		StudentRouter::Connection>
+{
+private:
+	/**
+	 * @struct Response
+	 * @brief Response slot of a request.
+	 */
+	struct Response
+	{
+		std::string frame; ///< The encoded response.
+		bool ready = false; ///< Set once frame is complete.
+	};
+
+	/**
+	 * @struct Gather
+	 * @brief A request sent to all shards, waiting for their answers.
+	 */
+	struct Gather
+	{
+		std::uint32_t requestId; ///< Id of the request.
+		std::uint8_t operation; ///< Code of the request.
+		std::string request; ///< Payload of the request.
+		std::vector<std::string> responses; ///< Response frame of each shard.
+		std::size_t missing; ///< Shards that have not answered yet.
+	};
+
+	/**
+	 * @struct Pending
+	 * @brief A request a shard has not answered yet.
+	 */
+	struct Pending
+	{
+		unsigned long long sequence; ///< Sequence number of the response slot.
+		std::shared_ptr<Gather> gather; ///< Set for scattered requests.
+		std::string add; ///< Frame of an add, for trying the next shard.
+		std::size_t shardsLeft = 0; ///< Shards an add may still be tried on.
+	};
+
+	/**
+	 * @struct Upstream
+	 * @brief Connection to one shard.
+	 */
+	struct Upstream
+	{
+		SocketChannel channel; ///< Socket on the client's strand.
+		std::deque<Pending> pending; ///< Unanswered requests in order.
+
+		explicit Upstream(const tcp::socket::executor_type &executor) :
+				channel(executor)
+		{
+		}
+	};
+
+	StudentRouter &router; ///< Router owning the shard list.
+	SocketChannel channel; ///< Socket of the client, bound to a strand.
+	std::vector<std::unique_ptr<Upstream>> upstreams; ///< One connection per shard.
+	std::size_t connecting; ///< Shard connections not yet established.
+	std::size_t inputStart = 0; ///< Offset of the first unprocessed input byte.
+	std::deque<Response> responses; ///< Unsent responses in request order.
+	unsigned long long firstResponse = 0; ///< Sequence number of responses.front().
+
+	void read()
+	{
+		if (this->connecting > 0
+				|| this->responses.size() >= this->router.maxPipelined)
+		{
+			return;
+		}
+		auto self = shared_from_this();
+		this->channel.read([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			self->process();
+		});
+	}
+
+	/**
+	 * @brief Routes the complete requests, then sends what is ready and
+	 * reads on.
+	 */
+	void process()
+	{
+		std::string &input = this->channel.getInput();
+		while (!this->channel.isClosed()
+				&& this->responses.size() < this->router.maxPipelined)
+		{
+			std::string_view data(input);
+			data.remove_prefix(this->inputStart);
+			std::size_t size;
+			if (!StudentProtocol::frameSize(data, size))
+			{
+				break;
+			}
+			if (size < StudentProtocol::headerSize
+					|| size - StudentProtocol::lengthSize
+							> StudentProtocol::maxFrameSize)
+			{
+				this->close();
+				return;
+			}
+			if (data.size() < size)
+			{
+				break;
+			}
+			std::string_view frame = data.substr(0, size);
+			std::uint32_t requestId;
+			std::uint8_t operation;
+			std::string_view payload = StudentProtocol::split(frame, requestId,
+					operation);
+			this->inputStart += size;
+			this->responses.emplace_back();
+			this->route(requestId, operation, payload, frame);
+		}
+		if (this->inputStart == input.size())
+		{
+			input.clear();
+			this->inputStart = 0;
+		}
+		else if (this->inputStart >= SocketChannel::chunkSize)
+		{
+			input.erase(0, this->inputStart);
+			this->inputStart = 0;
+		}
+		this->flush();
+		this->read();
+	}
+
+	void route(std::uint32_t requestId, std::uint8_t operation,
+			std::string_view payload, std::string_view frame)
+	{
+		unsigned long long sequence = this->firstResponse
+				+ this->responses.size() - 1;
+		switch (operation)
+		{
+		case StudentProtocol::LOOKUP:
+		case StudentProtocol::UPDATE_NAME:
+		case StudentProtocol::UPDATE_DOB:
+		case StudentProtocol::UPDATE_ADDRESS:
+		{
+			// The matrikel number leads the payload and picks the shard.
+			StudentProtocol::Reader request(payload);
+			std::uint32_t matrikelNumber;
+			unsigned int shard;
+			if (!request.u32(matrikelNumber))
+			{
+				this->answer(requestId, StudentProtocol::MALFORMED);
+			}
+			else if (!this->router.map.shardOf(matrikelNumber, shard))
+			{
+				this->answer(requestId, StudentProtocol::NOT_FOUND);
+			}
+			else
+			{
+				this->forward(shard, frame, Pending
+				{ sequence, nullptr });
+			}
+			break;
+		}
+		case StudentProtocol::ADD_STUDENT:
+			this->forward(
+					this->router.nextShard++ % this->upstreams.size(), frame,
+					Pending
+					{ sequence, nullptr, std::string(frame),
+							this->upstreams.size() - 1 });
+			break;
+		case StudentProtocol::SEARCH:
+		case StudentProtocol::STATISTICS:
+		case StudentProtocol::COURSE_STATISTICS:
+		case StudentProtocol::TOP_STUDENTS:
+		{
+			auto gather = std::make_shared<Gather>();
+			gather->requestId = requestId;
+			gather->operation = operation;
+			gather->request = payload;
+			gather->responses.resize(this->upstreams.size());
+			gather->missing = this->upstreams.size();
+			++this->router.scattered;
+			for (std::size_t shard = 0; shard < this->upstreams.size();
+					++shard)
+			{
+				this->send(shard, frame, Pending
+				{ sequence, gather });
+			}
+			break;
+		}
+		case StudentProtocol::STATUS:
+		{
+			// The router keeps no data of its own.
+			Response &response = this->responses.back();
+			StudentProtocol::Writer status(response.frame, requestId,
+					payload.empty() ?
+							StudentProtocol::OK : StudentProtocol::MALFORMED);
+			if (payload.empty())
+			{
+				status.u8(StudentProtocol::STANDALONE);
+				status.u64(0);
+				status.u64(0);
+				status.u32(0);
+			}
+			status.finish();
+			this->complete(response);
+			break;
+		}
+		default:
+			this->answer(requestId, StudentProtocol::UNKNOWN_OPERATION);
+			break;
+		}
+	}
+
+	/**
+	 * @brief Fills the newest slot with a response without payload.
+	 */
+	void answer(std::uint32_t requestId, StudentProtocol::Status status)
+	{
+		Response &response = this->responses.back();
+		StudentProtocol::Writer(response.frame, requestId, status).finish();
+		this->complete(response);
+	}
+
+	void forward(std::size_t shard, std::string_view frame,
+			const Pending &pending)
+	{
+		++this->router.forwarded;
+		this->send(shard, frame, pending);
+	}
+
+	void send(std::size_t shard, std::string_view frame,
+			const Pending &pending)
+	{
+		Upstream &upstream = *this->upstreams[shard];
+		upstream.pending.push_back(pending);
+		upstream.channel.getOutbox().append(frame);
+		this->write(upstream);
+	}
+
+	void write(Upstream &upstream)
+	{
+		auto self = shared_from_this();
+		upstream.channel.write(
+				[self, &upstream](const boost::system::error_code &error)
+				{
+					if (error)
+					{
+						self->close();
+						return;
+					}
+					self->write(upstream);
+				});
+	}
+
+	void receive(Upstream &upstream, std::size_t shard)
+	{
+		auto self = shared_from_this();
+		upstream.channel.read(
+				[self, &upstream, shard](const boost::system::error_code &error)
+				{
+					if (error || self->channel.isClosed()
+							|| !self->deliver(upstream, shard))
+					{
+						self->close();
+						return;
+					}
+					self->flush();
+					self->receive(upstream, shard);
+				});
+	}
+
+	/**
+	 * @brief Hands the complete responses of a shard to their slots.
+	 * @return False if the shard broke the protocol.
+	 */
+	bool deliver(Upstream &upstream, std::size_t shard)
+	{
+		std::size_t start = 0;
+		while (true)
+		{
+			std::string_view data(upstream.channel.getInput());
+			data.remove_prefix(start);
+			std::size_t size;
+			if (!StudentProtocol::frameSize(data, size))
+			{
+				break;
+			}
+			if (size < StudentProtocol::headerSize
+					|| size - StudentProtocol::lengthSize
+							> StudentProtocol::maxFrameSize
+					|| upstream.pending.empty())
+			{
+				return false;
+			}
+			if (data.size() < size)
+			{
+				break;
+			}
+			start += size;
+			Pending pending = std::move(upstream.pending.front());
+			upstream.pending.pop_front();
+			Response &response = this->responses[pending.sequence
+					- this->firstResponse];
+			std::uint8_t status = static_cast<std::uint8_t>(data[8]);
+			if (status == StudentProtocol::FAILED && pending.shardsLeft > 0)
+			{
+				// The shard's matrikel range is used up.
+				--pending.shardsLeft;
+				this->send((shard + 1) % this->upstreams.size(), pending.add,
+						pending);
+				continue;
+			}
+			if (!pending.gather)
+			{
+				response.frame = data.substr(0, size);
+				this->complete(response);
+				continue;
+			}
+			Gather &gather = *pending.gather;
+			gather.responses[shard] = data.substr(0, size);
+			if (--gather.missing == 0)
+			{
+				StudentRouter::merge(gather.requestId, gather.operation,
+						gather.request, gather.responses, response.frame);
+				this->complete(response);
+			}
+		}
+		upstream.channel.getInput().erase(0, start);
+		return true;
+	}
+
+	void complete(Response &response)
+	{
+		response.ready = true;
+		++this->router.requests;
+		std::uint8_t status = static_cast<std::uint8_t>(response.frame[8]);
+		if (status != StudentProtocol::OK && status != StudentProtocol::NOT_FOUND)
+		{
+			++this->router.failures;
+		}
+	}
+
+	void flush()
+	{
+		// Responses stay in their slots while a write runs, so a client that
+		// does not read stops its requests from being read.
+		if (this->channel.isWriting() || this->channel.isClosed())
+		{
+			return;
+		}
+		while (!this->responses.empty() && this->responses.front().ready)
+		{
+			this->channel.getOutbox() += this->responses.front().frame;
+			this->responses.pop_front();
+			++this->firstResponse;
+		}
+		auto self = shared_from_this();
+		this->channel.write([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			self->process();
+		});
+	}
+
+	void close()
+	{
+		if (!this->channel.close())
+		{
+			return;
+		}
+		for (std::unique_ptr<Upstream> &upstream : this->upstreams)
+		{
+			upstream->channel.close();
+		}
+	}
+
+public:
+	Connection(StudentRouter &router, tcp::socket socket) :
+			router(router), channel(std::move(socket)), connecting(
+					router.shards.size())
+	{
+		for (std::size_t i = 0; i < router.shards.size(); ++i)
+		{
+			this->upstreams.push_back(
+					std::make_unique<Upstream>(
+							this->channel.getSocket().get_executor()));
+		}
+		++this->router.connectionsAccepted;
+		++this->router.connectionsOpen;
+	}
+
+	/**
+	 * @brief Connects to the shards, then starts serving the client.
+	 */
+	void start()
+	{
+		boost::system::error_code ignored;
+		this->channel.getSocket().set_option(tcp::no_delay(true), ignored);
+		auto self = shared_from_this();
+		for (std::size_t shard = 0; shard < this->upstreams.size(); ++shard)
+		{
+			Upstream &upstream = *this->upstreams[shard];
+			upstream.channel.getSocket().async_connect(
+					this->router.shards[shard],
+					[self, &upstream, shard](
+							const boost::system::error_code &error)
+					{
+						if (error || self->channel.isClosed())
+						{
+							self->close();
+							return;
+						}
+						boost::system::error_code ignored;
+						upstream.channel.getSocket().set_option(
+								tcp::no_delay(true), ignored);
+						self->receive(upstream, shard);
+						if (--self->connecting == 0)
+						{
+							self->read();
+						}
+					});
+		}
+	}
+
+	~Connection()
+	{
+		--this->router.connectionsOpen;
+	}
+};
+
+StudentRouter::StudentRouter(const std::vector<std::string> &shards,
+		unsigned int rangeSize, const std::string &address,
+		unsigned short port, unsigned int threads, std::size_t maxPipelined) :
+		map(static_cast<unsigned int>(shards.size()), rangeSize), maxPipelined(
+				std::max<std::size_t>(maxPipelined, 1)), nextShard(0), connectionsAccepted(
+				0), connectionsOpen(0), requests(0), forwarded(0), scattered(0), failures(
+				0), acceptor(ioContext,
+				tcp::endpoint(boost::asio::ip::make_address(address), port))
+{
+	if (shards.empty())
+	{
+		throw std::invalid_argument("A router needs at least one shard");
+	}
+	tcp::resolver resolver(this->ioContext);
+	for (const std::string &shard : shards)
+	{
+		std::size_t colon = shard.rfind(':');
+		if (colon == std::string::npos)
+		{
+			throw std::invalid_argument("Shard address without port: " + shard);
+		}
+		this->shards.push_back(
+				*resolver.resolve(shard.substr(0, colon),
+						shard.substr(colon + 1)).begin());
+	}
+
+	if (threads == 0)
+	{
+		threads = std::min(std::max(std::thread::hardware_concurrency(), 1u),
+				4u);
+	}
+	this->accept();
+	for (unsigned int i = 0; i < threads; ++i)
+	{
+		this->workers.emplace_back([this]
+		{
+			this->ioContext.run();
+		});
+	}
+}
+
+void StudentRouter::accept()
+{
+	// Each client gets its own strand, shared with its shard connections.
+	this->acceptor.async_accept(boost::asio::make_strand(this->ioContext),
+			[this](const boost::system::error_code &error, tcp::socket socket)
+			{
+				if (error)
+				{
+					return;
+				}
+				std::make_shared<Connection>(*this, std::move(socket))->start();
+				this->accept();
+			});
+}
+
+void StudentRouter::merge(std::uint32_t requestId, std::uint8_t operation,
+		std::string_view request, const std::vector<std::string> &responses,
+		std::string &out)
+{
+	std::vector<std::string_view> payloads;
+	for (const std::string &frame : responses)
+	{
+		std::uint32_t id;
+		std::uint8_t status;
+		std::string_view payload = StudentProtocol::split(frame, id, status);
+		if (status != StudentProtocol::OK)
+		{
+			// Shards reject the same malformed requests and unknown courses.
+			out = frame;
+			return;
+		}
+		payloads.push_back(payload);
+	}
+	bool merged = false;
+	switch (operation)
+	{
+	case StudentProtocol::SEARCH:
+		merged = mergeSearch(requestId, request, payloads, out);
+		break;
+	case StudentProtocol::STATISTICS:
+		merged = mergeStatistics(requestId, payloads, out);
+		break;
+	case StudentProtocol::COURSE_STATISTICS:
+		merged = mergeCourseStatistics(requestId, payloads, out);
+		break;
+	case StudentProtocol::TOP_STUDENTS:
+		merged = mergeTopStudents(requestId, request, payloads, out);
+		break;
+	}
+	if (!merged)
+	{
+		out.clear();
+		StudentProtocol::Writer(out, requestId, StudentProtocol::FAILED).finish();
+	}
+}
+
+unsigned short StudentRouter::getPort() const
+{
+	return this->acceptor.local_endpoint().port();
+}
+
+unsigned int StudentRouter::getThreadCount() const
+{
+	return static_cast<unsigned int>(this->workers.size());
+}
+
+unsigned int StudentRouter::getShardCount() const
+{
+	return this->map.getShardCount();
+}
+
+StudentRouter::Statistics StudentRouter::getStatistics() const
+{
+	Statistics statistics;
+	statistics.connectionsAccepted = this->connectionsAccepted;
+	statistics.connectionsOpen = this->connectionsOpen;
+	statistics.requests = this->requests;
+	statistics.forwarded = this->forwarded;
+	statistics.scattered = this->scattered;
+	statistics.failures = this->failures;
+	return statistics;
+}
+
+void StudentRouter::stop()
+{
+	if (this->workers.empty())
+	{
+		return;
+	}
+	this->ioContext.stop();
+	for (std::thread &worker : this->workers)
+	{
+		worker.join();
+	}
+	this->workers.clear();
+	boost::system::error_code ignored;
+	this->acceptor.close(ignored);
+}
+
+StudentRouter::~StudentRouter()
+{
+	this->stop();
+}
@@ -0,0 +1,146 @@
+/**
+ * @file StudentRouter.h
+ * @brief StudentRouter class declaration for serving students sharded over
+ * several StudentServer processes.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTROUTER_H_
+#define STUDENTROUTER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include "ShardMap.h"
+
+/**
+ * @class StudentRouter
+ * @brief Speaks the StudentProtocol towards clients and spreads their
+ * requests over the shards of a student database.
+ *
+ * Every shard is a StudentServer holding the students of one ShardMap range
+ * and a copy of the course catalog. The router keeps no data: lookups and
+ * updates go to the shard owning the matrikel number, adds to the shards in
+ * turn, each of which assigns a number from its own range. An add a shard
+ * fails, e.g. because its range is used up, is tried on the next one.
+ * Searches and the aggregates are sent to all shards at once and their
+ * answers merged.
+ *
+ * Like the server, the router runs its connections on a small pool of
+ * threads, each client on its own strand. A client gets its own connection
+ * to every shard on the same strand, so its requests reach each shard in
+ * order and it sees its own writes without the router waiting for them.
+ * Responses go back in request order. If a shard connection fails, the
+ * client is disconnected.
+ */
+class StudentRouter
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Counters of the router.
+	 */
+	struct Statistics
+	{
+		unsigned long long connectionsAccepted; ///< Clients connected so far.
+		unsigned int connectionsOpen; ///< Clients connected now.
+		unsigned long long requests; ///< Requests answered.
+		unsigned long long forwarded; ///< Requests sent to one shard.
+		unsigned long long scattered; ///< Requests sent to all shards.
+		unsigned long long failures; ///< Requests answered with another status than OK or NOT_FOUND.
+	};
+
+private:
+	class Connection;
+
+	ShardMap map; ///< Matrikel ranges of the shards.
+	std::vector<boost::asio::ip::tcp::endpoint> shards; ///< Address of each shard.
+	std::size_t maxPipelined; ///< Unsent responses per connection before reading pauses.
+	std::atomic<unsigned int> nextShard; ///< Shard of the next added student.
+	std::atomic<unsigned long long> connectionsAccepted; ///< Counter of clients.
+	std::atomic<unsigned int> connectionsOpen; ///< Clients connected now.
+	std::atomic<unsigned long long> requests; ///< Counter of requests.
+	std::atomic<unsigned long long> forwarded; ///< Counter of point requests.
+	std::atomic<unsigned long long> scattered; ///< Counter of scattered requests.
+	std::atomic<unsigned long long> failures; ///< Counter of failed requests.
+	boost::asio::io_context ioContext; ///< Runs all sockets.
+	boost::asio::ip::tcp::acceptor acceptor; ///< Listening socket.
+	std::vector<std::thread> workers; ///< Threads running the io_context.
+
+	/**
+	 * @brief Waits for the next client.
+	 */
+	void accept();
+
+	/**
+	 * @brief Combines the answers of all shards to a scattered request.
+	 * @param requestId Id of the request.
+	 * @param operation Code of the request.
+	 * @param request Payload of the request.
+	 * @param responses Response frame of each shard, in shard order.
+	 * @param out Receives the response frame.
+	 */
+	static void merge(std::uint32_t requestId, std::uint8_t operation,
+			std::string_view request, const std::vector<std::string> &responses,
+			std::string &out);
+
+public:
+	/**
+	 * @brief Starts routing to a set of shards.
+	 * @param shards "host:port" of each shard's server, shard 0 first.
+	 * @param rangeSize Matrikel numbers per shard, see ShardMap.
+	 * @param address Address to listen on.
+	 * @param port TCP port, 0 picks a free one.
+	 * @param threads Size of the thread pool, 0 selects one per core, at
+	 * most four.
+	 * @param maxPipelined Unsent responses per connection before the router
+	 * stops reading its requests.
+	 * @throw std::invalid_argument If there is no shard or an address has
+	 * no port.
+	 */
+	StudentRouter(const std::vector<std::string> &shards,
+			unsigned int rangeSize, const std::string &address,
+			unsigned short port, unsigned int threads = 0,
+			std::size_t maxPipelined = 1024);
+
+	StudentRouter(const StudentRouter&) = delete;
+	StudentRouter& operator=(const StudentRouter&) = delete;
+
+	/**
+	 * @brief Returns the port the router listens on.
+	 * @return The bound port.
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * @brief Returns the number of pool threads.
+	 * @return Threads running the connections.
+	 */
+	unsigned int getThreadCount() const;
+
+	/**
+	 * @brief Returns the number of shards.
+	 * @return The shard count.
+	 */
+	unsigned int getShardCount() const;
+
+	/**
+	 * @brief Returns the counters.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Closes all connections and joins the pool threads.
+	 */
+	void stop();
+
+	virtual ~StudentRouter();
+};
+
+#endif /* STUDENTROUTER_H_ */
@@ -0,0 +1,714 @@
+/**
+ * @file StudentServer.cpp
+ * @brief StudentServer class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "StudentServer.h"
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <utility>
+#include "SocketChannel.h"
+
+using boost::asio::ip::tcp;
+
+/**
+ * @class StudentServer::Connection
+ * @brief State of one client, only touched on the connection's strand.
+ *
+ * Every request gets a response slot in request order. Queries fill their
+ * slot at once, mutations when the writer thread reports back. The filled
+ * slots at the front are sent with one write.
+ */
+class StudentServer::Connection: public std::enable_shared_from_this<
+		StudentServer::Connection>
+{
+private:
+	/**
+	 * @struct Response
+	 * @brief Response slot of a request.
+	 */
+	struct Response
+	{
+		std::string frame; ///< The encoded response.
+		bool ready = false; ///< Set once frame is complete.
+	};
+
+	StudentServer &server; ///< Server owning the database.
+	SocketChannel channel; ///< Socket of the client, bound to a strand.
+	std::size_t inputStart = 0; ///< Offset of the first unprocessed input byte.
+	std::deque<Response> responses; ///< Unsent responses in request order.
+	unsigned long long firstResponse = 0; ///< Sequence number of responses.front().
+	unsigned int mutationsInFlight = 0; ///< Mutations queued but not applied.
+
+	void read()
+	{
+		if (this->responses.size() >= this->server.maxPipelined)
+		{
+			return;
+		}
+		auto self = shared_from_this();
+		this->channel.read([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			self->process();
+		});
+	}
+
+	/**
+	 * @brief Works through the complete requests that may run now, then
+	 * sends what is ready and reads on.
+	 */
+	void process()
+	{
+		std::string &input = this->channel.getInput();
+		while (!this->channel.isClosed()
+				&& this->responses.size() < this->server.maxPipelined)
+		{
+			std::string_view data(input);
+			data.remove_prefix(this->inputStart);
+			std::size_t size;
+			if (!StudentProtocol::frameSize(data, size))
+			{
+				break;
+			}
+			if (size < StudentProtocol::headerSize
+					|| size - StudentProtocol::lengthSize
+							> StudentProtocol::maxFrameSize)
+			{
+				this->close();
+				return;
+			}
+			if (data.size() < size)
+			{
+				break;
+			}
+			std::uint32_t requestId;
+			std::uint8_t operation;
+			std::string_view payload = StudentProtocol::split(
+					data.substr(0, size), requestId, operation);
+			bool query = StudentProtocol::isQuery(operation);
+			if (query && this->mutationsInFlight > 0)
+			{
+				// Reads wait for the client's earlier writes.
+				break;
+			}
+			this->inputStart += size;
+			this->responses.emplace_back();
+			if (query)
+			{
+				this->answer(requestId, operation, payload);
+			}
+			else
+			{
+				this->mutate(requestId, payload, operation);
+			}
+		}
+		if (this->inputStart == input.size())
+		{
+			input.clear();
+			this->inputStart = 0;
+		}
+		else if (this->inputStart >= SocketChannel::chunkSize)
+		{
+			input.erase(0, this->inputStart);
+			this->inputStart = 0;
+		}
+		this->flush();
+		this->read();
+	}
+
+	void answer(std::uint32_t requestId, std::uint8_t operation,
+			std::string_view payload)
+	{
+		Response &response = this->responses.back();
+		if (operation == StudentProtocol::STATUS)
+		{
+			this->server.answerStatus(requestId, payload, response.frame);
+			this->complete(response);
+			return;
+		}
+		try
+		{
+			this->server.pipeline.query([&](const StudentDb &db)
+			{
+				this->server.answerQuery(db, requestId, operation, payload,
+						response.frame);
+			});
+		} catch (const std::exception&)
+		{
+			response.frame.clear();
+			StudentProtocol::Writer failed(response.frame, requestId,
+					StudentProtocol::FAILED);
+			failed.finish();
+		}
+		this->complete(response);
+	}
+
+	void mutate(std::uint32_t requestId, std::string_view payload,
+			std::uint8_t operation)
+	{
+		Mutation mutation;
+		StudentProtocol::Status status = StudentProtocol::READ_ONLY;
+		if (operation == StudentProtocol::RESTORE_STUDENT)
+		{
+			status = StudentProtocol::UNKNOWN_OPERATION;
+		}
+		else if (!this->server.hooks.readOnly)
+		{
+			status = StudentServer::decodeMutation(&this->server.validator,
+					operation, payload, mutation);
+		}
+		if (status != StudentProtocol::OK)
+		{
+			Response &response = this->responses.back();
+			StudentProtocol::Writer rejected(response.frame, requestId, status);
+			rejected.finish();
+			this->complete(response);
+			return;
+		}
+		++this->mutationsInFlight;
+		++this->server.mutations;
+		unsigned long long sequence = this->firstResponse
+				+ this->responses.size() - 1;
+		bool added = operation == StudentProtocol::ADD_STUDENT;
+		// The log needs the request, copied only if there is a log.
+		std::string logged;
+		if (this->server.hooks.logMutation)
+		{
+			logged = payload;
+		}
+		auto self = shared_from_this();
+		this->server.pipeline.execute(
+				[self, mutation, requestId, sequence, added, operation, logged](
+						StudentDb &db)
+				{
+					const Hooks &hooks = self->server.hooks;
+					unsigned int matrikelNumber = 0;
+					StudentProtocol::Status status;
+					try
+					{
+						// A shard's range of new matrikel numbers may be used up.
+						status = added
+								&& Student::getNextMatrikelNumber()
+										> hooks.lastMatrikel ?
+								StudentProtocol::FAILED : mutation(db, matrikelNumber);
+					}
+					catch (const std::exception&)
+					{
+						status = StudentProtocol::FAILED;
+					}
+					if (status == StudentProtocol::OK && hooks.logMutation)
+					{
+						if (added)
+						{
+							std::string restore;
+							StudentProtocol::Writer record(restore, 0,
+									StudentProtocol::RESTORE_STUDENT);
+							record.u32(matrikelNumber);
+							record.bytes(logged);
+							hooks.logMutation(
+									StudentProtocol::RESTORE_STUDENT,
+									std::string_view(restore).substr(
+											StudentProtocol::headerSize));
+						}
+						else
+						{
+							hooks.logMutation(operation, logged);
+						}
+					}
+					boost::asio::post(self->channel.getSocket().get_executor(),
+							[self, requestId, sequence, added, status,
+									matrikelNumber]
+							{
+								Response &response = self->responses[sequence
+										- self->firstResponse];
+								StudentProtocol::Writer done(response.frame,
+										requestId, status);
+								if (added && status == StudentProtocol::OK)
+								{
+									done.u32(matrikelNumber);
+								}
+								done.finish();
+								self->complete(response);
+								--self->mutationsInFlight;
+								self->process();
+							});
+				});
+	}
+
+	void complete(Response &response)
+	{
+		response.ready = true;
+		++this->server.requests;
+		std::uint8_t status = static_cast<std::uint8_t>(response.frame[8]);
+		if (status != StudentProtocol::OK && status != StudentProtocol::NOT_FOUND)
+		{
+			++this->server.failures;
+		}
+	}
+
+	void flush()
+	{
+		// Responses stay in their slots while a write runs, so a client that
+		// does not read stops its requests from being read.
+		if (this->channel.isWriting() || this->channel.isClosed())
+		{
+			return;
+		}
+		while (!this->responses.empty() && this->responses.front().ready)
+		{
+			this->channel.getOutbox() += this->responses.front().frame;
+			this->responses.pop_front();
+			++this->firstResponse;
+		}
+		auto self = shared_from_this();
+		this->channel.write([self](const boost::system::error_code &error)
+		{
+			if (error)
+			{
+				self->close();
+				return;
+			}
+			self->process();
+		});
+	}
+
+	void close()
+	{
+		this->channel.close();
+	}
+
+public:
+	Connection(StudentServer &server, tcp::socket socket) :
+			server(server), channel(std::move(socket))
+	{
+		++this->server.connectionsAccepted;
+		++this->server.connectionsOpen;
+	}
+
+	/**
+	 * @brief Starts serving the client.
+	 */
+	void start()
+	{
+		boost::system::error_code ignored;
+		this->channel.getSocket().set_option(tcp::no_delay(true), ignored);
+		this->read();
+	}
+
+	~Connection()
+	{
+		--this->server.connectionsOpen;
+	}
+};
+
+StudentServer::StudentServer(StudentDb &db, const std::string &address,
+		unsigned short port, unsigned int threads, std::size_t maxPipelined) :
+		maxPipelined(std::max<std::size_t>(maxPipelined, 1)), connectionsAccepted(
+				0), connectionsOpen(0), requests(0), mutations(0), failures(0), acceptor(
+				ioContext,
+				tcp::endpoint(boost::asio::ip::make_address(address), port)), ownPipeline(
+				std::make_unique<MutationPipeline>(db)), pipeline(*ownPipeline)
+{
+	this->start(threads);
+}
+
+StudentServer::StudentServer(MutationPipeline &pipeline,
+		const std::string &address, unsigned short port,
+		const Hooks &hooks, unsigned int threads,
+		std::size_t maxPipelined) :
+		maxPipelined(std::max<std::size_t>(maxPipelined, 1)), connectionsAccepted(
+				0), connectionsOpen(0), requests(0), mutations(0), failures(0), acceptor(
+				ioContext,
+				tcp::endpoint(boost::asio::ip::make_address(address), port)), hooks(
+				hooks), pipeline(pipeline)
+{
+	this->start(threads);
+}
+
+void StudentServer::start(unsigned int threads)
+{
+	if (threads == 0)
+	{
+		threads = std::min(std::max(std::thread::hardware_concurrency(), 1u),
+				4u);
+	}
+	this->accept();
+	for (unsigned int i = 0; i < threads; ++i)
+	{
+		this->workers.emplace_back([this]
+		{
+			this->ioContext.run();
+		});
+	}
+}
+
+void StudentServer::accept()
+{
+	// Each connection gets its own strand, so its handlers never overlap.
+	this->acceptor.async_accept(boost::asio::make_strand(this->ioContext),
+			[this](const boost::system::error_code &error, tcp::socket socket)
+			{
+				if (error)
+				{
+					return;
+				}
+				std::make_shared<Connection>(*this, std::move(socket))->start();
+				this->accept();
+			});
+}
+
+void StudentServer::answerQuery(const StudentDb &db, std::uint32_t requestId,
+		std::uint8_t operation, std::string_view payload,
+		std::string &out) const
+{
+	StudentProtocol::Reader request(payload);
+	if (operation == StudentProtocol::LOOKUP)
+	{
+		std::uint32_t matrikelNumber;
+		if (!request.u32(matrikelNumber) || !request.complete())
+		{
+			StudentProtocol::Writer(out, requestId, StudentProtocol::MALFORMED).finish();
+			return;
+		}
+		if (!db.matrikelNumberExists(matrikelNumber))
+		{
+			StudentProtocol::Writer(out, requestId, StudentProtocol::NOT_FOUND).finish();
+			return;
+		}
+		const Student &student = db.getStudent(matrikelNumber);
+		std::shared_ptr<Address> address = student.getAddress();
+		StudentRecord record;
+		record.firstName = student.getFirstName();
+		record.lastName = student.getLastName();
+		record.dateOfBirth = student.getDateOfBirth();
+		record.street = address->getStreet();
+		record.postalCode = address->getPostalCode();
+		record.city = address->getCity();
+		record.additionalInfo = address->getAdditionalInfo();
+		StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+		response.u32(matrikelNumber);
+		response.student(record);
+		response.finish();
+		return;
+	}
+	if (operation == StudentProtocol::STATISTICS)
+	{
+		if (!request.complete())
+		{
+			StudentProtocol::Writer(out, requestId, StudentProtocol::MALFORMED).finish();
+			return;
+		}
+		StudentDb::Statistics statistics = db.computeStatistics();
+		StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+		response.u64(statistics.studentCount);
+		response.u64(statistics.courseCount);
+		response.u64(statistics.enrollmentCount);
+		response.u64(statistics.gradedEnrollmentCount);
+		response.real(statistics.averageGrade);
+		response.finish();
+		return;
+	}
+	if (operation == StudentProtocol::COURSE_STATISTICS)
+	{
+		std::uint32_t courseKey;
+		if (!request.u32(courseKey) || !request.complete())
+		{
+			StudentProtocol::Writer(out, requestId, StudentProtocol::MALFORMED).finish();
+			return;
+		}
+		if (!db.courseExists(courseKey))
+		{
+			StudentProtocol::Writer(out, requestId, StudentProtocol::NOT_FOUND).finish();
+			return;
+		}
+		StudentDb::CourseStatistics statistics = db.getCourseStatistics(
+				courseKey);
+		StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+		response.u32(static_cast<std::uint32_t>(statistics.enrolledCount));
+		response.u32(static_cast<std::uint32_t>(statistics.gradedCount));
+		response.real(statistics.meanGrade);
+		response.real(statistics.standardDeviation);
+		response.real(statistics.passRate);
+		for (std::size_t count : statistics.histogram)
+		{
+			response.u32(static_cast<std::uint32_t>(count));
+		}
+		response.finish();
+		return;
+	}
+	if (operation == StudentProtocol::TOP_STUDENTS)
+	{
+		std::uint16_t count;
+		if (!request.u16(count) || !request.complete())
+		{
+			StudentProtocol::Writer(out, requestId, StudentProtocol::MALFORMED).finish();
+			return;
+		}
+		// 32 bytes per student, at most what fits into a frame.
+		std::vector<StudentDb::GradeSummary> ranking = db.topStudentsByGpa(
+				std::min<std::size_t>(count,
+						(StudentProtocol::maxFrameSize - 16) / 32));
+		StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+		response.u16(static_cast<std::uint16_t>(ranking.size()));
+		for (const StudentDb::GradeSummary &summary : ranking)
+		{
+			response.u32(summary.matrikelNumber);
+			response.real(summary.gpa);
+			response.real(summary.gradedCredits);
+			response.real(summary.earnedCredits);
+			response.u32(summary.gradedCount);
+		}
+		response.finish();
+		return;
+	}
+
+	std::uint8_t flags;
+	std::uint16_t limit;
+	std::string_view text;
+	if (!request.u8(flags) || !request.u16(limit) || !request.text(text)
+			|| !request.complete())
+	{
+		StudentProtocol::Writer(out, requestId, StudentProtocol::MALFORMED).finish();
+		return;
+	}
+	std::vector<unsigned int> matches = db.searchStudents(std::string(text),
+			(flags & 1) != 0);
+	StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+	response.u32(static_cast<std::uint32_t>(matches.size()));
+	std::size_t countAt = response.size();
+	response.u16(0);
+	std::uint16_t returned = 0;
+	for (unsigned int matrikelNumber : matches)
+	{
+		if (returned == limit)
+		{
+			break;
+		}
+		const Student &student = db.getStudent(matrikelNumber);
+		std::string firstName = student.getFirstName();
+		std::string lastName = student.getLastName();
+		// Stop before the response outgrows a frame.
+		if (response.size() + 8 + firstName.size() + lastName.size()
+				> StudentProtocol::lengthSize + StudentProtocol::maxFrameSize)
+		{
+			break;
+		}
+		response.u32(matrikelNumber);
+		response.text(firstName);
+		response.text(lastName);
+		++returned;
+	}
+	response.u16At(countAt, returned);
+	response.finish();
+}
+
+void StudentServer::answerStatus(std::uint32_t requestId,
+		std::string_view payload, std::string &out) const
+{
+	if (!payload.empty())
+	{
+		StudentProtocol::Writer(out, requestId, StudentProtocol::MALFORMED).finish();
+		return;
+	}
+	StudentProtocol::ReplicationStatus status =
+	{ StudentProtocol::STANDALONE, 0, 0, 0 };
+	if (this->hooks.status)
+	{
+		status = this->hooks.status();
+	}
+	StudentProtocol::Writer response(out, requestId, StudentProtocol::OK);
+	response.u8(status.role);
+	response.u64(status.appliedLsn);
+	response.u64(status.primaryLsn);
+	response.u32(status.lagMilliseconds);
+	response.finish();
+}
+
+StudentProtocol::Status StudentServer::decodeMutation(
+		const RecordValidator *validator, std::uint8_t operation,
+		std::string_view payload, Mutation &mutation)
+{
+	StudentProtocol::Reader request(payload);
+	std::uint32_t matrikelNumber;
+	switch (operation)
+	{
+	case StudentProtocol::ADD_STUDENT:
+	{
+		StudentRecord record;
+		if (!request.student(record) || !request.complete())
+		{
+			return StudentProtocol::MALFORMED;
+		}
+		if (validator != nullptr && !validator->isValid(record))
+		{
+			return StudentProtocol::INVALID;
+		}
+		mutation = [record](StudentDb &db, unsigned int &added)
+		{
+			added = db.addStudent(record.firstName, record.lastName,
+					record.dateOfBirth, record.street, record.postalCode,
+					record.city, record.additionalInfo);
+			return StudentProtocol::OK;
+		};
+		return StudentProtocol::OK;
+	}
+	case StudentProtocol::RESTORE_STUDENT:
+	{
+		StudentRecord record;
+		if (!request.u32(matrikelNumber) || !request.student(record)
+				|| !request.complete())
+		{
+			return StudentProtocol::MALFORMED;
+		}
+		if (validator != nullptr && !validator->isValid(record))
+		{
+			return StudentProtocol::INVALID;
+		}
+		mutation = [matrikelNumber, record](StudentDb &db, unsigned int &added)
+		{
+			if (!db.restoreStudent(matrikelNumber, record.firstName,
+					record.lastName, record.dateOfBirth, record.street,
+					record.postalCode, record.city, record.additionalInfo))
+			{
+				return StudentProtocol::FAILED;
+			}
+			added = matrikelNumber;
+			return StudentProtocol::OK;
+		};
+		return StudentProtocol::OK;
+	}
+	case StudentProtocol::UPDATE_NAME:
+	{
+		std::string_view firstName, lastName;
+		if (!request.u32(matrikelNumber) || !request.text(firstName)
+				|| !request.text(lastName) || !request.complete())
+		{
+			return StudentProtocol::MALFORMED;
+		}
+		if (validator != nullptr
+				&& (!validator->check(RecordValidator::FIRST_NAME, firstName)
+						|| !validator->check(RecordValidator::LAST_NAME,
+								lastName)))
+		{
+			return StudentProtocol::INVALID;
+		}
+		mutation = [matrikelNumber, first = std::string(firstName), last =
+				std::string(lastName)](StudentDb &db, unsigned int&)
+		{
+			if (!db.matrikelNumberExists(matrikelNumber))
+			{
+				return StudentProtocol::NOT_FOUND;
+			}
+			db.updateName(matrikelNumber, first, last);
+			return StudentProtocol::OK;
+		};
+		return StudentProtocol::OK;
+	}
+	case StudentProtocol::UPDATE_DOB:
+	{
+		Poco::DateTime dateOfBirth;
+		if (!request.u32(matrikelNumber) || !request.date(dateOfBirth)
+				|| !request.complete())
+		{
+			return StudentProtocol::MALFORMED;
+		}
+		mutation = [matrikelNumber, dateOfBirth](StudentDb &db, unsigned int&)
+		{
+			if (!db.matrikelNumberExists(matrikelNumber))
+			{
+				return StudentProtocol::NOT_FOUND;
+			}
+			db.updateDOB(matrikelNumber, dateOfBirth);
+			return StudentProtocol::OK;
+		};
+		return StudentProtocol::OK;
+	}
+	case StudentProtocol::UPDATE_ADDRESS:
+	{
+		std::string_view street, city, additionalInfo;
+		std::uint16_t postalCode;
+		if (!request.u32(matrikelNumber) || !request.text(street)
+				|| !request.u16(postalCode) || !request.text(city)
+				|| !request.text(additionalInfo) || !request.complete())
+		{
+			return StudentProtocol::MALFORMED;
+		}
+		if (validator != nullptr
+				&& (!validator->check(RecordValidator::STREET, street)
+						|| !validator->check(RecordValidator::CITY, city)
+						|| !validator->check(RecordValidator::ADDITIONAL_INFO,
+								additionalInfo)))
+		{
+			return StudentProtocol::INVALID;
+		}
+		mutation = [matrikelNumber, street = std::string(street), postalCode,
+				city = std::string(city), info = std::string(additionalInfo)](
+				StudentDb &db, unsigned int&)
+		{
+			if (!db.matrikelNumberExists(matrikelNumber))
+			{
+				return StudentProtocol::NOT_FOUND;
+			}
+			db.updateAddress(matrikelNumber, street, postalCode, city, info);
+			return StudentProtocol::OK;
+		};
+		return StudentProtocol::OK;
+	}
+	default:
+		return StudentProtocol::UNKNOWN_OPERATION;
+	}
+}
+
+unsigned short StudentServer::getPort() const
+{
+	return this->acceptor.local_endpoint().port();
+}
+
+unsigned int StudentServer::getThreadCount() const
+{
+	return static_cast<unsigned int>(this->workers.size());
+}
+
+StudentServer::Statistics StudentServer::getStatistics() const
+{
+	Statistics statistics;
+	statistics.connectionsAccepted = this->connectionsAccepted;
+	statistics.connectionsOpen = this->connectionsOpen;
+	statistics.requests = this->requests;
+	statistics.mutations = this->mutations;
+	statistics.failures = this->failures;
+	return statistics;
+}
+
+void StudentServer::stop()
+{
+	if (this->workers.empty())
+	{
+		return;
+	}
+	boost::system::error_code ignored;
+	this->acceptor.close(ignored);
+	// Queued mutations refer to the server and its connections, they have
+	// to finish while both exist and the pool can still send their responses.
+	this->pipeline.flush().wait();
+	this->ioContext.stop();
+	for (std::thread &worker : this->workers)
+	{
+		worker.join();
+	}
+	this->workers.clear();
+	this->pipeline.flush().wait();
+}
+
+StudentServer::~StudentServer()
+{
+	this->stop();
+}
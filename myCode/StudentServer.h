@@ -0,0 +1,220 @@
+/**
+ * @file StudentServer.h
+ * @brief StudentServer class declaration for serving a StudentDb over TCP.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef STUDENTSERVER_H_
+#define STUDENTSERVER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include "MutationPipeline.h"
+#include "RecordValidator.h"
+#include "StudentDb.h"
+#include "StudentProtocol.h"
+
+/**
+ * @class StudentServer
+ * @brief Answers StudentProtocol requests from many clients.
+ *
+ * Connections are served asynchronously by a small pool of threads, each
+ * connection on its own strand. Lookups and searches run on the pool
+ * threads under the shared lock of a MutationPipeline, mutations are queued
+ * to its writer thread and answered when they have been applied, so no pool
+ * thread waits for the writer.
+ *
+ * Clients may pipeline requests. A connection works through its requests in
+ * order and keeps the responses in order. Consecutive mutations are queued
+ * without waiting for each other, a read after a mutation waits until the
+ * mutation is applied, so a client always sees its own writes. A
+ * connection stops reading while too many responses are unsent.
+ *
+ * For replication, a server can share its MutationPipeline with a
+ * ReplicationPrimary or ReplicaFollower and is given Hooks: a primary logs
+ * every applied mutation, a follower rejects mutations, and both answer
+ * STATUS with their replication state. The shard of a StudentRouter
+ * deployment limits the matrikel numbers it hands out.
+ */
+class StudentServer
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Counters of the server.
+	 */
+	struct Statistics
+	{
+		unsigned long long connectionsAccepted; ///< Clients connected so far.
+		unsigned int connectionsOpen; ///< Clients connected now.
+		unsigned long long requests; ///< Requests answered.
+		unsigned long long mutations; ///< Requests that went to the writer thread.
+		unsigned long long failures; ///< Requests answered with another status than OK or NOT_FOUND.
+	};
+
+	/**
+	 * @struct Hooks
+	 * @brief Ties a server into a replicated or sharded deployment, all
+	 * members are optional.
+	 */
+	struct Hooks
+	{
+		/// Called on the writer thread after each mutation that changed the
+		/// database, with the operation and payload to replay it. Adds are
+		/// passed as RESTORE_STUDENT with the assigned matrikel number.
+		std::function<void(std::uint8_t, std::string_view)> logMutation;
+		/// Answers STATUS requests, a standalone server reports zeros.
+		std::function<StudentProtocol::ReplicationStatus()> status;
+		bool readOnly = false; ///< Answers mutations with READ_ONLY.
+		/// Largest matrikel number an add may assign, adds beyond it fail.
+		unsigned int lastMatrikel = std::numeric_limits<unsigned int>::max();
+	};
+
+	/**
+	 * @brief A decoded mutation, run by the writer thread.
+	 *
+	 * Returns the response status and sets the matrikel number of an added
+	 * student.
+	 */
+	typedef std::function<StudentProtocol::Status(StudentDb&, unsigned int&)> Mutation;
+
+private:
+	class Connection;
+
+	// The counters outlive the io_context, connections it still holds count
+	// themselves out when it is destroyed.
+	std::size_t maxPipelined; ///< Unsent responses per connection before reading pauses.
+	std::atomic<unsigned long long> connectionsAccepted; ///< Counter of clients.
+	std::atomic<unsigned int> connectionsOpen; ///< Clients connected now.
+	std::atomic<unsigned long long> requests; ///< Counter of requests.
+	std::atomic<unsigned long long> mutations; ///< Counter of mutations.
+	std::atomic<unsigned long long> failures; ///< Counter of failed requests.
+	boost::asio::io_context ioContext; ///< Runs all sockets.
+	boost::asio::ip::tcp::acceptor acceptor; ///< Listening socket.
+	Hooks hooks; ///< Role of the server in a deployment.
+	RecordValidator validator; ///< Rules for added and changed students.
+	// Declared after everything its queued commands use, it is destroyed first.
+	std::unique_ptr<MutationPipeline> ownPipeline; ///< Pipeline created by the server, if any.
+	MutationPipeline &pipeline; ///< Serializes the access to the database.
+	std::vector<std::thread> workers; ///< Threads running the io_context.
+
+	/**
+	 * @brief Waits for the next client.
+	 */
+	void accept();
+
+	/**
+	 * @brief Answers a lookup, search or aggregate.
+	 * @param db The database, locked for reading.
+	 * @param requestId Id of the request.
+	 * @param operation Code of the request.
+	 * @param payload Payload of the request.
+	 * @param out Receives the response frame.
+	 */
+	void answerQuery(const StudentDb &db, std::uint32_t requestId,
+			std::uint8_t operation, std::string_view payload,
+			std::string &out) const;
+
+	/**
+	 * @brief Answers a STATUS request.
+	 * @param requestId Id of the request.
+	 * @param payload Payload of the request, must be empty.
+	 * @param out Receives the response frame.
+	 */
+	void answerStatus(std::uint32_t requestId, std::string_view payload,
+			std::string &out) const;
+
+	/**
+	 * @brief Starts the pool threads.
+	 * @param threads Size of the pool, 0 selects one per core, at most four.
+	 */
+	void start(unsigned int threads);
+
+public:
+	/**
+	 * @brief Starts serving a database.
+	 *
+	 * While the server runs, the database must not be used elsewhere.
+	 * @param db The database.
+	 * @param address Address to listen on, e.g. "127.0.0.1" or "0.0.0.0".
+	 * @param port TCP port, 0 picks a free one.
+	 * @param threads Size of the thread pool, 0 selects one per core, at
+	 * most four.
+	 * @param maxPipelined Unsent responses per connection before the server
+	 * stops reading its requests.
+	 */
+	StudentServer(StudentDb &db, const std::string &address,
+			unsigned short port, unsigned int threads = 0,
+			std::size_t maxPipelined = 1024);
+
+	/**
+	 * @brief Starts serving a database through an existing pipeline.
+	 * @param pipeline The pipeline owning the database, must outlive the
+	 * server.
+	 * @param address Address to listen on.
+	 * @param port TCP port, 0 picks a free one.
+	 * @param hooks Role of the server in a deployment.
+	 * @param threads Size of the thread pool, 0 selects one per core, at
+	 * most four.
+	 * @param maxPipelined Unsent responses per connection before the server
+	 * stops reading its requests.
+	 */
+	StudentServer(MutationPipeline &pipeline, const std::string &address,
+			unsigned short port, const Hooks &hooks,
+			unsigned int threads = 0, std::size_t maxPipelined = 1024);
+
+	StudentServer(const StudentServer&) = delete;
+	StudentServer& operator=(const StudentServer&) = delete;
+
+	/**
+	 * @brief Decodes and checks a mutation request.
+	 * @param validator Rules for the text fields, nullptr accepts any text,
+	 * e.g. for mutations a primary already checked.
+	 * @param operation Code of the request, RESTORE_STUDENT included.
+	 * @param payload Payload of the request.
+	 * @param mutation Receives the mutation.
+	 * @return OK if the mutation was built, else the status to answer.
+	 */
+	static StudentProtocol::Status decodeMutation(
+			const RecordValidator *validator, std::uint8_t operation,
+			std::string_view payload, Mutation &mutation);
+
+	/**
+	 * @brief Returns the port the server listens on.
+	 * @return The bound port.
+	 */
+	unsigned short getPort() const;
+
+	/**
+	 * @brief Returns the number of pool threads.
+	 * @return Threads running the connections.
+	 */
+	unsigned int getThreadCount() const;
+
+	/**
+	 * @brief Returns the counters.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Closes all connections and joins the pool threads.
+	 */
+	void stop();
+
+	/**
+	 * @brief Stops the server and applies the queued mutations.
+	 */
+	virtual ~StudentServer();
+};
+
+#endif /* STUDENTSERVER_H_ */
@@ -0,0 +1,294 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief TaskScheduler class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <exception>
+
+static thread_local const TaskScheduler *workerOwner = nullptr;
+static thread_local int workerIndex = -1;
+
+TaskScheduler::TaskScheduler(unsigned int workerCount) :
+		stopping(false), pending(0), nextQueue(0), tasksSubmitted(0), tasksExecuted(
+				0), tasksStolen(0), busyMicroseconds(0), startTime(
+				std::chrono::steady_clock::now().time_since_epoch().count())
+{
+	if (workerCount == 0)
+	{
+		workerCount = std::thread::hardware_concurrency();
+		if (workerCount == 0)
+		{
+			workerCount = 1;
+		}
+	}
+	for (unsigned int i = 0; i < workerCount; ++i)
+	{
+		this->queues.push_back(std::make_unique<WorkerQueue>());
+	}
+	for (unsigned int i = 0; i < workerCount; ++i)
+	{
+		this->workers.emplace_back(&TaskScheduler::workerLoop, this, i);
+	}
+}
+
+unsigned int TaskScheduler::getWorkerCount() const
+{
+	return static_cast<unsigned int>(this->workers.size());
+}
+
+int TaskScheduler::currentWorkerIndex() const
+{
+	return workerOwner == this ? workerIndex : -1;
+}
+
+void TaskScheduler::submit(std::function<void()> task)
+{
+	int self = currentWorkerIndex();
+	unsigned int target =
+			self >= 0 ?
+					static_cast<unsigned int>(self) :
+					this->nextQueue++ % this->queues.size();
+	{
+		std::lock_guard<std::mutex> lock(this->queues[target]->mutex);
+		this->queues[target]->tasks.push_back(std::move(task));
+	}
+	++this->tasksSubmitted;
+	++this->pending;
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+	}
+	this->wakeUp.notify_one();
+}
+
+bool TaskScheduler::takeTask(int self, std::function<void()> &task)
+{
+	if (self >= 0)
+	{
+		WorkerQueue &own = *this->queues[self];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.tasks.empty())
+		{
+			task = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			--this->pending;
+			return true;
+		}
+	}
+
+	std::size_t count = this->queues.size();
+	std::size_t first = self >= 0 ? self + 1 : this->nextQueue.load();
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		std::size_t victim = (first + i) % count;
+		if (static_cast<int>(victim) == self)
+		{
+			continue;
+		}
+		WorkerQueue &other = *this->queues[victim];
+		std::lock_guard<std::mutex> lock(other.mutex);
+		if (!other.tasks.empty())
+		{
+			task = std::move(other.tasks.front());
+			other.tasks.pop_front();
+			--this->pending;
+			++this->tasksStolen;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool TaskScheduler::runPendingTask(int self)
+{
+	std::function<void()> task;
+	if (!takeTask(self, task))
+	{
+		return false;
+	}
+
+	auto begin = std::chrono::steady_clock::now();
+	try
+	{
+		task();
+	} catch (...)
+	{
+		// submit() documents that task exceptions are discarded
+	}
+	auto end = std::chrono::steady_clock::now();
+	this->busyMicroseconds += std::chrono::duration_cast
+			< std::chrono::microseconds > (end - begin).count();
+	++this->tasksExecuted;
+	return true;
+}
+
+void TaskScheduler::workerLoop(unsigned int index)
+{
+	workerOwner = this;
+	workerIndex = static_cast<int>(index);
+	while (true)
+	{
+		if (runPendingTask(workerIndex))
+		{
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(this->sleepMutex);
+		if (this->stopping && this->pending == 0)
+		{
+			break;
+		}
+		this->wakeUp.wait_for(lock, std::chrono::milliseconds(50), [this]
+		{	return this->pending > 0 || this->stopping;});
+	}
+}
+
+std::size_t TaskScheduler::defaultGrainSize(std::size_t count) const
+{
+	std::size_t chunks = 4 * (this->workers.size() + 1);
+	std::size_t grain = (count + chunks - 1) / chunks;
+	return grain == 0 ? 1 : grain;
+}
+
+void TaskScheduler::parallelFor(std::size_t begin, std::size_t end,
+		std::size_t grainSize,
+		const std::function<void(std::size_t, std::size_t)> &body)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+	if (grainSize == 0)
+	{
+		grainSize = defaultGrainSize(end - begin);
+	}
+	std::size_t chunkCount = (end - begin + grainSize - 1) / grainSize;
+	if (chunkCount == 1)
+	{
+		body(begin, end);
+		return;
+	}
+
+	// Guards remaining and error. Chunks decrement remaining under the mutex,
+	// so the waiting caller cannot return while the last one notifies.
+	std::mutex stateMutex;
+	std::condition_variable finished;
+	std::size_t remaining = chunkCount;
+	std::exception_ptr error;
+	auto finishChunk = [&]
+	{
+		std::lock_guard<std::mutex> lock(stateMutex);
+		if (--remaining == 0)
+		{
+			finished.notify_all();
+		}
+	};
+
+	// The calling thread takes the first chunk itself.
+	for (std::size_t chunk = 1; chunk < chunkCount; ++chunk)
+	{
+		std::size_t chunkBegin = begin + chunk * grainSize;
+		std::size_t chunkEnd = std::min(end, chunkBegin + grainSize);
+		submit([&, chunkBegin, chunkEnd]
+		{
+			try
+			{
+				body(chunkBegin, chunkEnd);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(stateMutex);
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+			}
+			finishChunk();
+		});
+	}
+
+	try
+	{
+		body(begin, std::min(end, begin + grainSize));
+	} catch (...)
+	{
+		std::lock_guard<std::mutex> lock(stateMutex);
+		if (!error)
+		{
+			error = std::current_exception();
+		}
+	}
+	finishChunk();
+
+	// Helps with queued tasks, a nested parallelFor may wait for them, and
+	// sleeps once there are none. Submitting does not notify this caller,
+	// so the sleep is bounded.
+	int self = currentWorkerIndex();
+	std::unique_lock<std::mutex> lock(stateMutex);
+	while (remaining > 0)
+	{
+		lock.unlock();
+		bool ran = runPendingTask(self);
+		lock.lock();
+		if (!ran)
+		{
+			finished.wait_for(lock, std::chrono::milliseconds(1), [&]
+			{
+				return remaining == 0 || this->pending > 0;
+			});
+		}
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+TaskScheduler::Statistics TaskScheduler::getStatistics() const
+{
+	Statistics stats;
+	stats.workerCount = getWorkerCount();
+	stats.tasksSubmitted = this->tasksSubmitted;
+	stats.tasksExecuted = this->tasksExecuted;
+	stats.tasksStolen = this->tasksStolen;
+	stats.busyMicroseconds = this->busyMicroseconds;
+	stats.uptimeMicroseconds = std::chrono::duration_cast
+			< std::chrono::microseconds
+			> (std::chrono::steady_clock::now().time_since_epoch()
+					- std::chrono::steady_clock::duration(this->startTime)).count();
+	double available = static_cast<double>(stats.uptimeMicroseconds)
+			* stats.workerCount;
+	stats.utilization =
+			available > 0 ? stats.busyMicroseconds / available : 0.0;
+	if (stats.utilization > 1.0)
+	{
+		stats.utilization = 1.0;
+	}
+	return stats;
+}
+
+void TaskScheduler::resetStatistics()
+{
+	this->tasksSubmitted = 0;
+	this->tasksExecuted = 0;
+	this->tasksStolen = 0;
+	this->busyMicroseconds = 0;
+	this->startTime =
+			std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+TaskScheduler::~TaskScheduler()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+		this->stopping = true;
+	}
+	this->wakeUp.notify_all();
+	for (auto &worker : this->workers)
+	{
+		worker.join();
+	}
+}
@@ -0,0 +1,163 @@
+/**
+ * @file TaskScheduler.h
+ * @brief TaskScheduler class declaration for parallel bulk operations.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef TASKSCHEDULER_H_
+#define TASKSCHEDULER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class TaskScheduler
+ * @brief Work-stealing thread pool used for the bulk operations of StudentDb.
+ *
+ * Every worker owns a task deque. A worker pops its own tasks from the back
+ * and steals from the front of the other deques when it runs dry. Threads
+ * waiting in parallelFor() help executing tasks instead of blocking.
+ */
+class TaskScheduler
+{
+public:
+	/**
+	 * @struct Statistics
+	 * @brief Utilization counters of the scheduler.
+	 */
+	struct Statistics
+	{
+		unsigned int workerCount; ///< Number of worker threads.
+		unsigned long long tasksSubmitted; ///< Tasks queued so far.
+		unsigned long long tasksExecuted; ///< Tasks run to completion so far.
+		unsigned long long tasksStolen; ///< Tasks taken from another worker's deque.
+		unsigned long long busyMicroseconds; ///< Summed time spent running tasks.
+		unsigned long long uptimeMicroseconds; ///< Time since construction or last reset.
+		double utilization; ///< Busy time relative to the available worker time (0..1).
+	};
+
+private:
+	/**
+	 * @struct WorkerQueue
+	 * @brief Task deque of a single worker.
+	 */
+	struct WorkerQueue
+	{
+		std::mutex mutex; ///< Guards the task deque.
+		std::deque<std::function<void()>> tasks; ///< Pending tasks.
+	};
+
+	std::vector<std::unique_ptr<WorkerQueue>> queues; ///< One deque per worker.
+	std::vector<std::thread> workers; ///< Worker threads.
+	std::atomic<bool> stopping; ///< Set when the scheduler shuts down.
+	std::atomic<unsigned long long> pending; ///< Tasks currently queued.
+	std::atomic<unsigned int> nextQueue; ///< Round robin cursor for external submits.
+	std::mutex sleepMutex; ///< Mutex for the idle condition variable.
+	std::condition_variable wakeUp; ///< Signals idle workers about new tasks.
+
+	std::atomic<unsigned long long> tasksSubmitted; ///< Counter of submitted tasks.
+	std::atomic<unsigned long long> tasksExecuted; ///< Counter of executed tasks.
+	std::atomic<unsigned long long> tasksStolen; ///< Counter of stolen tasks.
+	std::atomic<unsigned long long> busyMicroseconds; ///< Counter of busy time.
+	std::atomic<std::chrono::steady_clock::rep> startTime; ///< Begin of the statistics period in clock ticks, atomic for resetStatistics().
+
+	/**
+	 * @brief Index of the calling worker thread or -1 for foreign threads.
+	 * @return Worker index if the caller belongs to this scheduler, else -1.
+	 */
+	int currentWorkerIndex() const;
+
+	/**
+	 * @brief Takes one task, first from the own deque, then by stealing.
+	 * @param self Index of the calling worker or -1.
+	 * @param task Receives the task.
+	 * @return True if a task was taken.
+	 */
+	bool takeTask(int self, std::function<void()> &task);
+
+	/**
+	 * @brief Runs one pending task if there is any.
+	 * @param self Index of the calling worker or -1.
+	 * @return True if a task was executed.
+	 */
+	bool runPendingTask(int self);
+
+	/**
+	 * @brief Main loop of a worker thread.
+	 * @param index Index of the worker.
+	 */
+	void workerLoop(unsigned int index);
+
+public:
+	/**
+	 * @brief Starts the worker threads.
+	 * @param workerCount Number of workers, 0 selects the hardware concurrency.
+	 */
+	explicit TaskScheduler(unsigned int workerCount = 0);
+
+	TaskScheduler(const TaskScheduler&) = delete;
+	TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+	/**
+	 * @brief Returns the number of worker threads.
+	 * @return Worker count.
+	 */
+	unsigned int getWorkerCount() const;
+
+	/**
+	 * @brief Queues a task for asynchronous execution.
+	 *
+	 * Tasks submitted from a worker go to that worker's own deque, all other
+	 * tasks are distributed round robin.
+	 * @param task The task to run. Exceptions thrown by it are discarded.
+	 */
+	void submit(std::function<void()> task);
+
+	/**
+	 * @brief Runs body over [begin, end) split into chunks and waits for it.
+	 *
+	 * The chunks are [begin + k * grainSize, begin + (k + 1) * grainSize),
+	 * clipped to end, so callers may use (chunkBegin - begin) / grainSize as
+	 * a slot index for per chunk results. The first exception thrown by body
+	 * is rethrown after all chunks have finished.
+	 * @param begin First index of the range.
+	 * @param end One past the last index of the range.
+	 * @param grainSize Chunk length, 0 selects it from the worker count.
+	 * @param body Function called with the bounds of each chunk.
+	 */
+	void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize,
+			const std::function<void(std::size_t, std::size_t)> &body);
+
+	/**
+	 * @brief Chunk length used by parallelFor() for a grain size of 0.
+	 * @param count Length of the range.
+	 * @return Chunk length, at least 1.
+	 */
+	std::size_t defaultGrainSize(std::size_t count) const;
+
+	/**
+	 * @brief Returns the utilization counters.
+	 * @return Snapshot of the counters.
+	 */
+	Statistics getStatistics() const;
+
+	/**
+	 * @brief Resets the utilization counters.
+	 */
+	void resetStatistics();
+
+	/**
+	 * @brief Stops and joins all workers. Queued tasks are still executed.
+	 */
+	virtual ~TaskScheduler();
+};
+
+#endif /* TASKSCHEDULER_H_ */
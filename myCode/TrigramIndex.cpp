@@ -0,0 +1,163 @@
+/**
+ * @file TrigramIndex.cpp
+ * @brief TrigramIndex class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "TrigramIndex.h"
+#include <algorithm>
+#include <iterator>
+
+const std::size_t TrigramIndex::minQueryLength;
+
+std::uint32_t TrigramIndex::trigramAt(const std::string &text,
+		std::size_t pos)
+{
+	return (static_cast<std::uint32_t>(static_cast<unsigned char>(text[pos]))
+			<< 16)
+			| (static_cast<std::uint32_t>(static_cast<unsigned char>(text[pos
+					+ 1])) << 8)
+			| static_cast<std::uint32_t>(static_cast<unsigned char>(text[pos + 2]));
+}
+
+std::vector<std::uint32_t> TrigramIndex::trigramsOf(const std::string &text)
+{
+	std::vector<std::uint32_t> keys;
+	if (text.size() < minQueryLength)
+	{
+		return keys;
+	}
+	keys.reserve(text.size() - 2);
+	for (std::size_t pos = 0; pos + 2 < text.size(); ++pos)
+	{
+		keys.push_back(trigramAt(text, pos));
+	}
+	std::sort(keys.begin(), keys.end());
+	keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+	return keys;
+}
+
+void TrigramIndex::insert(unsigned int matrikelNumber, const std::string &text)
+{
+	remove(matrikelNumber);
+	for (std::uint32_t key : trigramsOf(text))
+	{
+		auto &list = this->postings[key];
+		if (list.empty() || list.back() < matrikelNumber)
+		{
+			list.push_back(matrikelNumber);
+		}
+		else
+		{
+			list.insert(std::lower_bound(list.begin(), list.end(), matrikelNumber),
+					matrikelNumber);
+		}
+	}
+	this->texts[matrikelNumber] = text;
+}
+
+void TrigramIndex::remove(unsigned int matrikelNumber)
+{
+	auto it = this->texts.find(matrikelNumber);
+	if (it == this->texts.end())
+	{
+		return;
+	}
+	for (std::uint32_t key : trigramsOf(it->second))
+	{
+		auto posting = this->postings.find(key);
+		if (posting == this->postings.end())
+		{
+			continue;
+		}
+		auto &list = posting->second;
+		auto pos = std::lower_bound(list.begin(), list.end(), matrikelNumber);
+		if (pos != list.end() && *pos == matrikelNumber)
+		{
+			list.erase(pos);
+		}
+		if (list.empty())
+		{
+			this->postings.erase(posting);
+		}
+	}
+	this->texts.erase(it);
+}
+
+std::vector<unsigned int> TrigramIndex::search(const std::string &query) const
+{
+	std::vector<unsigned int> result;
+	std::vector<const std::vector<unsigned int>*> lists;
+	for (std::uint32_t key : trigramsOf(query))
+	{
+		auto posting = this->postings.find(key);
+		if (posting == this->postings.end())
+		{
+			return result;
+		}
+		lists.push_back(&posting->second);
+	}
+	if (lists.empty())
+	{
+		return result;
+	}
+
+	std::sort(lists.begin(), lists.end(),
+			[](const std::vector<unsigned int> *a,
+					const std::vector<unsigned int> *b)
+					{
+						return a->size() < b->size();
+					});
+
+	std::vector<unsigned int> candidates = *lists.front();
+	std::vector<unsigned int> narrowed;
+	for (std::size_t i = 1; i < lists.size() && !candidates.empty(); ++i)
+	{
+		narrowed.clear();
+		std::set_intersection(candidates.begin(), candidates.end(),
+				lists[i]->begin(), lists[i]->end(), std::back_inserter(narrowed));
+		candidates.swap(narrowed);
+	}
+
+	// All trigrams present does not imply they are adjacent, so verify.
+	for (unsigned int matrikelNumber : candidates)
+	{
+		if (this->texts.at(matrikelNumber).find(query) != std::string::npos)
+		{
+			result.push_back(matrikelNumber);
+		}
+	}
+	return result;
+}
+
+std::size_t TrigramIndex::estimate(const std::string &query) const
+{
+	std::size_t shortest = 0;
+	bool first = true;
+	for (std::uint32_t key : trigramsOf(query))
+	{
+		auto posting = this->postings.find(key);
+		if (posting == this->postings.end())
+		{
+			return 0;
+		}
+		if (first || posting->second.size() < shortest)
+		{
+			shortest = posting->second.size();
+			first = false;
+		}
+	}
+	return shortest;
+}
+
+std::size_t TrigramIndex::size() const
+{
+	return this->texts.size();
+}
+
+void TrigramIndex::clear()
+{
+	this->postings.clear();
+	this->texts.clear();
+}
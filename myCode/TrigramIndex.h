@@ -0,0 +1,91 @@
+/**
+ * @file TrigramIndex.h
+ * @brief TrigramIndex class declaration for substring search over student names.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef TRIGRAMINDEX_H_
+#define TRIGRAMINDEX_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TrigramIndex
+ * @brief Inverted index from character trigrams to matrikel numbers.
+ *
+ * Each indexed text is split into all its three byte substrings. A
+ * substring query of at least three bytes intersects the posting lists of
+ * its trigrams, starting with the shortest one, and verifies the few
+ * remaining candidates against the stored text.
+ */
+class TrigramIndex
+{
+private:
+	std::unordered_map<std::uint32_t, std::vector<unsigned int>> postings; ///< Sorted matrikel numbers per trigram.
+	std::unordered_map<unsigned int, std::string> texts; ///< Indexed text per matrikel number.
+
+	/**
+	 * @brief Packs the three bytes starting at pos into a key.
+	 * @param text Source text.
+	 * @param pos Start of the trigram.
+	 * @return Trigram key.
+	 */
+	static std::uint32_t trigramAt(const std::string &text, std::size_t pos);
+
+	/**
+	 * @brief Collects the distinct trigram keys of a text.
+	 * @param text Source text.
+	 * @return Sorted distinct keys.
+	 */
+	static std::vector<std::uint32_t> trigramsOf(const std::string &text);
+
+public:
+	/**
+	 * @brief Shortest query length answered from the index.
+	 */
+	static const std::size_t minQueryLength = 3;
+
+	/**
+	 * @brief Adds or replaces the text indexed for a matrikel number.
+	 * @param matrikelNumber Student identifier.
+	 * @param text Text to index, typically "first last".
+	 */
+	void insert(unsigned int matrikelNumber, const std::string &text);
+
+	/**
+	 * @brief Removes a matrikel number from the index.
+	 * @param matrikelNumber Student identifier.
+	 */
+	void remove(unsigned int matrikelNumber);
+
+	/**
+	 * @brief Finds all matrikel numbers whose text contains a substring.
+	 * @param query Substring of at least minQueryLength bytes.
+	 * @return Matching matrikel numbers in ascending order.
+	 */
+	std::vector<unsigned int> search(const std::string &query) const;
+
+	/**
+	 * @brief Bounds the result of search() without running it.
+	 * @param query Substring of at least minQueryLength bytes.
+	 * @return Length of the shortest posting list of the query's trigrams.
+	 */
+	std::size_t estimate(const std::string &query) const;
+
+	/**
+	 * @brief Returns the number of indexed texts.
+	 * @return Count of matrikel numbers in the index.
+	 */
+	std::size_t size() const;
+
+	/**
+	 * @brief Removes all entries.
+	 */
+	void clear();
+};
+
+#endif /* TRIGRAMINDEX_H_ */
@@ -0,0 +1,134 @@
+/**
+ * @file WeekBitmap.cpp
+ * @brief WeekBitmap class implementation.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#include "WeekBitmap.h"
+#include <algorithm>
+
+const int WeekBitmap::slotMinutes;
+const int WeekBitmap::slotsPerDay;
+const int WeekBitmap::slotCount;
+const int WeekBitmap::wordCount;
+
+WeekBitmap::WeekBitmap()
+{
+	this->words.fill(0);
+}
+
+WeekBitmap& WeekBitmap::set(int startMinute, int endMinute)
+{
+	int first = std::max(startMinute, 0) / slotMinutes;
+	int last = std::min((endMinute + slotMinutes - 1) / slotMinutes, slotCount);
+	for (int slot = first; slot < last;)
+	{
+		int bit = slot % 64;
+		int length = std::min(64 - bit, last - slot);
+		std::uint64_t mask =
+				length == 64 ? ~std::uint64_t(0) :
+						((std::uint64_t(1) << length) - 1) << bit;
+		this->words[slot / 64] |= mask;
+		slot += length;
+	}
+	return *this;
+}
+
+bool WeekBitmap::test(int slot) const
+{
+	return (this->words[slot / 64] >> (slot % 64)) & 1;
+}
+
+bool WeekBitmap::intersects(const WeekBitmap &other) const
+{
+	for (int i = 0; i < wordCount; ++i)
+	{
+		if (this->words[i] & other.words[i])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int WeekBitmap::count() const
+{
+	int total = 0;
+	for (std::uint64_t word : this->words)
+	{
+		total += __builtin_popcountll(word);
+	}
+	return total;
+}
+
+std::vector<std::pair<int, int>> WeekBitmap::ranges() const
+{
+	std::vector<std::pair<int, int>> result;
+	int slot = 0;
+	while (slot < slotCount)
+	{
+		// Skip whole empty or full words instead of testing every bit.
+		std::uint64_t word = this->words[slot / 64] >> (slot % 64);
+		if (word == 0)
+		{
+			slot = (slot / 64 + 1) * 64;
+			continue;
+		}
+		slot += __builtin_ctzll(word);
+		int start = slot;
+		while (slot < slotCount)
+		{
+			std::uint64_t rest = ~this->words[slot / 64] >> (slot % 64);
+			if (rest == 0)
+			{
+				slot = (slot / 64 + 1) * 64;
+				continue;
+			}
+			slot += __builtin_ctzll(rest);
+			break;
+		}
+		slot = std::min(slot, slotCount);
+		result.push_back(std::make_pair(start * slotMinutes, slot * slotMinutes));
+	}
+	return result;
+}
+
+WeekBitmap& WeekBitmap::operator|=(const WeekBitmap &other)
+{
+	for (int i = 0; i < wordCount; ++i)
+	{
+		this->words[i] |= other.words[i];
+	}
+	return *this;
+}
+
+WeekBitmap& WeekBitmap::operator&=(const WeekBitmap &other)
+{
+	for (int i = 0; i < wordCount; ++i)
+	{
+		this->words[i] &= other.words[i];
+	}
+	return *this;
+}
+
+WeekBitmap& WeekBitmap::subtract(const WeekBitmap &other)
+{
+	for (int i = 0; i < wordCount; ++i)
+	{
+		this->words[i] &= ~other.words[i];
+	}
+	return *this;
+}
+
+WeekBitmap WeekBitmap::operator|(const WeekBitmap &other) const
+{
+	WeekBitmap result(*this);
+	return result |= other;
+}
+
+WeekBitmap WeekBitmap::operator&(const WeekBitmap &other) const
+{
+	WeekBitmap result(*this);
+	return result &= other;
+}
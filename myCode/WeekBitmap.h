@@ -0,0 +1,87 @@
+/**
+ * @file WeekBitmap.h
+ * @brief WeekBitmap class declaration for weekly occupancy sets.
+ * @date 19-Oct-2026
+ * @author Sree Samanvitha Manoor Vadhoolas
+ */
+
+#ifndef WEEKBITMAP_H_
+#define WEEKBITMAP_H_
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @class WeekBitmap
+ * @brief One bit per 5 minute slot of a week, Sunday 00:00 first.
+ *
+ * Set operations work on whole 64 bit words, a week takes 32 words.
+ */
+class WeekBitmap
+{
+public:
+	static const int slotMinutes = 5; ///< Length of a slot in minutes.
+	static const int slotsPerDay = 24 * 60 / slotMinutes; ///< Slots of one day.
+	static const int slotCount = 7 * slotsPerDay; ///< Slots of the week.
+	static const int wordCount = (slotCount + 63) / 64; ///< 64 bit words of the week.
+
+private:
+	std::array<std::uint64_t, wordCount> words; ///< The bits, slot i in word i / 64.
+
+public:
+	/**
+	 * @brief Creates an empty bitmap.
+	 */
+	WeekBitmap();
+
+	/**
+	 * @brief Marks the slots touched by a time range.
+	 * @param startMinute Minutes since Sunday 00:00, inclusive.
+	 * @param endMinute Minutes since Sunday 00:00, exclusive.
+	 * @return This bitmap.
+	 */
+	WeekBitmap& set(int startMinute, int endMinute);
+
+	/**
+	 * @brief Checks a single slot.
+	 * @param slot Slot index, 0 is Sunday 00:00.
+	 * @return True if the slot is marked.
+	 */
+	bool test(int slot) const;
+
+	/**
+	 * @brief Checks for a common slot without building the intersection.
+	 * @param other Another bitmap.
+	 * @return True if both bitmaps mark some slot.
+	 */
+	bool intersects(const WeekBitmap &other) const;
+
+	/**
+	 * @brief Counts the marked slots.
+	 * @return Number of marked slots.
+	 */
+	int count() const;
+
+	/**
+	 * @brief Lists maximal runs of marked slots.
+	 * @return (start minute, end minute) pairs since Sunday 00:00.
+	 */
+	std::vector<std::pair<int, int>> ranges() const;
+
+	WeekBitmap& operator|=(const WeekBitmap &other);
+	WeekBitmap& operator&=(const WeekBitmap &other);
+
+	/**
+	 * @brief Removes the slots of another bitmap.
+	 * @param other Slots to clear.
+	 * @return This bitmap.
+	 */
+	WeekBitmap& subtract(const WeekBitmap &other);
+
+	WeekBitmap operator|(const WeekBitmap &other) const;
+	WeekBitmap operator&(const WeekBitmap &other) const;
+};
+
+#endif /* WEEKBITMAP_H_ */
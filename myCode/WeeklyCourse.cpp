@@ -11,6 +11,16 @@ WeeklyCourse::WeeklyCourse(unsigned int courseKey, const std::string major,
 		const std::string title, unsigned int creditPts,
 		const Poco::DateTime::DaysOfWeek day, const Poco::Data::Time sTime,
 		const Poco::Data::Time eTime) :
+		Course(courseKey, title, major, creditPts), daysOfWeek(day), startTime(
+				CompactTime::fromTime(sTime)), endTime(
+				CompactTime::fromTime(eTime))
+{
+}
+
+WeeklyCourse::WeeklyCourse(unsigned int courseKey, const std::string major,
+		const std::string title, unsigned int creditPts,
+		const Poco::DateTime::DaysOfWeek day, CompactTime sTime,
+		CompactTime eTime) :
 		Course(courseKey, title, major, creditPts), daysOfWeek(day), startTime(
 				sTime), endTime(eTime)
 {
@@ -23,12 +33,22 @@ Poco::DateTime::DaysOfWeek WeeklyCourse::getDayOfWeek() const
 
 Poco::Data::Time WeeklyCourse::getStartTime() const
 {
-	return this->startTime;
+	return this->startTime.toTime();
 }
 
 Poco::Data::Time WeeklyCourse::getEndTime() const
 {
-	return this->endTime;
+	return this->endTime.toTime();
+}
+
+int WeeklyCourse::getStartMinute() const
+{
+	return this->startTime.getMinuteOfDay();
+}
+
+int WeeklyCourse::getEndMinute() const
+{
+	return this->endTime.getMinuteOfDay();
 }
 
 void WeeklyCourse::write(std::ostream &out) const
@@ -36,61 +56,39 @@ void WeeklyCourse::write(std::ostream &out) const
 	out << "W;";
 	Course::write(out);
 	out << ";" << this->getDayOfWeek();
-	out << ";" << std::setfill('0') << std::setw(2)
-			<< this->getStartTime().hour() << ":" << std::setfill('0')
-			<< std::setw(2) << this->getStartTime().minute();
-	out << ";" << std::setfill('0') << std::setw(2) << this->getEndTime().hour()
+	out << ";" << std::setfill('0') << std::setw(2) << this->startTime.hour()
+			<< ":" << std::setfill('0') << std::setw(2)
+			<< this->startTime.minute();
+	out << ";" << std::setfill('0') << std::setw(2) << this->endTime.hour()
 			<< ":" << std::setfill('0') << std::setw(2)
-			<< this->getEndTime().minute() << std::endl;
+			<< this->endTime.minute() << std::endl;
 
 }
 
 std::unique_ptr<Course> WeeklyCourse::read(std::istream &in)
 {
-	unsigned int courseKey;
-	std::string title, major;
-	unsigned int creditPoints;
-	Poco::DateTime::DaysOfWeek dayOfWeek;
-	Poco::Data::Time startTime, endTime;
-
-	std::string inp;
-	std::getline(in, inp, ';');
-	courseKey = static_cast<unsigned int>(std::stoi(inp));
-//	std::cout << "coursekey: " << courseKey << std::endl;
-
-	std::getline(in, title, ';');
-//	std::cout << "title: " << title << std::endl;
-
-	std::getline(in, major, ';');
-//	std::cout << "major: " << major << std::endl;
-
-	std::getline(in, inp, ';');
-	creditPoints = static_cast<unsigned int>(std::stoi(inp));
-//	std::cout << "creditPoints: " << creditPoints << std::endl;
-
-	std::getline(in, inp, ';');
-	dayOfWeek = convertDay(inp);
-//	std::cout << "dayOfWeek: " << dayOfWeek << std::endl;
-
-	std::getline(in, inp, ';');
-	startTime = convertTime(inp);
-//	std::cout << "startTime: " << startTime.hour() << ":" << startTime.minute()
-//			<< std::endl;
+	FieldParser fields(FieldParser::readLine(in));
+	return read(fields);
+}
 
-	std::getline(in, inp);
-	endTime = convertTime(inp);
-//	std::cout << "endTime: " << endTime.hour() << ":" << endTime.minute()
-//			<< std::endl;
+std::unique_ptr<Course> WeeklyCourse::read(FieldParser &fields)
+{
+	unsigned int courseKey = fields.unsignedInteger();
+	std::string_view title = fields.text();
+	std::string_view major = fields.text();
+	unsigned int creditPoints = fields.unsignedInteger();
+	Poco::DateTime::DaysOfWeek dayOfWeek = convertDay(fields.text());
+	CompactTime startTime = fields.time();
+	CompactTime endTime = fields.time();
 
-	auto courses =
-			std::make_unique < WeeklyCourse
-					> (courseKey, major, title, creditPoints, dayOfWeek, startTime, endTime);
+	auto courses = std::make_unique < WeeklyCourse
+			> (courseKey, std::string(major), std::string(title), creditPoints, dayOfWeek, startTime, endTime);
 
 	return courses;
 
 }
 
-Poco::DateTime::DaysOfWeek WeeklyCourse::convertDay(std::string day)
+Poco::DateTime::DaysOfWeek WeeklyCourse::convertDay(std::string_view day)
 {
 
 	if (day == "1")
@@ -111,14 +109,6 @@ Poco::DateTime::DaysOfWeek WeeklyCourse::convertDay(std::string day)
 
 }
 
-Poco::Data::Time WeeklyCourse::convertTime(std::string timeString)
-{
-	int hour, minute, second = 0;
-	sscanf(timeString.c_str(), "%d:%d", &hour, &minute);
-	return Poco::Data::Time(hour, minute, second);
-
-}
-
 WeeklyCourse::~WeeklyCourse()
 {
 	// TODO Auto-generated destructor stub
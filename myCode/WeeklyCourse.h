@@ -13,6 +13,8 @@
 #include "Poco/DateTime.h"
 #include "Poco/Data/Time.h"
 #include "Course.h"
+#include "CompactTime.h"
+#include "FieldParser.h"
 
 /**
  * @class WeeklyCourse
@@ -22,22 +24,15 @@ class WeeklyCourse: public Course
 {
 private:
 	Poco::DateTime::DaysOfWeek daysOfWeek; ///< Day of the week the course occurs.
-	Poco::Data::Time startTime; ///< Start time of the course.
-	Poco::Data::Time endTime; ///< End time of the course.
+	CompactTime startTime; ///< Start time of the course.
+	CompactTime endTime; ///< End time of the course.
 
 	/**
 	 * @brief Converts a string to a Poco::DateTime::DaysOfWeek.
 	 * @param day String representation of the day.
 	 * @return Corresponding Poco::DateTime::DaysOfWeek value.
 	 */
-	static Poco::DateTime::DaysOfWeek convertDay(std::string day);
-
-	/**
-	 * @brief Converts a string to a Poco::Data::Time.
-	 * @param timeString String representation of the time.
-	 * @return Poco::Data::Time object.
-	 */
-	static Poco::Data::Time convertTime(std::string timeString);
+	static Poco::DateTime::DaysOfWeek convertDay(std::string_view day);
 
 public:
 	/**
@@ -55,6 +50,21 @@ public:
 			const Poco::DateTime::DaysOfWeek day, const Poco::Data::Time sTime,
 			const Poco::Data::Time eTime);
 
+	/**
+	 * @brief Constructor for WeeklyCourse from already converted fields.
+	 * @param courseKey Unique identifier for the course.
+	 * @param major Major associated with the course.
+	 * @param title Title of the course.
+	 * @param creditPts Credit points awarded for the course.
+	 * @param day Day of the week the course is held.
+	 * @param sTime Start time of the course.
+	 * @param eTime End time of the course.
+	 */
+	WeeklyCourse(unsigned int courseKey, const std::string major,
+			const std::string title, unsigned int creditPts,
+			const Poco::DateTime::DaysOfWeek day, CompactTime sTime,
+			CompactTime eTime);
+
 	/**
 	 * @brief Gets the day of the week the course is held.
 	 * @return The day of the week as Poco::DateTime::DaysOfWeek.
@@ -73,6 +83,18 @@ public:
 	 */
 	Poco::Data::Time getEndTime() const;
 
+	/**
+	 * @brief Gets the start time without converting it.
+	 * @return Minutes since midnight.
+	 */
+	int getStartMinute() const;
+
+	/**
+	 * @brief Gets the end time without converting it.
+	 * @return Minutes since midnight.
+	 */
+	int getEndMinute() const;
+
 	/**
 	 * @brief Writes course details to an output stream. Overrides Course::write.
 	 * @param out Output stream reference.
@@ -86,6 +108,13 @@ public:
 	 */
 	static std::unique_ptr<Course> read(std::istream &in);
 
+	/**
+	 * @brief Creates a WeeklyCourse from the fields following the type.
+	 * @param fields Parser positioned at the course key.
+	 * @return Unique pointer to the new WeeklyCourse.
+	 */
+	static std::unique_ptr<Course> read(FieldParser &fields);
+
 	/**
 	 * @brief Destructor for WeeklyCourse.
 	 */
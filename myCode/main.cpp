@@ -6,26 +6,496 @@
  * @author Sree Samanvitha Manoor Vadhoolas
  */
 #include <iostream>
+#include <charconv>
 #include <cstdlib>
+#include <limits>
 
 using namespace std;
 
 // Add your project's header files here
 #include "SimpleUI.h"
 #include "StudentDb.h"
+#include "GeneratorServer.h"
+#include "StudentLoadClient.h"
+
+/**
+ * @brief Prints the command line options.
+ * @param program Name the program was started with.
+ */
+static void printUsage(const char *program)
+{
+	cout << "Usage:\n"
+			"  " << program << " [--generator HOST:PORT]\n"
+			"      Interactive menu, HOST:PORT is the student data generator.\n"
+			"  " << program << " --fake-server [--port N] [--latency MS]"
+			" [--payload BYTES] [--malformed SHARE]\n"
+			"      Runs a local stand-in generator until Enter is pressed.\n"
+			"  " << program << " --benchmark-import [--records N]"
+			" [--connections N] [--window N] [--pipeline]\n"
+			"      [--generator HOST:PORT | --latency MS --payload BYTES"
+			" --malformed SHARE]\n"
+			"      Measures the import rate, against a local stand-in unless"
+			" --generator is given.\n"
+			"      --pipeline imports through the staged ingestion pipeline.\n"
+			"  " << program << " --serve [--bind ADDRESS] [--port N]"
+			" [--threads N] [--data FILE]\n"
+			"      [--replication-port N] [--log-entries N]\n"
+			"      Serves the database, loaded from FILE, over TCP until Enter"
+			" is pressed.\n"
+			"      With --replication-port, read replicas can follow it.\n"
+			"  " << program << " --serve --shard I --shards N [--shard-size R]"
+			" [--data FILE] [--bind ADDRESS]\n"
+			"      [--port N] [--threads N]\n"
+			"      Serves shard I of N, holding matrikel numbers 100000 + I * R"
+			" on, with FILE\n"
+			"      split off by --split-shards.\n"
+			"  " << program << " --split-shards --data FILE --shards N"
+			" [--shard-size R]\n"
+			"      Writes the students of each shard and all courses to"
+			" FILE.shard0 and on.\n"
+			"  " << program << " --router --shard-servers HOST:PORT,..."
+			" [--shard-size R] [--bind ADDRESS]\n"
+			"      [--port N] [--threads N]\n"
+			"      Serves the shards, given in shard order, as one"
+			" database.\n"
+			"  " << program << " --replica --primary HOST:PORT --state DIR"
+			" [--bind ADDRESS] [--port N]\n"
+			"      [--threads N]\n"
+			"      Serves a read replica of the primary at the replication"
+			" port HOST:PORT,\n"
+			"      keeping its state in the existing directory DIR.\n"
+			"  " << program << " --status --server HOST:PORT\n"
+			"      Prints the replication state of a server.\n"
+			"  " << program << " --batch [--script FILE] [--data FILE]\n"
+			"      Runs the commands of FILE, or of the standard input, on the"
+			" database\n"
+			"      loaded from --data without prompts, see"
+			" SimpleUI::runBatch().\n"
+			"  " << program << " --load-test [--server HOST:PORT]"
+			" [--requests N] [--connections N] [--window N]\n"
+			"      [--writes SHARE] [--searches SHARE] [--students N]"
+			" [--matrikels FIRST:LAST]\n"
+			"      Measures a server's latency, against a local server with"
+			" N random students\n"
+			"      unless --server is given.\n";
+}
+
+/**
+ * @brief Converts the value of a numeric option.
+ * @param option The option, for the error message.
+ * @param value The text.
+ * @param max Largest accepted value.
+ * @return The number.
+ * @throw invalid_argument If the text is not a whole number from 0 to max.
+ */
+static unsigned long parseNumber(const string &option, const string &value,
+		unsigned long max = numeric_limits<unsigned int>::max())
+{
+	unsigned long number;
+	auto result = from_chars(value.data(), value.data() + value.size(),
+			number);
+	if (value.empty() || result.ec != errc()
+			|| result.ptr != value.data() + value.size() || number > max)
+	{
+		throw invalid_argument(
+				"Expected a number from 0 to " + to_string(max) + " for "
+						+ option + ", got " + value);
+	}
+	return number;
+}
+
+/**
+ * @brief Converts the value of an option giving a share.
+ * @param option The option, for the error message.
+ * @param value The text.
+ * @return The share.
+ * @throw invalid_argument If the text is not a number from 0 to 1.
+ */
+static double parseShare(const string &option, const string &value)
+{
+	double share = -1;
+	size_t end = 0;
+	try
+	{
+		share = stod(value, &end);
+	} catch (const exception&)
+	{
+	}
+	if (end != value.size() || !(share >= 0 && share <= 1))
+	{
+		throw invalid_argument(
+				"Expected a share from 0 to 1 for " + option + ", got "
+						+ value);
+	}
+	return share;
+}
 
 /**
  * @brief Main function of the application.
  *
- * Creates instances of StudentDb and SimpleUI classes and runs the UI to start the application.
+ * Without options, creates instances of StudentDb and SimpleUI classes and
+ * runs the UI to start the application. The options select a stand-in
+ * generator server, an import benchmark, the database server, a read
+ * replica, a shard of a sharded database, its router, the splitting of a
+ * database file into shards, a status query, a command script or a server
+ * load test instead, see printUsage().
  *
- * @return int Returns 0 upon successful execution.
+ * @param argc Number of command line arguments.
+ * @param argv Command line arguments.
+ * @return int Returns 0 upon successful execution, 1 for invalid options.
  */
-int main()
+int main(int argc, char *argv[])
 {
+	string mode;
+	string host = "www.hhs.users.h-da.cloud";
+	string port = "4242";
+	bool generatorGiven = false;
+	bool pipeline = false;
+	unsigned short serverPort = 0;
+	unsigned int records = 10000;
+	unsigned int connections = 4;
+	unsigned int window = 32;
+	GeneratorServer::Settings settings =
+	{ std::chrono::milliseconds(0), 0, 0 };
+	string bindAddress = "127.0.0.1";
+	unsigned int serverThreads = 0;
+	string dataFile;
+	string scriptFile;
+	string targetHost;
+	string targetPort;
+	unsigned int localStudents = 10000;
+	int replicationPort = -1;
+	size_t logEntries = 100000;
+	string primaryHost;
+	string primaryPort;
+	string stateDirectory;
+	int shardIndex = -1;
+	unsigned int shardCount = 1;
+	unsigned int shardSize = 1000000;
+	vector<string> shardServers;
+	StudentLoadClient::Settings load =
+	{ 4, 32, 100000, 0.1, 0.1, 100000, 109999 };
+
+	try
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			string option = argv[i];
+			if (option == "--fake-server" || option == "--benchmark-import"
+					|| option == "--serve" || option == "--load-test"
+					|| option == "--replica" || option == "--status"
+					|| option == "--router" || option == "--split-shards"
+					|| option == "--batch")
+			{
+				mode = option;
+				continue;
+			}
+			if (option == "--pipeline")
+			{
+				pipeline = true;
+				continue;
+			}
+			if (option.compare(0, 2, "--") != 0 || i + 1 >= argc)
+			{
+				throw invalid_argument("Missing value for " + option);
+			}
+			string value = argv[++i];
+			if (option == "--generator")
+			{
+				size_t colon = value.rfind(':');
+				if (colon == string::npos)
+				{
+					throw invalid_argument("Expected HOST:PORT, got " + value);
+				}
+				host = value.substr(0, colon);
+				port = value.substr(colon + 1);
+				generatorGiven = true;
+			}
+			else if (option == "--server" || option == "--matrikels"
+					|| option == "--primary")
+			{
+				size_t colon = value.rfind(':');
+				if (colon == string::npos)
+				{
+					throw invalid_argument(
+							"Expected two values separated by ':', got " + value);
+				}
+				if (option == "--server")
+				{
+					targetHost = value.substr(0, colon);
+					targetPort = value.substr(colon + 1);
+				}
+				else if (option == "--primary")
+				{
+					primaryHost = value.substr(0, colon);
+					primaryPort = value.substr(colon + 1);
+				}
+				else
+				{
+					load.firstMatrikel = parseNumber(option,
+							value.substr(0, colon));
+					load.lastMatrikel = parseNumber(option,
+							value.substr(colon + 1));
+				}
+			}
+			else if (option == "--bind")
+			{
+				bindAddress = value;
+			}
+			else if (option == "--threads")
+			{
+				serverThreads = parseNumber(option, value);
+			}
+			else if (option == "--data")
+			{
+				dataFile = value;
+			}
+			else if (option == "--script")
+			{
+				scriptFile = value;
+			}
+			else if (option == "--replication-port")
+			{
+				replicationPort = parseNumber(option, value,
+						numeric_limits<unsigned short>::max());
+			}
+			else if (option == "--log-entries")
+			{
+				logEntries = parseNumber(option, value);
+			}
+			else if (option == "--state")
+			{
+				stateDirectory = value;
+			}
+			else if (option == "--shard")
+			{
+				shardIndex = parseNumber(option, value,
+						numeric_limits<int>::max());
+			}
+			else if (option == "--shards")
+			{
+				shardCount = parseNumber(option, value);
+			}
+			else if (option == "--shard-size")
+			{
+				shardSize = parseNumber(option, value);
+			}
+			else if (option == "--shard-servers")
+			{
+				size_t start = 0;
+				while (start <= value.size())
+				{
+					size_t comma = value.find(',', start);
+					if (comma == string::npos)
+					{
+						comma = value.size();
+					}
+					shardServers.push_back(value.substr(start, comma - start));
+					start = comma + 1;
+				}
+			}
+			else if (option == "--requests")
+			{
+				load.requests = parseNumber(option, value);
+			}
+			else if (option == "--writes")
+			{
+				load.writeShare = parseShare(option, value);
+			}
+			else if (option == "--searches")
+			{
+				load.searchShare = parseShare(option, value);
+			}
+			else if (option == "--students")
+			{
+				localStudents = parseNumber(option, value);
+			}
+			else if (option == "--port")
+			{
+				serverPort = parseNumber(option, value,
+						numeric_limits<unsigned short>::max());
+			}
+			else if (option == "--latency")
+			{
+				settings.latency = std::chrono::milliseconds(
+						parseNumber(option, value));
+			}
+			else if (option == "--payload")
+			{
+				settings.payloadSize = parseNumber(option, value);
+			}
+			else if (option == "--malformed")
+			{
+				settings.malformedRate = parseShare(option, value);
+			}
+			else if (option == "--records")
+			{
+				records = parseNumber(option, value);
+			}
+			else if (option == "--connections")
+			{
+				connections = load.connections = parseNumber(option, value);
+			}
+			else if (option == "--window")
+			{
+				window = load.window = parseNumber(option, value);
+			}
+			else
+			{
+				throw invalid_argument("Unknown option " + option);
+			}
+		}
+	} catch (const exception &e)
+	{
+		cout << e.what() << endl;
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	if (mode == "--fake-server")
+	{
+		GeneratorServer server(serverPort, settings);
+		cout << "Generator stand-in listening on 127.0.0.1:"
+				<< server.getPort() << ", press Enter to stop." << endl;
+		string line;
+		getline(cin, line);
+		server.stop();
+		cout << server.getRecordsSent() << " records sent." << endl;
+		return 0;
+	}
+
 	cout << "lab3 started." << endl;
 	StudentDb sd;
-	SimpleUI su(sd);
+	SimpleUI su(sd, host, port);
+	if (mode == "--benchmark-import")
+	{
+		su.benchmarkImport(records, connections, window,
+				generatorGiven ? nullptr : &settings, pipeline);
+		return 0;
+	}
+	if (mode == "--split-shards")
+	{
+		if (dataFile.empty())
+		{
+			cout << "--split-shards needs --data FILE" << endl;
+			return 1;
+		}
+		return su.splitShards(dataFile, ShardMap(shardCount, shardSize)) ?
+				0 : 1;
+	}
+	if (mode == "--serve")
+	{
+		if (shardIndex >= 0 && static_cast<unsigned int>(shardIndex) >= shardCount)
+		{
+			cout << "--shard must be less than --shards" << endl;
+			return 1;
+		}
+		if (!dataFile.empty())
+		{
+			// A shard's file is split off with the matrikel numbers kept.
+			ifstream in(dataFile);
+			RecordValidator validator;
+			if (!in || !sd.read(in, &validator, nullptr, shardIndex >= 0))
+			{
+				cout << "Could not load " << dataFile << endl;
+				return 1;
+			}
+		}
+		try
+		{
+			if (shardIndex >= 0)
+			{
+				su.serveShard(ShardMap(shardCount, shardSize), shardIndex,
+						bindAddress, serverPort, serverThreads);
+			}
+			else if (replicationPort >= 0)
+			{
+				su.servePrimary(bindAddress, serverPort, serverThreads,
+						static_cast<unsigned short>(replicationPort),
+						logEntries);
+			}
+			else
+			{
+				su.serveDatabase(bindAddress, serverPort, serverThreads);
+			}
+		} catch (const exception &e)
+		{
+			cout << "Server failed: " << e.what() << endl;
+			return 1;
+		}
+		return 0;
+	}
+	if (mode == "--replica" || mode == "--status")
+	{
+		try
+		{
+			if (mode == "--status")
+			{
+				if (targetHost.empty())
+				{
+					throw invalid_argument("--status needs --server HOST:PORT");
+				}
+				su.printServerStatus(targetHost, targetPort);
+			}
+			else
+			{
+				if (primaryHost.empty() || stateDirectory.empty())
+				{
+					throw invalid_argument(
+							"--replica needs --primary HOST:PORT and --state DIR");
+				}
+				su.serveReplica(primaryHost, primaryPort, stateDirectory,
+						bindAddress, serverPort, serverThreads);
+			}
+		} catch (const exception &e)
+		{
+			cout << e.what() << endl;
+			return 1;
+		}
+		return 0;
+	}
+	if (mode == "--batch")
+	{
+		if (!dataFile.empty())
+		{
+			ifstream in(dataFile);
+			RecordValidator validator;
+			if (!in || !sd.read(in, &validator))
+			{
+				cout << "Could not load " << dataFile << endl;
+				return 1;
+			}
+		}
+		if (scriptFile.empty())
+		{
+			return su.runBatch(cin, cout) == 0 ? 0 : 1;
+		}
+		ifstream script(scriptFile);
+		if (!script)
+		{
+			cout << "Could not open " << scriptFile << endl;
+			return 1;
+		}
+		return su.runBatch(script, cout) == 0 ? 0 : 1;
+	}
+	if (mode == "--router")
+	{
+		try
+		{
+			su.serveRouter(shardServers, shardSize, bindAddress, serverPort,
+					serverThreads);
+		} catch (const exception &e)
+		{
+			cout << "Router failed: " << e.what() << endl;
+			return 1;
+		}
+		return 0;
+	}
+	if (mode == "--load-test")
+	{
+		su.benchmarkServer(targetHost, targetPort, load, localStudents);
+		return 0;
+	}
 	su.run();
 
 	return 0;